@@ -1,9 +1,9 @@
 /**********************************************************************************************************************/
 /*                                                                                                                    */
 /*  Application : Log Decoder                                                                                         */
-/*  Description : Log decoder is a simple console application, that takes a .csv format logfile as an input           */
-/*                and provides an output log file also in .csv format, with Payload decoded into meaningful           */
-/*                values and additional flags if certains checks are violated for a given frame.                      */
+/*  Description : Log decoder library. Decodes the frames of a log with an explicit decoder context, so that          */
+/*                several logs can be decoded concurrently in the same process. The console application is a          */
+/*                thin wrapper over this library (log_decoder_Cli.c).                                                 */
 /*                                                                                                                    */
 /*  File        : log_decoder.c                                                                                       */
 /*                                                                                                                    */
@@ -12,20 +12,30 @@
 /*  Date        : 29/05/2022                                                                                          */
 /*                                                                                                                    */
 /**********************************************************************************************************************/
-/* 1 / LogDecoder_u8PosCalcFrameDropCnt                                                                               */
-/* 2 / LogDecoder_u8VelCalcFrameDropCnt                                                                               */
-/* 3 / LogDecoder_bPosTimeOutStatus                                                                                   */
-/* 4 / LogDecoder_bVelTimeOutStatus                                                                                   */
-/* 5 / LogDecoder_u8ChecksumStatus                                                                                    */
-/* 6 / LogDecoder_strPosFrameDecode                                                                                   */
-/* 7 / LogDecoder_strDecodeFrameContent                                                                               */
-/* 8 / LogDecoder_vidMainFunction                                                                                     */
+/* 1 / LogDecoder_u64CalcFrameDropCnt                                                                                 */
+/* 2 / LogDecoder_bTimeOutStatus                                                                                      */
+/* 3 / LogDecoder_u64Unwrap16                                                                                         */
+/* 4 / LogDecoder_u8ChecksumStatus                                                                                    */
+/* 5 / LogDecoder_vidSignalsDecode                                                                                    */
+/* 6 / LogDecoder_vidInit                                                                                             */
+/* 7 / LogDecoder_vidReset                                                                                            */
+/* 8 / LogDecoder_vidSetRegistry                                                                                      */
+/* 9 / LogDecoder_vidSetWrap16                                                                                        */
+/* 10 / LogDecoder_ptrDefaultRegistry                                                                                 */
+/* 11 / LogDecoder_vidSignalCompile                                                                                   */
+/* 12 / LogDecoder_ptrFrameState                                                                                      */
+/* 13 / LogDecoder_strDecodeFrameContent                                                                              */
+/* 14 / LogDecoder_vidBatchValidate                                                                                   */
+/* 15 / LogDecoder_vidBatchDecode                                                                                     */
+/* 16 / LogDecoder_f32DecodedValue                                                                                    */
+/* 17 / LogDecoder_u32FormatRow                                                                                       */
 /**********************************************************************************************************************/
 
 /**********************************************************************************************************************/
 /* INCLUDES                                                                                                           */
 /**********************************************************************************************************************/
 #include "log_decoder.h"
+#include "log_decoder_Kernel.h"
 
 /**********************************************************************************************************************/
 /* LOCAL DEFINES                                                                                                      */
@@ -35,138 +45,159 @@
 #define STATUS_OK                        1U
 #define STATUS_NOK                       0U
 #define CHECKSUM_OK                      0U
-#define STRING_COMPARE_OK                0U
 #define PAYLOAD_BYTES_NUMBER             4U
+#define PAYLOAD_BITS_NUMBER              32U
 #define SHIFT_8BITS                      8U
 #define SHIFT_16BITS                     16U
 #define MASK_1BYTE                       0xFFU
-#define MAX_POSITIVE_SIGNED_16BITS       32767U
+#define MASK_16BITS                      0xFFFFUL
+#define MAX_POSITIVE_SIGNED_16BITS       32767
+/* Frames per tile of the batch decoding, the tile arrays stay in the L1 / L2 cache                                   */
+#define KERNEL_TILE_FRAMES_NUMBER        1024U
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+#ifdef LOG_DECODER_SCHEMA_HEADER
+/* Production schema compiled by "--compile-schema", it replaces the built-in frame definitions                       */
+#include LOG_DECODER_SCHEMA_HEADER
+#define DEFAULT_REGISTRY                 LogDecoder_strSchemaRegistry
+#else
+#define DEFAULT_REGISTRY                 LogDecoder_strDefaultRegistry
+/* Built-in frame definitions, every ID which is not listed here is an invalid frame ID                               */
+static const LogDecoder_strRegistryType LogDecoder_strDefaultRegistry =
+{
+    .astrFrame =
+    {
+        [FRAME_ID_POSITION] =
+        {
+            .astrSignal =
+            {
+                /* PositionX : first 16 bits divided by 100 (m)                                   */
+                { .u8BitOffset = SHIFT_16BITS, .u8BitWidth = 16U, .bSigned = FALSE, .u8Column = DECODED_POSITION_X,
+                  .s32Offset = 0, .u16Divisor = 100U,
+                  .u32Mask = MASK_16BITS, .u32SignBit = 0U, .s32Scale = 10 },
+                /* PositionY : last 16 bits minus 32767 divided by 1000 (m)                       */
+                { .u8BitOffset = 0U, .u8BitWidth = 16U, .bSigned = FALSE, .u8Column = DECODED_POSITION_Y,
+                  .s32Offset = -MAX_POSITIVE_SIGNED_16BITS, .u16Divisor = 1000U,
+                  .u32Mask = MASK_16BITS, .u32SignBit = 0U, .s32Scale = 1 }
+            },
+            .u8SignalsNb    = 2U,
+            .u16CycleTime   = POS_TIMESTAMP_PERIODICITY,
+            .u16CycleMargin = POS_TIMESTAMP_MARGIN,
+            .bDefined       = TRUE
+        },
+        [FRAME_ID_VELOCITY] =
+        {
+            .astrSignal =
+            {
+                /* VelocityX : first 16 bits minus 32767 divided by 1000 (m/s)                    */
+                { .u8BitOffset = SHIFT_16BITS, .u8BitWidth = 16U, .bSigned = FALSE, .u8Column = DECODED_VELOCITY_X,
+                  .s32Offset = -MAX_POSITIVE_SIGNED_16BITS, .u16Divisor = 1000U,
+                  .u32Mask = MASK_16BITS, .u32SignBit = 0U, .s32Scale = 1 },
+                /* VelocityY : last 16 bits minus 32767 divided by 1000 (m/s)                     */
+                { .u8BitOffset = 0U, .u8BitWidth = 16U, .bSigned = FALSE, .u8Column = DECODED_VELOCITY_Y,
+                  .s32Offset = -MAX_POSITIVE_SIGNED_16BITS, .u16Divisor = 1000U,
+                  .u32Mask = MASK_16BITS, .u32SignBit = 0U, .s32Scale = 1 }
+            },
+            .u8SignalsNb    = 2U,
+            .u16CycleTime   = VEL_TIMESTAMP_PERIODICITY,
+            .u16CycleMargin = VEL_TIMESTAMP_MARGIN,
+            .bDefined       = TRUE
+        }
+    }
+};
+#endif
 
 /**********************************************************************************************************************/
 /* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
 /**********************************************************************************************************************/
-static uint16 LogDecoder_u8PosCalcFrameDropCnt(uint16 u16FrameNB);
-static uint16 LogDecoder_u8VelCalcFrameDropCnt(uint16 u16FrameNB);
-static boolean LogDecoder_bPosTimeOutStatus(uint16 u16FrameTimestamp);
-static boolean LogDecoder_bVelTimeOutStatus(uint16 u16FrameTimestamp);
-static boolean LogDecoder_bTimeOutStatus(uint8 u8FrameId, uint16 u16FrameTimestamp);
+static uint64 LogDecoder_u64CalcFrameDropCnt(LogDecoder_strFrameStateType *ptrState, uint64 u64FrameNB);
+static boolean LogDecoder_bTimeOutStatus(const LogDecoder_strFrameDefType *ptrFrameDef,
+                                         LogDecoder_strFrameStateType *ptrState, uint64 u64FrameTimestamp);
+static uint64 LogDecoder_u64Unwrap16(uint64 u64Previous, uint64 u64Counter, boolean bFirstReading);
 static boolean LogDecoder_u8ChecksumStatus(uint32 u32PayloadValue, uint8 u8Checksum);
-static strDecodedDataType LogDecoder_strPosFrameDecode(uint32 u32PayloadValue);
-static strDecodedDataType LogDecoder_strVelFrameDecode(uint32 u32PayloadValue);
-static LogDecoder_strOutputDataType LogDecoder_strDecodeFrameContent(LogDecoder_strInputDataType strInputData);
+static void LogDecoder_vidSignalsDecode(const LogDecoder_strFrameDefType *ptrFrameDef, uint32 u32PayloadValue,
+                                        strDecodedDataType *ptrDecodedData);
 
 /**********************************************************************************************************************/
 /* LOCAL FUNCTIONS DEFINITION                                                                                         */
 /**********************************************************************************************************************/
 /**********************************************************************************************************************/
 /*                                                                                                                    */
-/* !FuncName    : LogDecoder_u8PosCalcFrameDropCnt                                                                    */
-/* !Description : Calculate the cumulative number of droped Position frames                                           */
+/* !FuncName    : LogDecoder_u64CalcFrameDropCnt                                                                      */
+/* !Description : Calculate the cumulative number of droped frames of one frame ID. A frame which is not after the    */
+/*                previous one (late or repeated frame) adds no drop and the largest FrameNb is kept as previous one. */
 /*                                                                                                                    */
-/* !Inputs      : u16FrameNB                    !Comment : Counter of frames for a Position ID                        */
-/*                                              !Range   : [0, 65535]                                                 */
-/* !Outputs     : u16LocRetFrameDropCnt         !Comment : Return the cumulative number of droped frames              */
-/*                                              !Range   : [0, 65535]                                                 */
+/* !Inputs      : ptrState                      !Comment : Tracking state of the frame ID                             */
+/*                u64FrameNB                    !Comment : Counter of frames for the frame ID                         */
+/*                                              !Range   : [0, 2^64 - 1]                                              */
+/* !Outputs     : u64FrameDropCnt               !Comment : Return the cumulative number of droped frames              */
+/*                                              !Range   : [0, 2^64 - 1]                                              */
 /* !Number      : 1                                                                                                   */
 /*                                                                                                                    */
 /**********************************************************************************************************************/
-static uint16 LogDecoder_u8PosCalcFrameDropCnt(uint16 u16FrameNB)
+static uint64 LogDecoder_u64CalcFrameDropCnt(LogDecoder_strFrameStateType *ptrState, uint64 u64FrameNB)
 {
-    static uint16  u16LocPosFrameNbNm1    = FALSE;
-    static boolean bLocPosFirstReading    = TRUE;
-    static uint16  u16LocPosFrameDropCnt  = FALSE;
-
     /* Check if it's the first frame recieved                                                     */
-    if(bLocPosFirstReading == TRUE)
+    if(ptrState->bFirstReading == TRUE)
     {
-        /* Clear the first frame recieved flag and reset the counter                              */
-        u16LocPosFrameDropCnt = FALSE;
-        bLocPosFirstReading = FALSE;
+        /* Reset the counter, the first frame recieved flag is cleared by the caller              */
+        ptrState->u64FrameDropCnt = FALSE;
+        ptrState->u64FrameNbNm1   = u64FrameNB;
     }
-    else
+    else if(u64FrameNB > ptrState->u64FrameNbNm1)
     {
         /* Set the Frame Drop Counter to value equal to the difference between the previous frame */
         /* and the current frame minus 1. because for example :                                   */
         /* -> If (current = 2 ) - (Previous = 1) - (1) = (0) Then, no droped frame                */
         /* -> If (current = 4 ) - (Previous = 1) - (1) = (2) Then, we have two dropped frames     */
-        u16LocPosFrameDropCnt = u16LocPosFrameDropCnt + (u16FrameNB - u16LocPosFrameNbNm1 - 1);
-    }
-    /* Set prevoius fram equal to the current frame for the next iteration                        */
-    u16LocPosFrameNbNm1 = u16FrameNB;
-
-    return u16LocPosFrameDropCnt;
-}
-
-/**********************************************************************************************************************/
-/*                                                                                                                    */
-/* !FuncName    : LogDecoder_u8VelCalcFrameDropCnt                                                                    */
-/* !Description : Calculate the cumulative number of droped Velocity frames                                           */
-/*                                                                                                                    */
-/* !Inputs      : u16FrameNB                    !Comment : Counter of frames for a Velocity ID                        */
-/*                                              !Range   : [0, 65535]                                                 */
-/* !Outputs     : u16LocVelFrameDropCnt         !Comment : Return the cumulative number of droped frames              */
-/*                                              !Range   : [0, 65535]                                                 */
-/* !Number      : 2                                                                                                   */
-/*                                                                                                                    */
-/**********************************************************************************************************************/
-static uint16 LogDecoder_u8VelCalcFrameDropCnt(uint16 u16FrameNB)
-{
-    static uint16  u16LocVelFrameNbNm1    = FALSE;
-    static boolean bLocVelFirstReading    = TRUE;
-    static uint16  u16LocVelFrameDropCnt  = FALSE;
-
-    /* Check if it's the first frame recieved                                                     */
-    if(bLocVelFirstReading == TRUE)
-    {
-        /* Clear the first frame recieved flag and reset the counter                              */
-        u16LocVelFrameDropCnt = FALSE;
-        bLocVelFirstReading = FALSE;
+        ptrState->u64FrameDropCnt = ptrState->u64FrameDropCnt + (u64FrameNB - ptrState->u64FrameNbNm1 - 1U);
+        /* Set prevoius frame equal to the current frame for the next iteration                   */
+        ptrState->u64FrameNbNm1   = u64FrameNB;
     }
     else
     {
-        /* Set the Frame Drop Counter to value equal to the difference between the previous frame */
-        /* and the current frame minus 1. because for example :                                   */
-        /* -> If (current = 2 ) - (Previous = 1) - (1) = (0) Then, no droped frame                */
-        /* -> If (current = 4 ) - (Previous = 1) - (1) = (2) Then, we have two dropped frames     */
-        u16LocVelFrameDropCnt = u16LocVelFrameDropCnt + (u16FrameNB - u16LocVelFrameNbNm1 - 1);
+        /* Late or repeated frame : it was not dropped, and the next frames are still counted     */
+        /* from the previous one                                                                  */
     }
-    /* Set prevoius frame equal to the current frame for the next iteration                       */
-    u16LocVelFrameNbNm1 = u16FrameNB;
 
-    return u16LocVelFrameDropCnt;
+    return ptrState->u64FrameDropCnt;
 }
 
 /**********************************************************************************************************************/
 /*                                                                                                                    */
-/* !FuncName    : LogDecoder_bPosTimeOutStatus                                                                        */
-/* !Description : Check the timeout status for the current Position frame is OK or NOK                                */
+/* !FuncName    : LogDecoder_bTimeOutStatus                                                                           */
+/* !Description : Check the timeout status for the current frame is OK or NOK, against the cycle time of its ID       */
 /*                                                                                                                    */
-/* !Inputs      : u16FrameTimestamp             !Comment : Timestamp when the frame was received in (ms)              */
-/*                                              !Range   : [0, 65535]                                                 */
+/* !Inputs      : ptrFrameDef                   !Comment : Definition of the frame ID (cycle time and margin)         */
+/*                ptrState                      !Comment : Tracking state of the frame ID                             */
+/*                u64FrameTimestamp             !Comment : Timestamp when the frame was received in (ms)              */
+/*                                              !Range   : [0, 2^64 - 1]                                              */
 /* !Outputs     : bLocTimeOutStatus             !Comment : Return the TimeoutStatus for the given timestamp           */
 /*                                              !Range   : STATUS_OK,                                                 */
 /*                                                         STATUS_NOK                                                 */
-/* !Number      : 3                                                                                                   */
+/* !Number      : 2                                                                                                   */
 /*                                                                                                                    */
 /**********************************************************************************************************************/
-static boolean LogDecoder_bPosTimeOutStatus(uint16 u16FrameTimestamp)
+static boolean LogDecoder_bTimeOutStatus(const LogDecoder_strFrameDefType *ptrFrameDef,
+                                         LogDecoder_strFrameStateType *ptrState, uint64 u64FrameTimestamp)
 {
-    static uint16 u16LocPosTimeStampNm1 = FALSE;
-    static boolean bLocPosFirstReading = TRUE;
-           boolean bLocTimeOutStatus = STATUS_NOK;
+    boolean bLocTimeOutStatus = STATUS_NOK;
+    uint64 u64LocElapsedTime = u64FrameTimestamp - ptrState->u64TimestampNm1;
 
     /* Check if it's the first frame recieved                                                     */
-    if(bLocPosFirstReading == TRUE)
+    if(ptrState->bFirstReading == TRUE)
     {
-        /* Clear the first frame recieved flag and reset the return OK                            */
+        /* The first frame has no previous frame to be compared with, return OK                   */
         bLocTimeOutStatus = STATUS_OK;
-        bLocPosFirstReading = FALSE;
     }
     else
     {
-        /* Check if the timestamp is equal to the cycle time +/- range (25 +/- 2 ms)              */
-        if(  ((u16FrameTimestamp - u16LocPosTimeStampNm1) > (POS_TIMESTAMP_PERIODICITY + POS_TIMESTAMP_MARGIN))
-          || ((u16FrameTimestamp - u16LocPosTimeStampNm1) < (POS_TIMESTAMP_PERIODICITY - POS_TIMESTAMP_MARGIN)) )
+        /* Check if the timestamp is equal to the cycle time +/- range (e.g. 25 +/- 2 ms)         */
+        /* A timestamp going backward gives a huge elapsed time, it is reported as NOK            */
+        if(  (u64LocElapsedTime > (uint32)(ptrFrameDef->u16CycleTime + ptrFrameDef->u16CycleMargin))
+          || (u64LocElapsedTime < (uint32)(ptrFrameDef->u16CycleTime - ptrFrameDef->u16CycleMargin)) )
         {
             bLocTimeOutStatus = STATUS_NOK;
         }
@@ -176,54 +207,37 @@ static boolean LogDecoder_bPosTimeOutStatus(uint16 u16FrameTimestamp)
         }
     }
     /* Set prevoius frame equal to the current frame for the next iteration                       */
-    u16LocPosTimeStampNm1 = u16FrameTimestamp;
+    ptrState->u64TimestampNm1 = u64FrameTimestamp;
 
     return bLocTimeOutStatus;
 }
 
 /**********************************************************************************************************************/
 /*                                                                                                                    */
-/* !FuncName    : LogDecoder_bVelTimeOutStatus                                                                        */
-/* !Description : Check the timeout status for the current Velocity frame is OK or NOK                                */
+/* !FuncName    : LogDecoder_u64Unwrap16                                                                              */
+/* !Description : Extend a 16-bit counter of the source (FrameNb or Timestamp) to 64 bits. The counter is assumed     */
+/*                to move forward by less than 65536 between two frames of the same ID, every wrap from 65535 to      */
+/*                0 then adds 65536 to the extended value.                                                            */
 /*                                                                                                                    */
-/* !Inputs      : u16FrameTimestamp             !Comment : Timestamp when the frame was received in (ms)              */
-/*                                              !Range   : [0, 65535]                                                 */
-/* !Outputs     : bLocTimeOutStatus             !Comment : Return the TimeoutStatus for the given timestamp           */
-/*                                              !Range   : STATUS_OK,                                                 */
-/*                                                         STATUS_NOK                                                 */
-/* !Number      : 4                                                                                                   */
+/* !Inputs      : u64Previous                   !Comment : Extended value of the previous frame of the ID             */
+/*                u64Counter                    !Comment : Counter of the current frame, only its 16 bits are used    */
+/*                bFirstReading                 !Comment : TRUE if it is the first frame of the ID                    */
+/* !Outputs     : u64LocExtended                !Comment : Extended value of the current frame                        */
+/*                                              !Range   : [0, 2^64 - 1]                                              */
+/* !Number      : 3                                                                                                   */
 /*                                                                                                                    */
 /**********************************************************************************************************************/
-static boolean LogDecoder_bVelTimeOutStatus(uint16 u16FrameTimestamp)
+static uint64 LogDecoder_u64Unwrap16(uint64 u64Previous, uint64 u64Counter, boolean bFirstReading)
 {
-    static uint16 u16LocVelTimeStampNm1 = FALSE;
-    static boolean bLocVelFirstReading = TRUE;
-           boolean bLocTimeOutStatus = STATUS_NOK;
+    uint64 u64LocExtended = u64Counter & MASK_16BITS;
 
-    /* Check if it's the first frame recieved                                                    */
-    if(bLocVelFirstReading == TRUE)
-    {
-        /* Clear the first frame recieved flag and reset the return OK                           */
-        bLocTimeOutStatus = STATUS_OK;
-        bLocVelFirstReading = FALSE;
-    }
-    else
+    if(bFirstReading == FALSE)
     {
-        /* Check if the timestamp is equal to the cycle time +/- range (50 +/- 3 ms)              */
-        if(  ((u16FrameTimestamp - u16LocVelTimeStampNm1) > (VEL_TIMESTAMP_PERIODICITY + VEL_TIMESTAMP_MARGIN))
-          || ((u16FrameTimestamp - u16LocVelTimeStampNm1) < (VEL_TIMESTAMP_PERIODICITY - VEL_TIMESTAMP_MARGIN)) )
-        {
-            bLocTimeOutStatus = STATUS_NOK;
-        }
-        else
-        {
-            bLocTimeOutStatus = STATUS_OK;
-        }
+        /* Forward distance modulo 2^16 from the previous counter, added to the previous value    */
+        u64LocExtended = u64Previous + ((u64Counter - u64Previous) & MASK_16BITS);
     }
-    /* Set prevoius frame equal to the current frame for the next iteration                       */
-    u16LocVelTimeStampNm1 = u16FrameTimestamp;
 
-    return bLocTimeOutStatus;
+    return u64LocExtended;
 }
 
 /**********************************************************************************************************************/
@@ -238,7 +252,7 @@ static boolean LogDecoder_bVelTimeOutStatus(uint16 u16FrameTimestamp)
 /* !Outputs     : bLocChecksumstatus            !Comment : Retun the status of the checksum                           */
 /*                                              !Range   : STATUS_OK,                                                 */
 /*                                                         STATUS_NOK                                                 */
-/* !Number      : 5                                                                                                   */
+/* !Number      : 4                                                                                                   */
 /*                                                                                                                    */
 /**********************************************************************************************************************/
 static boolean LogDecoder_u8ChecksumStatus(uint32 u32PayloadValue, uint8 u8Checksum)
@@ -271,73 +285,178 @@ static boolean LogDecoder_u8ChecksumStatus(uint32 u32PayloadValue, uint8 u8Check
 
 /**********************************************************************************************************************/
 /*                                                                                                                    */
-/* !FuncName    : LogDecoder_strPosFrameDecode                                                                        */
-/* !Description : Transfer the Position raw value to physical value (m)                                               */
+/* !FuncName    : LogDecoder_vidSignalsDecode                                                                         */
+/* !Description : Transfer the raw signals of the payload to physical values, as described by the frame               */
+/*                definition : physical = (raw + offset) / divisor                                                    */
 /*                                                                                                                    */
-/* !Inputs      : u32PayloadValue               !Comment : Hex coded data in big endian format                        */
-/*                                              !Range   : [0x0000, 0xFFFF]                                           */
-/* !Outputs     : strLocDecodedData             !Comment : Retun the status of the checksum                           */
-/*                                              !Range   : f32PosX -> [0.000000, 655.349976]                          */
-/*                                                         f32PosY -> [-32.766998, 32.768002]                         */
-/*                                                         f32VelX -> 0.000000                                        */
-/*                                                         f32VelY -> 0.000000                                        */
+/* !Inputs      : ptrFrameDef                   !Comment : Definition of the frame ID (signals layout)                */
+/*                u32PayloadValue               !Comment : Hex coded data in big endian format                        */
+/*                                              !Range   : [0x00000000, 0xFFFFFFFF]                                   */
+/* !Outputs     : ptrDecodedData                !Comment : Decoded signals, in their output columns                   */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidSignalsDecode(const LogDecoder_strFrameDefType *ptrFrameDef, uint32 u32PayloadValue,
+                                        strDecodedDataType *ptrDecodedData)
+{
+    const LogDecoder_strSignalDefType *ptrLocSignal = NULL;
+    uint32 u32LocRawValue = FALSE;
+    sint64 s64LocRawValue = FALSE;
+    uint8 u8LocIndex = FALSE;
+
+    for(u8LocIndex = 0U; u8LocIndex < ptrFrameDef->u8SignalsNb; u8LocIndex++)
+    {
+        ptrLocSignal = &ptrFrameDef->astrSignal[u8LocIndex];
+
+        /* Take the signal bits, the sign is extended without branch ((x ^ s) - s)                */
+        u32LocRawValue = ((u32PayloadValue >> ptrLocSignal->u8BitOffset) & ptrLocSignal->u32Mask);
+        s64LocRawValue = (sint64)(u32LocRawValue ^ ptrLocSignal->u32SignBit) - (sint64)ptrLocSignal->u32SignBit;
+
+        /* Fixed-point value, exact : the divisor divides DECODED_VALUE_SCALE                     */
+        ptrDecodedData->as32Value[ptrLocSignal->u8Column] =
+            (sint32)((s64LocRawValue + ptrLocSignal->s32Offset) * ptrLocSignal->s32Scale);
+    }
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidInit                                                                                  */
+/* !Description : Initialize a decoder context with the built-in frame definitions, must be called once before        */
+/*                the context is used. Each context holds the complete decoding state of one log, so that             */
+/*                several logs can be decoded at the same time (one context per log, no shared state).                */
+/*                                                                                                                    */
+/* !Inputs      : ptrContext                    !Comment : Decoder context to be initialized                          */
 /* !Number      : 6                                                                                                   */
 /*                                                                                                                    */
 /**********************************************************************************************************************/
-static strDecodedDataType LogDecoder_strPosFrameDecode(uint32 u32PayloadValue)
+void LogDecoder_vidInit(LogDecoder_strContextType *ptrContext)
 {
-    strDecodedDataType strLocDecodedData = {FALSE};
-    uint32 u32LocPosPhyValue = FALSE;
-    /*Set the Velocity to zero                                                                    */
-    strLocDecodedData.f32VelX = FALSE;
-    strLocDecodedData.f32VelY = FALSE;
-
-    /*Take the first 2Bytes and divide it by 100 to have PositionX  in (m)                        */
-    u32LocPosPhyValue = (u32PayloadValue >> SHIFT_16BITS);
-    strLocDecodedData.f32PosX = (((float32)u32LocPosPhyValue)/100U);
-
-    u32LocPosPhyValue = FALSE;
-    /*Take the Last 2Bytes and divide it by 1000 to have PositionY  in (m)                        */
-    u32LocPosPhyValue = (u32PayloadValue & 0x0000FFFFU);
-    strLocDecodedData.f32PosY = (((float32)u32LocPosPhyValue - MAX_POSITIVE_SIGNED_16BITS)/1000U);
-
-    return strLocDecodedData;
+    memset(ptrContext, 0, sizeof(*ptrContext));
+    ptrContext->ptrRegistry = &DEFAULT_REGISTRY;
+    LogDecoder_vidReset(ptrContext);
 }
 
 /**********************************************************************************************************************/
 /*                                                                                                                    */
-/* !FuncName    : LogDecoder_strVelFrameDecode                                                                        */
-/* !Description : Transfer the Velocity raw value to physical value (m/s)                                             */
+/* !FuncName    : LogDecoder_vidReset                                                                                 */
+/* !Description : Set the tracking state of every frame ID to "no frame received yet", to decode a new log            */
+/*                with an already initialized context. The frame definitions are kept.                                */
 /*                                                                                                                    */
-/* !Inputs      : u32PayloadValue               !Comment : Hex coded data in big endian format                        */
-/*                                              !Range   : [0x0000, 0xFFFF]                                           */
-/* !Outputs     : strLocDecodedData             !Comment : Retun the status of the checksum                           */
-/*                                              !Range   : f32PosX -> 0.000000                                        */
-/*                                                         f32PosY -> 0.000000                                        */
-/*                                                         f32VelX -> [-32.766998, 32.768002]                         */
-/*                                                         f32VelY -> [-32.766998, 32.768002]                         */
+/* !Inputs      : ptrContext                    !Comment : Decoder context to be reset                                */
 /* !Number      : 7                                                                                                   */
 /*                                                                                                                    */
 /**********************************************************************************************************************/
-static strDecodedDataType LogDecoder_strVelFrameDecode(uint32 u32PayloadValue)
+void LogDecoder_vidReset(LogDecoder_strContextType *ptrContext)
 {
-    strDecodedDataType strLocDecodedData = {FALSE};
-    uint32 u32LocVelPhyValue = FALSE;
+    uint32 u32LocIndex = FALSE;
 
-    /*Set the Position to zero                                                                    */
-    strLocDecodedData.f32PosX = FALSE;
-    strLocDecodedData.f32PosY = FALSE;
+    memset(ptrContext->astrFrameState, 0, sizeof(ptrContext->astrFrameState));
+    for(u32LocIndex = 0U; u32LocIndex < FRAME_IDS_NUMBER; u32LocIndex++)
+    {
+        ptrContext->astrFrameState[u32LocIndex].bFirstReading = TRUE;
+    }
+    ptrContext->u32InvalidFramesNb = FALSE;
+}
 
-    /*Take the first 2Bytes and divide it by 1000 to have VelocityX  in (m/s)                     */
-    u32LocVelPhyValue = (u32PayloadValue >> SHIFT_16BITS);
-    strLocDecodedData.f32VelX = (((float32)u32LocVelPhyValue - MAX_POSITIVE_SIGNED_16BITS)/1000U);
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSetRegistry                                                                           */
+/* !Description : Decode the next frames with the given frame definitions. The registry is only read by the           */
+/*                decoder, the same registry can be shared by several contexts.                                       */
+/*                                                                                                                    */
+/* !Inputs      : ptrContext                    !Comment : Decoder context                                            */
+/*                ptrRegistry                   !Comment : Frame definitions, must outlive the context                */
+/* !Number      : 8                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidSetRegistry(LogDecoder_strContextType *ptrContext, const LogDecoder_strRegistryType *ptrRegistry)
+{
+    ptrContext->ptrRegistry = ptrRegistry;
+}
 
-    u32LocVelPhyValue = FALSE;
-    /*Take the Last 2Bytes and divide it by 1000 to have VelocityY  in (m)                        */
-    u32LocVelPhyValue = (u32PayloadValue & 0x0000FFFFU);
-    strLocDecodedData.f32VelY = (((float32)u32LocVelPhyValue - MAX_POSITIVE_SIGNED_16BITS)/1000U);
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSetWrap16                                                                             */
+/* !Description : Select how the FrameNb and Timestamp fields are read. By default they are 64-bit values and are     */
+/*                used as they are. For a source with 16-bit counters, every wrap is detected and the decoded         */
+/*                rows hold the extended 64-bit values, so that the drop count and the timeout stay right.            */
+/*                                                                                                                    */
+/* !Inputs      : ptrContext                    !Comment : Decoder context                                            */
+/*                bWrap16                       !Comment : TRUE for a source with 16-bit counters                     */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 9                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidSetWrap16(LogDecoder_strContextType *ptrContext, boolean bWrap16)
+{
+    ptrContext->bWrap16 = bWrap16;
+}
 
-    return strLocDecodedData;
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrDefaultRegistry                                                                       */
+/* !Description : Get the built-in frame definitions (Position and Velocity frames)                                   */
+/*                                                                                                                    */
+/* !Outputs     : ptrRegistry                   !Comment : Built-in frame definitions                                 */
+/* !Number      : 10                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+const LogDecoder_strRegistryType *LogDecoder_ptrDefaultRegistry(void)
+{
+    return &DEFAULT_REGISTRY;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSignalCompile                                                                         */
+/* !Description : Compute the decode op of a signal (mask and sign bit) from its bit width and sign, to be called     */
+/*                once for every signal of a registry built at run time                                               */
+/*                                                                                                                    */
+/* !Inputs      : ptrSignal                     !Comment : Signal definition, u8BitWidth in [1, 32] and               */
+/*                                                         u16Divisor dividing DECODED_VALUE_SCALE                    */
+/* !Outputs     : ptrSignal                     !Comment : Signal definition with its decode op                       */
+/* !Number      : 11                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidSignalCompile(LogDecoder_strSignalDefType *ptrSignal)
+{
+    if(ptrSignal->u8BitWidth < PAYLOAD_BITS_NUMBER)
+    {
+        ptrSignal->u32Mask = (uint32)((1UL << ptrSignal->u8BitWidth) - 1UL);
+    }
+    else
+    {
+        ptrSignal->u32Mask = (uint32)0xFFFFFFFFUL;
+    }
+    ptrSignal->u32SignBit = (ptrSignal->bSigned == TRUE) ? (uint32)(1UL << (ptrSignal->u8BitWidth - 1U)) : 0U;
+    ptrSignal->s32Scale   = DECODED_VALUE_SCALE / (sint32)ptrSignal->u16Divisor;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrFrameState                                                                            */
+/* !Description : Get the tracking state of the given frame ID                                                        */
+/*                                                                                                                    */
+/* !Inputs      : ptrContext                    !Comment : Decoder context                                            */
+/*                u8FrameId                     !Comment : Frame category ID                                          */
+/*                                              !Range   : [0, 255]                                                   */
+/* !Outputs     : ptrLocFrameState              !Comment : State of the ID, NULL if the ID is not defined             */
+/* !Number      : 12                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+LogDecoder_strFrameStateType *LogDecoder_ptrFrameState(LogDecoder_strContextType *ptrContext, uint8 u8FrameId)
+{
+    LogDecoder_strFrameStateType *ptrLocFrameState = NULL;
+
+    if(ptrContext->ptrRegistry->astrFrame[u8FrameId].bDefined == TRUE)
+    {
+        ptrLocFrameState = &ptrContext->astrFrameState[u8FrameId];
+    }
+
+    return ptrLocFrameState;
 }
 
 /**********************************************************************************************************************/
@@ -345,170 +464,252 @@ static strDecodedDataType LogDecoder_strVelFrameDecode(uint32 u32PayloadValue)
 /* !FuncName    : LogDecoder_strDecodeFrameContent                                                                    */
 /* !Description : Decode the input frame content to the required output                                               */
 /*                                                                                                                    */
-/* !Inputs      : strInputData                  !Comment : Input frame content                                        */
+/* !Inputs      : ptrContext                    !Comment : Decoder context                                            */
+/*                strInputData                  !Comment : Input frame content                                        */
 /*                                              !Range   : u32Payload,                                                */
-/*                                                         u16FrameNb,                                                */
-/*                                                         u16Timestamp,                                              */
+/*                                                         u64FrameNb,                                                */
+/*                                                         u64Timestamp,                                              */
 /*                                                         u8Id,                                                      */
 /*                                                         u8Checksum                                                 */
-/* !Outputs     : strLocDecodedData             !Comment : Retun the status of the checksum                           */
+/* !Outputs     : strLocOutputData              !Comment : Decoded frame                                              */
 /*                                              !Range   : strDecodedData,                                            */
-/*                                                         u16FrameDropCnt,                                           */
-/*                                                         u16FrameNb,                                                */
-/*                                                         u16Timestamp,                                              */
+/*                                                         u64FrameDropCnt,                                           */
+/*                                                         u64FrameNb,                                                */
+/*                                                         u64Timestamp,                                              */
 /*                                                         bChecksumOK,                                               */
 /*                                                         bTimeoutOK,                                                */
 /*                                                         u8Id                                                       */
-/* !Number      : 8                                                                                                   */
+/* !Number      : 13                                                                                                  */
 /*                                                                                                                    */
 /**********************************************************************************************************************/
-static LogDecoder_strOutputDataType LogDecoder_strDecodeFrameContent(LogDecoder_strInputDataType strInputData)
+LogDecoder_strOutputDataType LogDecoder_strDecodeFrameContent(LogDecoder_strContextType *ptrContext,
+                                                              LogDecoder_strInputDataType strInputData)
 {
     LogDecoder_strOutputDataType strLocOutputData = {0};
-    uint16 u16_localPositionX =FALSE;
-    uint16 u16_localPositionY =FALSE;
+    /* Direct lookup of the frame definition and of the tracking state of the ID                  */
+    const LogDecoder_strFrameDefType *ptrLocFrameDef = &ptrContext->ptrRegistry->astrFrame[strInputData.u8Id];
+    LogDecoder_strFrameStateType *ptrLocFrameState = &ptrContext->astrFrameState[strInputData.u8Id];
 
     /*Copy ID,FrameNb and Timestamp  to the output*/
     strLocOutputData.u8Id = strInputData.u8Id;
-    strLocOutputData.u16FrameNb = strInputData.u16FrameNb;
-    strLocOutputData.u16Timestamp = strInputData.u16Timestamp;
+    strLocOutputData.u64FrameNb = strInputData.u64FrameNb;
+    strLocOutputData.u64Timestamp = strInputData.u64Timestamp;
 
-    switch(strInputData.u8Id)
+    if(ptrLocFrameDef->bDefined == TRUE)
+    {
+        if(ptrContext->bWrap16 == TRUE)
+        {
+            /* 16-bit counters of the source, the row holds their extended values                 */
+            strLocOutputData.u64FrameNb   = LogDecoder_u64Unwrap16(ptrLocFrameState->u64FrameNbNm1,
+                                                                   strInputData.u64FrameNb,
+                                                                   ptrLocFrameState->bFirstReading);
+            strLocOutputData.u64Timestamp = LogDecoder_u64Unwrap16(ptrLocFrameState->u64TimestampNm1,
+                                                                   strInputData.u64Timestamp,
+                                                                   ptrLocFrameState->bFirstReading);
+        }
+        strLocOutputData.u64FrameDropCnt = LogDecoder_u64CalcFrameDropCnt(ptrLocFrameState,
+                                                                          strLocOutputData.u64FrameNb);
+        strLocOutputData.bTimeoutOK      = LogDecoder_bTimeOutStatus(ptrLocFrameDef, ptrLocFrameState,
+                                                                     strLocOutputData.u64Timestamp);
+        ptrLocFrameState->bFirstReading  = FALSE;
+        strLocOutputData.bChecksumOK     = LogDecoder_u8ChecksumStatus(strInputData.u32Payload,
+                                                                       strInputData.u8Checksum);
+        LogDecoder_vidSignalsDecode(ptrLocFrameDef, strInputData.u32Payload, &strLocOutputData.strDecodedData);
+    }
+    else
     {
-        case FRAME_ID_POSITION:
-            /* Call the Position internal functions */
-            strLocOutputData.u16FrameDropCnt = LogDecoder_u8PosCalcFrameDropCnt(strInputData.u16FrameNb);
-            strLocOutputData.bTimeoutOK      = LogDecoder_bPosTimeOutStatus(strInputData.u16Timestamp);
-            strLocOutputData.bChecksumOK     = LogDecoder_u8ChecksumStatus(strInputData.u32Payload, strInputData.u8Checksum);
-            strLocOutputData.strDecodedData  = LogDecoder_strPosFrameDecode(strInputData.u32Payload);
-            break;
-
-        case FRAME_ID_VELOCITY:
-            /* Call the Velocity internal functions */
-            strLocOutputData.u16FrameDropCnt = LogDecoder_u8VelCalcFrameDropCnt(strInputData.u16FrameNb);
-            strLocOutputData.bTimeoutOK      = LogDecoder_bVelTimeOutStatus(strInputData.u16Timestamp);
-            strLocOutputData.bChecksumOK     = LogDecoder_u8ChecksumStatus(strInputData.u32Payload, strInputData.u8Checksum);
-            strLocOutputData.strDecodedData  = LogDecoder_strVelFrameDecode(strInputData.u32Payload);
-            break;
-
-        default:
-            /* If the frame ID not equal to Position or Velocity, print Warning message*/
-            printf("Invalid Frame ID");
-            break;
+        /* Invalid frame ID, the row is kept empty and the frame is counted for the caller        */
+        ptrContext->u32InvalidFramesNb++;
     }
 
     return strLocOutputData;
 }
 
-/**********************************************************************************************************************/
-/* GLOBAL FUNCTIONS                                                                                                   */
-/**********************************************************************************************************************/
 /**********************************************************************************************************************/
 /*                                                                                                                    */
-/* !FuncName    : LogDecoder_vidMainFunction                                                                          */
-/* !Description : Read Inputs from .csv file and call internal functions and write the .csv output file               */
+/* !FuncName    : LogDecoder_vidBatchValidate                                                                         */
+/* !Description : Validate stage of a batch : checksum of all the frames at once, then the ordered tracking           */
+/*                pass (16-bit counters extension, drop counter and timeout), since the state of an ID depends on     */
+/*                its previous frame.                                                                                 */
+/*                The rows of an invalid frame ID get all their flags cleared and are counted.                        */
 /*                                                                                                                    */
-/* !Inputs      : s32NumOfArg                   !Comment : Number of main arguments                                   */
-/*                                              !Range   :                                                            */
-/*                ptrMainArgs                   !Comment : main function given arguments                              */
-/*                                              !Range   :                                                            */
-/* !Number      : 7                                                                                                   */
+/* !Inputs      : ptrContext                    !Comment : Decoder context                                            */
+/*                ptrBatch                      !Comment : Batch with its input columns filled                        */
+/* !Outputs     : ptrBatch                      !Comment : ChecksumOK, TimeoutOK and FrameDropCnt columns,            */
+/*                                                         extended FrameNb and Timestamp with bWrap16                */
+/* !Number      : 14                                                                                                  */
 /*                                                                                                                    */
 /**********************************************************************************************************************/
-void LogDecoder_vidMainFunction(int s32NumOfArg, char **ptrMainArgs)
+void LogDecoder_vidBatchValidate(LogDecoder_strContextType *ptrContext, LogDecoder_strBatchType *ptrBatch)
 {
-    /* Open the Input .csv file with read access                                                  */
-    FILE   *LocInputFile = fopen(ptrMainArgs[INPUT_ARGUMENT_NUMBER],"r");
-    /* Open the Input .csv file with write access                                                 */
-    FILE   *LocOutputFile = fopen(ptrMainArgs[OUTPUT_ARGUMENT_NUMBER],"w");
-
-    uint32 u32Id = FALSE;
-    uint32 u32FrameNb = FALSE;
-    uint32 u32Timestamp = FALSE;
-    uint32 u32Payload = FALSE;
-    uint32 u32Checksum = FALSE;
+    const LogDecoder_strFrameDefType *ptrLocFrameDef = NULL;
+    LogDecoder_strFrameStateType *ptrLocFrameState = NULL;
+    uint32 u32LocIndex = FALSE;
 
-    uint8 sLocFirstRow[MAX_CHAR_NUM_PER_LINE] = {FALSE};
+    LogDecoder_vidKernelChecksum(ptrBatch->ptrPayload, ptrBatch->ptrChecksum, ptrBatch->ptrChecksumOK,
+                                 ptrBatch->u32FramesNb);
 
-    LogDecoder_strInputDataType strLocInputData = {FALSE};
-    LogDecoder_strOutputDataType strLocOutputData = {FALSE};
-
-    uint8 u8LocElementsNumPerRow = FALSE;
-    uint16 u16RowNumber = FALSE;
+    for(u32LocIndex = 0U; u32LocIndex < ptrBatch->u32FramesNb; u32LocIndex++)
+    {
+        ptrLocFrameDef = &ptrContext->ptrRegistry->astrFrame[ptrBatch->ptrId[u32LocIndex]];
+        if(ptrLocFrameDef->bDefined == TRUE)
+        {
+            ptrLocFrameState = &ptrContext->astrFrameState[ptrBatch->ptrId[u32LocIndex]];
+            if(ptrContext->bWrap16 == TRUE)
+            {
+                ptrBatch->ptrFrameNb[u32LocIndex]   = LogDecoder_u64Unwrap16(ptrLocFrameState->u64FrameNbNm1,
+                                                                             ptrBatch->ptrFrameNb[u32LocIndex],
+                                                                             ptrLocFrameState->bFirstReading);
+                ptrBatch->ptrTimestamp[u32LocIndex] = LogDecoder_u64Unwrap16(ptrLocFrameState->u64TimestampNm1,
+                                                                             ptrBatch->ptrTimestamp[u32LocIndex],
+                                                                             ptrLocFrameState->bFirstReading);
+            }
+            ptrBatch->ptrFrameDropCnt[u32LocIndex] = LogDecoder_u64CalcFrameDropCnt(ptrLocFrameState,
+                                                                                    ptrBatch->ptrFrameNb[u32LocIndex]);
+            ptrBatch->ptrTimeoutOK[u32LocIndex]    = LogDecoder_bTimeOutStatus(ptrLocFrameDef, ptrLocFrameState,
+                                                                               ptrBatch->ptrTimestamp[u32LocIndex]);
+            ptrLocFrameState->bFirstReading = FALSE;
+        }
+        else
+        {
+            ptrBatch->ptrFrameDropCnt[u32LocIndex] = FALSE;
+            ptrBatch->ptrTimeoutOK[u32LocIndex]    = FALSE;
+            ptrBatch->ptrChecksumOK[u32LocIndex]   = FALSE;
+            ptrContext->u32InvalidFramesNb++;
+        }
+    }
+}
 
-    /* Check if the number of arguments is equal to the expected number                           */
-    if (s32NumOfArg != ARGUMENTS_NUMBER)
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBatchDecode                                                                           */
+/* !Description : Decode stage of a batch. The frames are taken by tiles and sorted by frame ID (counting sort,       */
+/*                stable), so that every signal is decoded by the batch kernel over all the frames of its ID in       */
+/*                the tile. Decoded values do not depend on the tracking state, the stage can run on any batch.       */
+/*                                                                                                                    */
+/* !Inputs      : ptrContext                    !Comment : Decoder context (frame definitions only)                   */
+/*                ptrBatch                      !Comment : Batch with its input columns filled                        */
+/* !Outputs     : ptrBatch                      !Comment : Decoded value columns, 0 for a column without              */
+/*                                                         signal and for the rows of an invalid frame ID             */
+/* !Number      : 15                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidBatchDecode(const LogDecoder_strContextType *ptrContext, LogDecoder_strBatchType *ptrBatch)
+{
+    uint32p au32LocSortedPayload[KERNEL_TILE_FRAMES_NUMBER];
+    uint16 au16LocSortedRow[KERNEL_TILE_FRAMES_NUMBER];
+    sint32p as32LocValue[KERNEL_TILE_FRAMES_NUMBER];
+    uint32 au32LocIdStart[FRAME_IDS_NUMBER + 1U];
+    const LogDecoder_strFrameDefType *ptrLocFrameDef = NULL;
+    const LogDecoder_strSignalDefType *ptrLocSignal = NULL;
+    sint32p *ptrLocColumn = NULL;
+    uint32 u32LocTileStart = FALSE;
+    uint32 u32LocTileSize = FALSE;
+    uint32 u32LocIndex = FALSE;
+    uint32 u32LocId = FALSE;
+    uint32 u32LocSignal = FALSE;
+    uint32 u32LocGroupStart = FALSE;
+    uint32 u32LocGroupSize = FALSE;
+
+    for(u32LocIndex = 0U; u32LocIndex < DECODED_COLUMNS_NUMBER; u32LocIndex++)
     {
-        printf("Help Info:\n"
-            "\t- The first command shall be .exe file (for example: log_decoder.exe)\n"
-            "\t- The second command shall be .csv input file (for example: input_log.csv)\n"
-            "\t- The third command shall be .csv input file (for example: output_log.csv)\n"
-            "\t- All comands shall be delimited by whitespace (for example: log_decoder.exe input_log.csv output_log.csv)");
+        memset(ptrBatch->aptrValue[u32LocIndex], 0, ptrBatch->u32FramesNb * sizeof(sint32p));
     }
-    else
+
+    for(u32LocTileStart = 0U; u32LocTileStart < ptrBatch->u32FramesNb; u32LocTileStart += u32LocTileSize)
     {
-        /* Scan and check the first row format is the same expected format                        */
-        fscanf(LocInputFile,"%s",sLocFirstRow);
-        if(strcmp(sLocFirstRow, HEADER_FOR_INPUT_FILE) == STRING_COMPARE_OK)
+        u32LocTileSize = ptrBatch->u32FramesNb - u32LocTileStart;
+        if(u32LocTileSize > KERNEL_TILE_FRAMES_NUMBER)
+        {
+            u32LocTileSize = KERNEL_TILE_FRAMES_NUMBER;
+        }
+
+        /* Counting sort of the defined frames by ID : count (shifted by one), prefix sum         */
+        memset(au32LocIdStart, 0, sizeof(au32LocIdStart));
+        for(u32LocIndex = u32LocTileStart; u32LocIndex < (u32LocTileStart + u32LocTileSize); u32LocIndex++)
+        {
+            au32LocIdStart[ptrBatch->ptrId[u32LocIndex] + 1U]++;
+        }
+        for(u32LocId = 0U; u32LocId < FRAME_IDS_NUMBER; u32LocId++)
         {
-            fprintf(LocOutputFile, HEADER_FOR_OUTPUT_FILE);
+            au32LocIdStart[u32LocId + 1U] += au32LocIdStart[u32LocId];
+        }
+        for(u32LocIndex = 0U; u32LocIndex < u32LocTileSize; u32LocIndex++)
+        {
+            u32LocGroupStart = au32LocIdStart[ptrBatch->ptrId[u32LocTileStart + u32LocIndex]]++;
+            au16LocSortedRow[u32LocGroupStart]     = (uint16)u32LocIndex;
+            au32LocSortedPayload[u32LocGroupStart] = ptrBatch->ptrPayload[u32LocTileStart + u32LocIndex];
+        }
 
-            while (!feof(LocInputFile))
+        /* After the fill, each entry is the end of its ID group, i.e. the start of the next      */
+        u32LocGroupStart = 0U;
+        for(u32LocId = 0U; u32LocId < FRAME_IDS_NUMBER; u32LocId++)
+        {
+            u32LocGroupSize = au32LocIdStart[u32LocId] - u32LocGroupStart;
+            ptrLocFrameDef  = &ptrContext->ptrRegistry->astrFrame[u32LocId];
+
+            for(u32LocSignal = 0U; (u32LocGroupSize != 0U) && (u32LocSignal < ptrLocFrameDef->u8SignalsNb);
+                u32LocSignal++)
             {
-                u8LocElementsNumPerRow = fscanf(LocInputFile, "%u,%u,%u,%x,%x\n", &u32Id,
-                                                                                  &u32FrameNb,
-                                                                                  &u32Timestamp,
-                                                                                  &u32Payload,
-                                                                                  &u32Checksum);
-
-                strLocInputData.u8Id         = (uint8)u32Id;
-                strLocInputData.u16FrameNb   = (uint16)u32FrameNb;
-                strLocInputData.u16Timestamp = (uint16)u32Timestamp;
-                strLocInputData.u32Payload   = u32Payload;
-                strLocInputData.u8Checksum   = (uint8)u32Checksum;
-
-                /* Check if the number of elements per raw is equal to the expected number        */
-                if (u8LocElementsNumPerRow == ELEMENTS_NUM_PER_ROW)
+                ptrLocSignal = &ptrLocFrameDef->astrSignal[u32LocSignal];
+                LogDecoder_vidKernelSignal(&au32LocSortedPayload[u32LocGroupStart], u32LocGroupSize,
+                                           ptrLocSignal, as32LocValue);
+                /* Scatter back to the rows of the tile, in the output column of the signal       */
+                ptrLocColumn = &ptrBatch->aptrValue[ptrLocSignal->u8Column][u32LocTileStart];
+                for(u32LocIndex = 0U; u32LocIndex < u32LocGroupSize; u32LocIndex++)
                 {
-                    strLocOutputData = LogDecoder_strDecodeFrameContent(strLocInputData);
-                    fprintf(LocOutputFile,"%d, %d, %d, %.2f, %.3f, %.3f, %.3f, %d, %d, %d\n", strLocOutputData.u8Id, 
-                                                                                              strLocOutputData.u16FrameNb,
-                                                                                              strLocOutputData.u16Timestamp,
-                                                                                              strLocOutputData.strDecodedData.f32PosX,
-                                                                                              strLocOutputData.strDecodedData.f32PosY,
-                                                                                              strLocOutputData.strDecodedData.f32VelX,
-                                                                                              strLocOutputData.strDecodedData.f32VelY,
-                                                                                              strLocOutputData.bChecksumOK,
-                                                                                              strLocOutputData.bTimeoutOK,
-                                                                                              strLocOutputData.u16FrameDropCnt);
-                    u16RowNumber++;
-                }
-                else
-                {
-                    printf("Missing data in row number %d", (u16RowNumber + 2));
-                    break;
+                    ptrLocColumn[au16LocSortedRow[u32LocGroupStart + u32LocIndex]] = as32LocValue[u32LocIndex];
                 }
             }
+            u32LocGroupStart = au32LocIdStart[u32LocId];
         }
-        else
-        {
-            printf("First row must be in the following format :\n"
-                "ID,FrameNb,Timestamp,Payload,Checksum");
-        }
-
-        /* Close input and output Files */
-        fclose(LocInputFile);
-        fclose(LocOutputFile);
     }
 }
 
 /**********************************************************************************************************************/
-/* APPLICATION MAIN FUNCTION                                                                                          */
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_f32DecodedValue                                                                          */
+/* !Description : Get a decoded value in its physical unit as a float, for the consumers which need one. The          */
+/*                decoding itself only works on fixed-point integers.                                                 */
+/*                                                                                                                    */
+/* !Inputs      : ptrDecodedData                !Comment : Decoded signals                                            */
+/*                u8Column                      !Comment : Output column (DECODED_xxx)                                */
+/* !Outputs     : f32LocValue                   !Comment : Physical value (m, m/s)                                    */
+/* !Number      : 16                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+float32 LogDecoder_f32DecodedValue(const strDecodedDataType *ptrDecodedData, uint8 u8Column)
+{
+    return ((float32)ptrDecodedData->as32Value[u8Column] / (float32)DECODED_VALUE_SCALE);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32FormatRow                                                                             */
+/* !Description : Format one decoded frame as an output .csv row with snprintf, reference of the writer formatting    */
+/*                                                                                                                    */
+/* !Inputs      : ptrOutputData                 !Comment : Decoded frame                                              */
+/*                u32BufferSize                 !Comment : Size of ptrBuffer, at least OUTPUT_ROW_MAX_LENGTH          */
+/* !Outputs     : ptrBuffer                     !Comment : Formatted row, including the line break                    */
+/*                u32LocLength                  !Comment : Number of characters written to ptrBuffer                  */
+/* !Number      : 17                                                                                                  */
+/*                                                                                                                    */
 /**********************************************************************************************************************/
-int main(int argc, char **argv)
+uint32 LogDecoder_u32FormatRow(char *ptrBuffer, size_t u32BufferSize, const LogDecoder_strOutputDataType *ptrOutputData)
 {
-    LogDecoder_vidMainFunction(argc, argv);
-    return 0;
+    int s32LocLength = snprintf(ptrBuffer, u32BufferSize, "%d, %llu, %llu, %.2f, %.3f, %.3f, %.3f, %d, %d, %llu\n",
+                                ptrOutputData->u8Id,
+                                ptrOutputData->u64FrameNb,
+                                ptrOutputData->u64Timestamp,
+                                LogDecoder_f32DecodedValue(&ptrOutputData->strDecodedData, DECODED_POSITION_X),
+                                LogDecoder_f32DecodedValue(&ptrOutputData->strDecodedData, DECODED_POSITION_Y),
+                                LogDecoder_f32DecodedValue(&ptrOutputData->strDecodedData, DECODED_VELOCITY_X),
+                                LogDecoder_f32DecodedValue(&ptrOutputData->strDecodedData, DECODED_VELOCITY_Y),
+                                ptrOutputData->bChecksumOK,
+                                ptrOutputData->bTimeoutOK,
+                                ptrOutputData->u64FrameDropCnt);
+
+    return (s32LocLength > 0) ? (uint32)s32LocLength : 0U;
 }
 
 /*---------------------------------------------------- end of file ---------------------------------------------------*/
\ No newline at end of file
@@ -1,9 +1,9 @@
 /**********************************************************************************************************************/
 /*                                                                                                                    */
 /*  Application : Log Decoder                                                                                         */
-/*  Description : Log decoder is a simple console application, that takes a .csv format logfile as an input           */
-/*                and provides an output log file also in .csv format, with Payload decoded into meaningful           */
-/*                values and additional flags if certains checks are violated for a given frame.                      */
+/*  Description : Log decoder library. Decodes the frames of a log with an explicit decoder context, so that          */
+/*                several logs can be decoded concurrently in the same process. The console application is a          */
+/*                thin wrapper over this library (log_decoder_Cli.c).                                                 */
 /*                                                                                                                    */
 /*  File        : log_decoder.h                                                                                       */
 /*                                                                                                                    */
@@ -24,9 +24,6 @@
 /**********************************************************************************************************************/
 /* DEFINES                                                                                                            */
 /**********************************************************************************************************************/
-#define ARGUMENTS_NUMBER                3U
-#define INPUT_ARGUMENT_NUMBER           1U
-#define OUTPUT_ARGUMENT_NUMBER          2U
 #define FRAME_ID_POSITION               15U
 #define FRAME_ID_VELOCITY               78U
 #define POS_TIMESTAMP_PERIODICITY       25U
@@ -34,8 +31,17 @@
 #define VEL_TIMESTAMP_PERIODICITY       50U
 #define VEL_TIMESTAMP_MARGIN            3U
 #define ELEMENTS_NUM_PER_ROW            5U
-#define MAX_CHAR_NUM_PER_LINE           100U
 #define HEADER_FOR_INPUT_FILE           "ID,FrameNb,Timestamp,Payload,Checksum"
+#define FRAME_IDS_NUMBER                256U
+#define FRAME_SIGNALS_MAX_NUMBER        4U
+#define DECODED_POSITION_X              0U
+#define DECODED_POSITION_Y              1U
+#define DECODED_VELOCITY_X              2U
+#define DECODED_VELOCITY_Y              3U
+#define DECODED_COLUMNS_NUMBER          4U
+/* Decoded values are fixed-point integers in thousandths of the physical unit (mm, mm/s)                             */
+#define DECODED_VALUE_SCALE             1000L
+#define OUTPUT_ROW_MAX_LENGTH           256U
 #define HEADER_FOR_OUTPUT_FILE          "ID,FrameNb,Timestamp,PositionX,PositionY,VelocityX,VelocityY,ChecksumOK,TimestampOk,FrameDropCnt\n"
 
 /**********************************************************************************************************************/
@@ -44,36 +50,105 @@
 /*---------------------------------- Inputs ----------------------------------*/
 typedef struct
 {
+    uint64 u64FrameNb;
+    uint64 u64Timestamp;
     uint32 u32Payload;
-    uint16 u16FrameNb;
-    uint16 u16Timestamp;
     uint8  u8Id;
     uint8  u8Checksum;
 }LogDecoder_strInputDataType;
 /*---------------------------------- Outputs ---------------------------------*/
 typedef struct
 {
-    float32 f32PosX;
-    float32 f32PosY;
-    float32 f32VelX;
-    float32 f32VelY;
+    sint32 as32Value[DECODED_COLUMNS_NUMBER];
 }strDecodedDataType;
 typedef struct
 {
     strDecodedDataType strDecodedData;
-    uint16             u16FrameDropCnt;
-    uint16             u16FrameNb;
-    uint16             u16Timestamp;
+    uint64             u64FrameDropCnt;
+    uint64             u64FrameNb;
+    uint64             u64Timestamp;
     boolean            bChecksumOK;
     boolean            bTimeoutOK;
     uint8              u8Id;
 }LogDecoder_strOutputDataType;
+/*------------------------------ Columnar batch ------------------------------*/
+/* Frames of one batch stored column by column, each stage runs as one loop over its columns                          */
+typedef struct
+{
+    /* Input columns, filled by the parse stage                                                   */
+    uint8   *ptrId;
+    uint64  *ptrFrameNb;
+    uint64  *ptrTimestamp;
+    uint32p *ptrPayload;
+    uint8   *ptrChecksum;
+    uint16  *ptrSource;             /* Input log of the frame, only filled when several logs are merged      */
+    /* Output columns, filled by the validate stage (flags) and the decode stage (values)         */
+    sint32p *aptrValue[DECODED_COLUMNS_NUMBER];
+    uint64  *ptrFrameDropCnt;
+    boolean *ptrChecksumOK;
+    boolean *ptrTimeoutOK;
+    uint32   u32FramesNb;
+    uint32   u32Capacity;
+    void    *ptrMemory;             /* Single allocation holding all the columns                              */
+}LogDecoder_strBatchType;
+/*------------------------------ Frame registry ------------------------------*/
+typedef struct
+{
+    uint32  u32Mask;                /* Decode op : raw = (payload >> u8BitOffset) & u32Mask                   */
+    uint32  u32SignBit;             /* Decode op : sign bit of the raw value, 0 for an unsigned signal        */
+    sint32  s32Scale;               /* Decode op : DECODED_VALUE_SCALE / u16Divisor                           */
+    sint32  s32Offset;              /* Added to the raw value                                                 */
+    uint16  u16Divisor;             /* Physical value = (raw + s32Offset) / u16Divisor, divides the scale     */
+    uint8   u8BitOffset;            /* Position of the signal least significant bit in the payload            */
+    uint8   u8BitWidth;             /* Number of bits of the signal [1, 32]                                   */
+    uint8   u8Column;               /* Output column of the signal (DECODED_xxx)                              */
+    boolean bSigned;                /* TRUE if the raw value is two's complement                              */
+}LogDecoder_strSignalDefType;
+typedef struct
+{
+    LogDecoder_strSignalDefType astrSignal[FRAME_SIGNALS_MAX_NUMBER];
+    uint16  u16CycleTime;           /* Expected time between two frames of the ID (ms)                        */
+    uint16  u16CycleMargin;         /* Accepted deviation from the cycle time (ms)                            */
+    uint8   u8SignalsNb;
+    boolean bDefined;               /* FALSE for an invalid frame ID                                          */
+}LogDecoder_strFrameDefType;
+typedef struct
+{
+    LogDecoder_strFrameDefType astrFrame[FRAME_IDS_NUMBER];
+}LogDecoder_strRegistryType;
+/*------------------------------ Decoder context -----------------------------*/
+typedef struct
+{
+    uint64  u64FrameNbNm1;
+    uint64  u64TimestampNm1;
+    uint64  u64FrameDropCnt;
+    boolean bFirstReading;
+}LogDecoder_strFrameStateType;
+typedef struct
+{
+    const LogDecoder_strRegistryType *ptrRegistry;
+    LogDecoder_strFrameStateType      astrFrameState[FRAME_IDS_NUMBER];
+    uint32                            u32InvalidFramesNb;
+    boolean                           bWrap16;    /* FrameNb and Timestamp are 16-bit source counters        */
+}LogDecoder_strContextType;
 
 /**********************************************************************************************************************/
 /* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
 /**********************************************************************************************************************/
-void LogDecoder_vidMainFunction(int s32NumOfArg, char **ptrMainArgs);
-int main(int argc, char **argv);
+void LogDecoder_vidInit(LogDecoder_strContextType *ptrContext);
+void LogDecoder_vidReset(LogDecoder_strContextType *ptrContext);
+void LogDecoder_vidSetRegistry(LogDecoder_strContextType *ptrContext, const LogDecoder_strRegistryType *ptrRegistry);
+void LogDecoder_vidSetWrap16(LogDecoder_strContextType *ptrContext, boolean bWrap16);
+const LogDecoder_strRegistryType *LogDecoder_ptrDefaultRegistry(void);
+void LogDecoder_vidSignalCompile(LogDecoder_strSignalDefType *ptrSignal);
+LogDecoder_strFrameStateType *LogDecoder_ptrFrameState(LogDecoder_strContextType *ptrContext, uint8 u8FrameId);
+LogDecoder_strOutputDataType LogDecoder_strDecodeFrameContent(LogDecoder_strContextType *ptrContext,
+                                                              LogDecoder_strInputDataType strInputData);
+void LogDecoder_vidBatchValidate(LogDecoder_strContextType *ptrContext, LogDecoder_strBatchType *ptrBatch);
+void LogDecoder_vidBatchDecode(const LogDecoder_strContextType *ptrContext, LogDecoder_strBatchType *ptrBatch);
+float32 LogDecoder_f32DecodedValue(const strDecodedDataType *ptrDecodedData, uint8 u8Column);
+uint32 LogDecoder_u32FormatRow(char *ptrBuffer, size_t u32BufferSize,
+                               const LogDecoder_strOutputDataType *ptrOutputData);
 
 #endif /* LOG_DECODER_H */
 /*---------------------------------------------------- end of file ---------------------------------------------------*/
\ No newline at end of file
@@ -0,0 +1,230 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Columnar frame batches passed between the parse, validate, decode and write stages. The columns     */
+/*                of a batch live in one allocation, each stage runs as one tight loop over the columns it needs.     */
+/*                                                                                                                    */
+/*  File        : log_decoder_Batch.c                                                                                 */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_bBatchOpen                                                                                          */
+/* 2 / LogDecoder_vidBatchClose                                                                                       */
+/* 3 / LogDecoder_vidBatchInput                                                                                       */
+/* 4 / LogDecoder_vidBatchOutput                                                                                      */
+/* 5 / LogDecoder_vidSelectInit                                                                                       */
+/* 6 / LogDecoder_vidBatchSelect                                                                                      */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include <stdlib.h>
+#include "log_decoder_Batch.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+/* Bytes of all the columns for one frame                                                                             */
+#define BATCH_FRAME_SIZE                 (  (3U * sizeof(uint64)) + sizeof(uint32p)                                  \
+                                          + (DECODED_COLUMNS_NUMBER * sizeof(sint32p)) + sizeof(uint16)             \
+                                          + (2U * sizeof(uint8)) + (2U * sizeof(boolean)) )
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bBatchOpen                                                                               */
+/* !Description : Allocate the columns of an empty batch. The widest columns come first so that every column          */
+/*                stays aligned on its element size.                                                                  */
+/*                                                                                                                    */
+/* !Inputs      : u32Capacity                   !Comment : Maximum number of frames of the batch                      */
+/* !Outputs     : ptrBatch                      !Comment : Empty batch                                                */
+/*                bLocStatus                    !Comment : FALSE if the memory could not be allocated                 */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bBatchOpen(LogDecoder_strBatchType *ptrBatch, uint32 u32Capacity)
+{
+    char *ptrLocColumn = NULL;
+    uint32 u32LocIndex = FALSE;
+
+    memset(ptrBatch, 0, sizeof(*ptrBatch));
+    ptrBatch->ptrMemory = malloc(((size_t)u32Capacity * BATCH_FRAME_SIZE) + 1U);
+    if(ptrBatch->ptrMemory == NULL)
+    {
+        return FALSE;
+    }
+    ptrBatch->u32Capacity = u32Capacity;
+
+    ptrLocColumn = (char *)ptrBatch->ptrMemory;
+    ptrBatch->ptrFrameNb = (uint64 *)ptrLocColumn;
+    ptrLocColumn += (size_t)u32Capacity * sizeof(uint64);
+    ptrBatch->ptrTimestamp = (uint64 *)ptrLocColumn;
+    ptrLocColumn += (size_t)u32Capacity * sizeof(uint64);
+    ptrBatch->ptrFrameDropCnt = (uint64 *)ptrLocColumn;
+    ptrLocColumn += (size_t)u32Capacity * sizeof(uint64);
+    ptrBatch->ptrPayload = (uint32p *)ptrLocColumn;
+    ptrLocColumn += (size_t)u32Capacity * sizeof(uint32p);
+    for(u32LocIndex = 0U; u32LocIndex < DECODED_COLUMNS_NUMBER; u32LocIndex++)
+    {
+        ptrBatch->aptrValue[u32LocIndex] = (sint32p *)ptrLocColumn;
+        ptrLocColumn += (size_t)u32Capacity * sizeof(sint32p);
+    }
+    /* Only a merge fills the source column, it reads 0 for a single log                          */
+    ptrBatch->ptrSource = (uint16 *)ptrLocColumn;
+    memset(ptrBatch->ptrSource, 0, (size_t)u32Capacity * sizeof(uint16));
+    ptrLocColumn += (size_t)u32Capacity * sizeof(uint16);
+    ptrBatch->ptrId = (uint8 *)ptrLocColumn;
+    ptrLocColumn += (size_t)u32Capacity * sizeof(uint8);
+    ptrBatch->ptrChecksum = (uint8 *)ptrLocColumn;
+    ptrLocColumn += (size_t)u32Capacity * sizeof(uint8);
+    ptrBatch->ptrChecksumOK = (boolean *)ptrLocColumn;
+    ptrLocColumn += (size_t)u32Capacity * sizeof(boolean);
+    ptrBatch->ptrTimeoutOK = (boolean *)ptrLocColumn;
+
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBatchClose                                                                            */
+/* !Description : Free the columns of a batch                                                                         */
+/*                                                                                                                    */
+/* !Inputs      : ptrBatch                      !Comment : Batch opened by LogDecoder_bBatchOpen, or zeroed           */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidBatchClose(LogDecoder_strBatchType *ptrBatch)
+{
+    free(ptrBatch->ptrMemory);
+    memset(ptrBatch, 0, sizeof(*ptrBatch));
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBatchInput                                                                            */
+/* !Description : Get the input fields of one frame of a batch                                                        */
+/*                                                                                                                    */
+/* !Inputs      : ptrBatch                      !Comment : Batch                                                      */
+/*                u32Index                      !Comment : Row of the frame in the batch                              */
+/*                                              !Range   : [0, u32FramesNb - 1]                                       */
+/* !Outputs     : ptrInputData                  !Comment : Input fields of the frame                                  */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidBatchInput(const LogDecoder_strBatchType *ptrBatch, uint32 u32Index,
+                              LogDecoder_strInputDataType *ptrInputData)
+{
+    ptrInputData->u8Id         = ptrBatch->ptrId[u32Index];
+    ptrInputData->u64FrameNb   = ptrBatch->ptrFrameNb[u32Index];
+    ptrInputData->u64Timestamp = ptrBatch->ptrTimestamp[u32Index];
+    ptrInputData->u32Payload   = ptrBatch->ptrPayload[u32Index];
+    ptrInputData->u8Checksum   = ptrBatch->ptrChecksum[u32Index];
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBatchOutput                                                                           */
+/* !Description : Get the decoded row of one frame of a batch, after the validate and decode stages                   */
+/*                                                                                                                    */
+/* !Inputs      : ptrBatch                      !Comment : Batch                                                      */
+/*                u32Index                      !Comment : Row of the frame in the batch                              */
+/*                                              !Range   : [0, u32FramesNb - 1]                                       */
+/* !Outputs     : ptrOutputData                 !Comment : Decoded row of the frame                                   */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidBatchOutput(const LogDecoder_strBatchType *ptrBatch, uint32 u32Index,
+                               LogDecoder_strOutputDataType *ptrOutputData)
+{
+    uint32 u32LocColumn = FALSE;
+
+    for(u32LocColumn = 0U; u32LocColumn < DECODED_COLUMNS_NUMBER; u32LocColumn++)
+    {
+        ptrOutputData->strDecodedData.as32Value[u32LocColumn] = ptrBatch->aptrValue[u32LocColumn][u32Index];
+    }
+    ptrOutputData->u64FrameDropCnt = ptrBatch->ptrFrameDropCnt[u32Index];
+    ptrOutputData->u64FrameNb      = ptrBatch->ptrFrameNb[u32Index];
+    ptrOutputData->u64Timestamp    = ptrBatch->ptrTimestamp[u32Index];
+    ptrOutputData->bChecksumOK     = ptrBatch->ptrChecksumOK[u32Index];
+    ptrOutputData->bTimeoutOK      = ptrBatch->ptrTimeoutOK[u32Index];
+    ptrOutputData->u8Id            = ptrBatch->ptrId[u32Index];
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSelectInit                                                                            */
+/* !Description : Select all the rows : every frame ID, the whole time range, anomalies or not                        */
+/*                                                                                                                    */
+/* !Inputs      : ptrSelect                     !Comment : Selection to be initialized                                */
+/* !Outputs     : ptrSelect                     !Comment : Selection of all the rows                                  */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidSelectInit(LogDecoder_strSelectType *ptrSelect)
+{
+    memset(ptrSelect->abId, TRUE, sizeof(ptrSelect->abId));
+    ptrSelect->u64FromTimestamp = FALSE;
+    ptrSelect->u64ToTimestamp   = UINT64_MAX;
+    ptrSelect->bParseTimestamp  = TRUE;
+    ptrSelect->bOnlyAnomalies   = FALSE;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBatchSelect                                                                           */
+/* !Description : Keep only the selected rows of a validated batch, in their order. The columns are compacted in      */
+/*                place, so that the decode stage and the writers see a batch of the kept rows only.                  */
+/*                                                                                                                    */
+/* !Inputs      : ptrSelect                     !Comment : Rows to be kept, NULL to keep all the rows                 */
+/*                ptrBatch                      !Comment : Validated batch                                            */
+/* !Outputs     : ptrBatch                      !Comment : Batch holding the kept rows                                */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidBatchSelect(const LogDecoder_strSelectType *ptrSelect, LogDecoder_strBatchType *ptrBatch)
+{
+    uint32 u32LocIndex = FALSE;
+    uint32 u32LocKept = FALSE;
+    uint32 u32LocColumn = FALSE;
+
+    if(ptrSelect == NULL)
+    {
+        return;
+    }
+    for(u32LocIndex = 0U; u32LocIndex < ptrBatch->u32FramesNb; u32LocIndex++)
+    {
+        if(  (ptrSelect->abId[ptrBatch->ptrId[u32LocIndex]] == TRUE)
+          && (ptrBatch->ptrTimestamp[u32LocIndex] >= ptrSelect->u64FromTimestamp)
+          && (ptrBatch->ptrTimestamp[u32LocIndex] <= ptrSelect->u64ToTimestamp)
+          && (  (ptrSelect->bOnlyAnomalies == FALSE) || (ptrBatch->ptrChecksumOK[u32LocIndex] == FALSE)
+             || (ptrBatch->ptrTimeoutOK[u32LocIndex] == FALSE) ) )
+        {
+            /* Rows are only moved backward, a kept row never overwrites a row still to be read   */
+            ptrBatch->ptrFrameNb[u32LocKept]      = ptrBatch->ptrFrameNb[u32LocIndex];
+            ptrBatch->ptrTimestamp[u32LocKept]    = ptrBatch->ptrTimestamp[u32LocIndex];
+            ptrBatch->ptrFrameDropCnt[u32LocKept] = ptrBatch->ptrFrameDropCnt[u32LocIndex];
+            ptrBatch->ptrPayload[u32LocKept]      = ptrBatch->ptrPayload[u32LocIndex];
+            for(u32LocColumn = 0U; u32LocColumn < DECODED_COLUMNS_NUMBER; u32LocColumn++)
+            {
+                ptrBatch->aptrValue[u32LocColumn][u32LocKept] = ptrBatch->aptrValue[u32LocColumn][u32LocIndex];
+            }
+            ptrBatch->ptrSource[u32LocKept]       = ptrBatch->ptrSource[u32LocIndex];
+            ptrBatch->ptrId[u32LocKept]           = ptrBatch->ptrId[u32LocIndex];
+            ptrBatch->ptrChecksum[u32LocKept]     = ptrBatch->ptrChecksum[u32LocIndex];
+            ptrBatch->ptrChecksumOK[u32LocKept]   = ptrBatch->ptrChecksumOK[u32LocIndex];
+            ptrBatch->ptrTimeoutOK[u32LocKept]    = ptrBatch->ptrTimeoutOK[u32LocIndex];
+            u32LocKept++;
+        }
+    }
+    ptrBatch->u32FramesNb = u32LocKept;
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,54 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Columnar frame batches passed between the parse, validate, decode and write stages. The columns     */
+/*                of a batch live in one allocation, each stage runs as one tight loop over the columns it needs.     */
+/*                                                                                                                    */
+/*  File        : log_decoder_Batch.h                                                                                 */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_BATCH_H
+#define LOG_DECODER_BATCH_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+#define BATCH_FRAMES_NUMBER             (64U * 1024U)
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+/* Rows kept in the output, the other rows are still tracked but neither decoded nor written                          */
+typedef struct
+{
+    uint64  u64FromTimestamp;       /* First timestamp kept (ms)                                              */
+    uint64  u64ToTimestamp;         /* Last timestamp kept (ms)                                               */
+    boolean abId[FRAME_IDS_NUMBER]; /* TRUE for the frame IDs kept                                            */
+    boolean bParseTimestamp;        /* Timestamp checked by the parser, FALSE when it is extended afterwards  */
+    boolean bOnlyAnomalies;         /* Keep only the rows whose ChecksumOK or TimestampOk is false            */
+}LogDecoder_strSelectType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+boolean LogDecoder_bBatchOpen(LogDecoder_strBatchType *ptrBatch, uint32 u32Capacity);
+void LogDecoder_vidBatchClose(LogDecoder_strBatchType *ptrBatch);
+void LogDecoder_vidBatchInput(const LogDecoder_strBatchType *ptrBatch, uint32 u32Index,
+                              LogDecoder_strInputDataType *ptrInputData);
+void LogDecoder_vidBatchOutput(const LogDecoder_strBatchType *ptrBatch, uint32 u32Index,
+                               LogDecoder_strOutputDataType *ptrOutputData);
+void LogDecoder_vidSelectInit(LogDecoder_strSelectType *ptrSelect);
+void LogDecoder_vidBatchSelect(const LogDecoder_strSelectType *ptrSelect, LogDecoder_strBatchType *ptrBatch);
+
+#endif /* LOG_DECODER_BATCH_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,445 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Binary columnar output. The decoded rows are written by blocks, each column of a block being a      */
+/*                contiguous fixed-width array. The header describes the columns and the footer lists the blocks      */
+/*                with their row count and min / max timestamp, so that a reader can map the file and scan only       */
+/*                the columns and blocks it needs.                                                                    */
+/*                                                                                                                    */
+/*  File        : log_decoder_Binary.c                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_ptrBatchColumn                                                                                      */
+/* 2 / LogDecoder_vidBinaryWrite                                                                                      */
+/* 3 / LogDecoder_u64BinaryBlockSize                                                                                  */
+/* 4 / LogDecoder_vidBinaryOpen                                                                                       */
+/* 5 / LogDecoder_vidBinaryBatch                                                                                      */
+/* 6 / LogDecoder_bBinaryClose                                                                                        */
+/* 7 / LogDecoder_u8BinaryReaderOpen                                                                                  */
+/* 8 / LogDecoder_ptrBinaryColumn                                                                                     */
+/* 9 / LogDecoder_bBinaryReadBlock                                                                                    */
+/* 10 / LogDecoder_vidBinaryReaderClose                                                                               */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include <stdlib.h>
+#include "log_decoder_Binary.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define BINARY_BLOCKS_FIRST_CAPACITY     64U
+#define VALUE_DECIMALS                   3U
+/* Size rounded up to the column / block boundary                                                                     */
+#define BINARY_ALIGNED(size)             ((((size) + BINARY_ALIGNMENT) - 1U) & ~((uint64)BINARY_ALIGNMENT - 1U))
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+/* Columns of every block, in the order of the .csv output                                                            */
+static const LogDecoder_strBinaryColumnType LogDecoder_astrBinaryColumns[BINARY_COLUMNS_NUMBER] =
+{
+    [BINARY_COLUMN_ID]                         = { "ID", sizeof(uint8), 0U, 0U, 0U },
+    [BINARY_COLUMN_FRAME_NB]                   = { "FrameNb", sizeof(uint64), 0U, 0U, 0U },
+    [BINARY_COLUMN_TIMESTAMP]                  = { "Timestamp", sizeof(uint64), 0U, 0U, 0U },
+    [BINARY_COLUMN_VALUE + DECODED_POSITION_X] = { "PositionX", sizeof(sint32p), 1U, VALUE_DECIMALS, 0U },
+    [BINARY_COLUMN_VALUE + DECODED_POSITION_Y] = { "PositionY", sizeof(sint32p), 1U, VALUE_DECIMALS, 0U },
+    [BINARY_COLUMN_VALUE + DECODED_VELOCITY_X] = { "VelocityX", sizeof(sint32p), 1U, VALUE_DECIMALS, 0U },
+    [BINARY_COLUMN_VALUE + DECODED_VELOCITY_Y] = { "VelocityY", sizeof(sint32p), 1U, VALUE_DECIMALS, 0U },
+    [BINARY_COLUMN_CHECKSUM_OK]                = { "ChecksumOK", sizeof(boolean), 0U, 0U, 0U },
+    [BINARY_COLUMN_TIMEOUT_OK]                 = { "TimestampOk", sizeof(boolean), 0U, 0U, 0U },
+    [BINARY_COLUMN_FRAME_DROP_CNT]             = { "FrameDropCnt", sizeof(uint64), 0U, 0U, 0U }
+};
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static void *LogDecoder_ptrBatchColumn(const LogDecoder_strBatchType *ptrBatch, uint32 u32Column);
+static void LogDecoder_vidBinaryWrite(LogDecoder_strBinaryWriterType *ptrBinary, const void *ptrData, size_t u32Size);
+static uint64 LogDecoder_u64BinaryBlockSize(uint64 u64RowsNb);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrBatchColumn                                                                           */
+/* !Description : Get the batch column holding a column of the binary format                                          */
+/*                                                                                                                    */
+/* !Inputs      : ptrBatch                      !Comment : Batch                                                      */
+/*                u32Column                     !Comment : Column of the binary format                                */
+/*                                              !Range   : [0, BINARY_COLUMNS_NUMBER - 1]                             */
+/* !Outputs     : ptrLocColumn                  !Comment : First value of the column                                  */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void *LogDecoder_ptrBatchColumn(const LogDecoder_strBatchType *ptrBatch, uint32 u32Column)
+{
+    void *ptrLocColumn = NULL;
+
+    switch(u32Column)
+    {
+        case BINARY_COLUMN_ID:
+            ptrLocColumn = ptrBatch->ptrId;
+            break;
+        case BINARY_COLUMN_FRAME_NB:
+            ptrLocColumn = ptrBatch->ptrFrameNb;
+            break;
+        case BINARY_COLUMN_TIMESTAMP:
+            ptrLocColumn = ptrBatch->ptrTimestamp;
+            break;
+        case BINARY_COLUMN_CHECKSUM_OK:
+            ptrLocColumn = ptrBatch->ptrChecksumOK;
+            break;
+        case BINARY_COLUMN_TIMEOUT_OK:
+            ptrLocColumn = ptrBatch->ptrTimeoutOK;
+            break;
+        case BINARY_COLUMN_FRAME_DROP_CNT:
+            ptrLocColumn = ptrBatch->ptrFrameDropCnt;
+            break;
+        default:
+            ptrLocColumn = ptrBatch->aptrValue[u32Column - BINARY_COLUMN_VALUE];
+            break;
+    }
+
+    return ptrLocColumn;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBinaryWrite                                                                           */
+/* !Description : Write bytes to the binary file followed by the zero padding up to the next boundary                 */
+/*                                                                                                                    */
+/* !Inputs      : ptrBinary                     !Comment : Opened binary writer                                       */
+/*                ptrData                       !Comment : Bytes to be written                                        */
+/*                u32Size                       !Comment : Number of bytes                                            */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidBinaryWrite(LogDecoder_strBinaryWriterType *ptrBinary, const void *ptrData, size_t u32Size)
+{
+    static const char acLocPadding[BINARY_ALIGNMENT] = {FALSE};
+    size_t u32LocPadding = (size_t)(BINARY_ALIGNED(u32Size) - u32Size);
+
+    LogDecoder_vidWriterText(ptrBinary->ptrWriter, (const char *)ptrData, u32Size);
+    LogDecoder_vidWriterText(ptrBinary->ptrWriter, acLocPadding, u32LocPadding);
+    ptrBinary->u64Offset += u32Size + u32LocPadding;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u64BinaryBlockSize                                                                       */
+/* !Description : Size of a block in the file, all its columns with their padding                                     */
+/*                                                                                                                    */
+/* !Inputs      : u64RowsNb                     !Comment : Number of rows of the block                                */
+/* !Outputs     : u64LocSize                    !Comment : Size of the block in bytes                                 */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint64 LogDecoder_u64BinaryBlockSize(uint64 u64RowsNb)
+{
+    uint64 u64LocSize = FALSE;
+    uint32 u32LocColumn = FALSE;
+
+    for(u32LocColumn = 0U; u32LocColumn < BINARY_COLUMNS_NUMBER; u32LocColumn++)
+    {
+        u64LocSize += BINARY_ALIGNED(u64RowsNb * LogDecoder_astrBinaryColumns[u32LocColumn].u8Width);
+    }
+
+    return u64LocSize;
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBinaryOpen                                                                            */
+/* !Description : Start a binary file on an opened writer, the header is written at once                              */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer, nothing written yet                         */
+/* !Outputs     : ptrBinary                     !Comment : Binary writer                                              */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidBinaryOpen(LogDecoder_strBinaryWriterType *ptrBinary, LogDecoder_strWriterType *ptrWriter)
+{
+    LogDecoder_strBinaryHeaderType strLocHeader;
+
+    memset(ptrBinary, 0, sizeof(*ptrBinary));
+    ptrBinary->ptrWriter = ptrWriter;
+
+    memset(&strLocHeader, 0, sizeof(strLocHeader));
+    memcpy(strLocHeader.acMagic, BINARY_MAGIC, BINARY_MAGIC_LENGTH);
+    strLocHeader.u16Version    = BINARY_VERSION;
+    strLocHeader.u16ColumnsNb  = BINARY_COLUMNS_NUMBER;
+    strLocHeader.u32ByteOrder  = (uint32p)BINARY_BYTE_ORDER;
+    strLocHeader.u32HeaderSize = (uint32p)BINARY_ALIGNED(sizeof(strLocHeader));
+    memcpy(strLocHeader.astrColumn, LogDecoder_astrBinaryColumns, sizeof(LogDecoder_astrBinaryColumns));
+    LogDecoder_vidBinaryWrite(ptrBinary, &strLocHeader, sizeof(strLocHeader));
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBinaryBatch                                                                           */
+/* !Description : Write the rows of a validated and decoded batch as one block, column after column                   */
+/*                                                                                                                    */
+/* !Inputs      : ptrBinary                     !Comment : Opened binary writer                                       */
+/*                ptrBatch                      !Comment : Validated and decoded batch                                */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidBinaryBatch(LogDecoder_strBinaryWriterType *ptrBinary, const LogDecoder_strBatchType *ptrBatch)
+{
+    LogDecoder_strBinaryBlockType *ptrLocBlocks = NULL;
+    LogDecoder_strBinaryBlockType *ptrLocBlock = NULL;
+    uint32 u32LocCapacity = FALSE;
+    uint32 u32LocIndex = FALSE;
+
+    if((ptrBatch->u32FramesNb == 0U) || (ptrBinary->bError == TRUE))
+    {
+        return;
+    }
+    if(ptrBinary->u32BlocksNb == ptrBinary->u32BlocksCapacity)
+    {
+        u32LocCapacity = (ptrBinary->u32BlocksCapacity == 0U) ? BINARY_BLOCKS_FIRST_CAPACITY
+                                                              : (2U * ptrBinary->u32BlocksCapacity);
+        ptrLocBlocks = realloc(ptrBinary->ptrBlocks, u32LocCapacity * sizeof(LogDecoder_strBinaryBlockType));
+        if(ptrLocBlocks == NULL)
+        {
+            ptrBinary->bError = TRUE;
+            return;
+        }
+        ptrBinary->ptrBlocks = ptrLocBlocks;
+        ptrBinary->u32BlocksCapacity = u32LocCapacity;
+    }
+
+    /* Footer entry : position, size and timestamp range of the block                             */
+    ptrLocBlock = &ptrBinary->ptrBlocks[ptrBinary->u32BlocksNb];
+    ptrLocBlock->u64Offset       = ptrBinary->u64Offset;
+    ptrLocBlock->u32RowsNb       = (uint32p)ptrBatch->u32FramesNb;
+    ptrLocBlock->u32Reserved     = FALSE;
+    ptrLocBlock->u64MinTimestamp = ptrBatch->ptrTimestamp[0];
+    ptrLocBlock->u64MaxTimestamp = ptrBatch->ptrTimestamp[0];
+    for(u32LocIndex = 1U; u32LocIndex < ptrBatch->u32FramesNb; u32LocIndex++)
+    {
+        if(ptrBatch->ptrTimestamp[u32LocIndex] < ptrLocBlock->u64MinTimestamp)
+        {
+            ptrLocBlock->u64MinTimestamp = ptrBatch->ptrTimestamp[u32LocIndex];
+        }
+        if(ptrBatch->ptrTimestamp[u32LocIndex] > ptrLocBlock->u64MaxTimestamp)
+        {
+            ptrLocBlock->u64MaxTimestamp = ptrBatch->ptrTimestamp[u32LocIndex];
+        }
+    }
+    ptrBinary->u32BlocksNb++;
+    ptrBinary->u64RowsNb += ptrBatch->u32FramesNb;
+
+    for(u32LocIndex = 0U; u32LocIndex < BINARY_COLUMNS_NUMBER; u32LocIndex++)
+    {
+        LogDecoder_vidBinaryWrite(ptrBinary, LogDecoder_ptrBatchColumn(ptrBatch, u32LocIndex),
+                                  (size_t)ptrBatch->u32FramesNb * LogDecoder_astrBinaryColumns[u32LocIndex].u8Width);
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bBinaryClose                                                                             */
+/* !Description : Write the footer (block list and row count) and release the binary writer. The underlying           */
+/*                writer stays opened, it is closed by the caller.                                                    */
+/*                                                                                                                    */
+/* !Inputs      : ptrBinary                     !Comment : Binary writer to be closed                                 */
+/* !Outputs     : bLocStatus                    !Comment : FALSE if a block could not be recorded (no memory)         */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bBinaryClose(LogDecoder_strBinaryWriterType *ptrBinary)
+{
+    LogDecoder_strBinaryTailType strLocTail;
+    boolean bLocStatus = (boolean)(ptrBinary->bError == FALSE);
+
+    memset(&strLocTail, 0, sizeof(strLocTail));
+    strLocTail.u64RowsNb   = ptrBinary->u64RowsNb;
+    strLocTail.u32BlocksNb = (uint32p)ptrBinary->u32BlocksNb;
+    memcpy(strLocTail.acMagic, BINARY_FOOTER_MAGIC, BINARY_MAGIC_LENGTH);
+    LogDecoder_vidBinaryWrite(ptrBinary, ptrBinary->ptrBlocks,
+                              ptrBinary->u32BlocksNb * sizeof(LogDecoder_strBinaryBlockType));
+    LogDecoder_vidBinaryWrite(ptrBinary, &strLocTail, sizeof(strLocTail));
+
+    free(ptrBinary->ptrBlocks);
+    memset(ptrBinary, 0, sizeof(*ptrBinary));
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8BinaryReaderOpen                                                                       */
+/* !Description : Map a binary file and check its header, footer and block list. The columns of the file must         */
+/*                be the ones of this version, the blocks must lie between the header and the footer.                 */
+/*                                                                                                                    */
+/* !Inputs      : ptrPath                       !Comment : Path of the binary file                                    */
+/* !Outputs     : ptrReader                     !Comment : Reader, to be closed even if the open failed               */
+/*                u8LocStatus                   !Comment : Open status                                                */
+/*                                              !Range   : BINARY_READER_OK,                                          */
+/*                                                         BINARY_READER_OPEN_ERROR,                                  */
+/*                                                         BINARY_READER_FORMAT_ERROR,                                */
+/*                                                         BINARY_READER_VERSION_ERROR                                */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8BinaryReaderOpen(LogDecoder_strBinaryReaderType *ptrReader, const char *ptrPath)
+{
+    const LogDecoder_strBinaryTailType *ptrLocTail = NULL;
+    uint64 u64LocSize = FALSE;
+    uint64 u64LocFooter = FALSE;
+    uint64 u64LocRowsNb = FALSE;
+    uint32 u32LocIndex = FALSE;
+
+    memset(ptrReader, 0, sizeof(*ptrReader));
+    if(  (LogDecoder_bInputOpen(&ptrReader->strInput, ptrPath, FALSE) == FALSE)
+      || (LogDecoder_bInputLoad(&ptrReader->strInput) == FALSE) )
+    {
+        return BINARY_READER_OPEN_ERROR;
+    }
+    u64LocSize = (uint64)(ptrReader->strInput.ptrEnd - ptrReader->strInput.ptrBegin);
+
+    /* Header : magic, version, byte order and column layout                                      */
+    ptrReader->ptrHeader = (const LogDecoder_strBinaryHeaderType *)ptrReader->strInput.ptrBegin;
+    if(  (u64LocSize < (BINARY_ALIGNED(sizeof(LogDecoder_strBinaryHeaderType)) + sizeof(LogDecoder_strBinaryTailType)))
+      || (memcmp(ptrReader->ptrHeader->acMagic, BINARY_MAGIC, BINARY_MAGIC_LENGTH) != 0) )
+    {
+        return BINARY_READER_FORMAT_ERROR;
+    }
+    if(ptrReader->ptrHeader->u16Version != BINARY_VERSION)
+    {
+        return BINARY_READER_VERSION_ERROR;
+    }
+    if(  (ptrReader->ptrHeader->u32ByteOrder != (uint32p)BINARY_BYTE_ORDER)
+      || (ptrReader->ptrHeader->u16ColumnsNb != BINARY_COLUMNS_NUMBER)
+      || (ptrReader->ptrHeader->u32HeaderSize != BINARY_ALIGNED(sizeof(LogDecoder_strBinaryHeaderType)))
+      || (memcmp(ptrReader->ptrHeader->astrColumn, LogDecoder_astrBinaryColumns, sizeof(LogDecoder_astrBinaryColumns))
+          != 0) )
+    {
+        return BINARY_READER_FORMAT_ERROR;
+    }
+
+    /* Footer : tail at the end of the file, block list just before it                            */
+    ptrLocTail = (const LogDecoder_strBinaryTailType *)(ptrReader->strInput.ptrEnd
+                                                       - sizeof(LogDecoder_strBinaryTailType));
+    u64LocFooter = (uint64)ptrLocTail->u32BlocksNb * sizeof(LogDecoder_strBinaryBlockType);
+    if(  (memcmp(ptrLocTail->acMagic, BINARY_FOOTER_MAGIC, BINARY_MAGIC_LENGTH) != 0)
+      || ((u64LocFooter + sizeof(LogDecoder_strBinaryTailType) + ptrReader->ptrHeader->u32HeaderSize) > u64LocSize) )
+    {
+        return BINARY_READER_FORMAT_ERROR;
+    }
+    u64LocFooter = u64LocSize - sizeof(LogDecoder_strBinaryTailType) - u64LocFooter;
+    ptrReader->ptrBlocks   = (const LogDecoder_strBinaryBlockType *)(ptrReader->strInput.ptrBegin + u64LocFooter);
+    ptrReader->u32BlocksNb = ptrLocTail->u32BlocksNb;
+    ptrReader->u64RowsNb   = ptrLocTail->u64RowsNb;
+
+    for(u32LocIndex = 0U; u32LocIndex < ptrReader->u32BlocksNb; u32LocIndex++)
+    {
+        if(  (ptrReader->ptrBlocks[u32LocIndex].u64Offset < ptrReader->ptrHeader->u32HeaderSize)
+          || ((ptrReader->ptrBlocks[u32LocIndex].u64Offset % BINARY_ALIGNMENT) != 0U)
+          || (ptrReader->ptrBlocks[u32LocIndex].u64Offset > u64LocFooter)
+          || (LogDecoder_u64BinaryBlockSize(ptrReader->ptrBlocks[u32LocIndex].u32RowsNb)
+              > (u64LocFooter - ptrReader->ptrBlocks[u32LocIndex].u64Offset)) )
+        {
+            return BINARY_READER_FORMAT_ERROR;
+        }
+        u64LocRowsNb += ptrReader->ptrBlocks[u32LocIndex].u32RowsNb;
+    }
+
+    return (u64LocRowsNb == ptrReader->u64RowsNb) ? BINARY_READER_OK : BINARY_READER_FORMAT_ERROR;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrBinaryColumn                                                                          */
+/* !Description : Get a column of a block in place, in the mapped file. The values have the width and sign            */
+/*                given by the column description of the header.                                                      */
+/*                                                                                                                    */
+/* !Inputs      : ptrReader                     !Comment : Opened reader                                              */
+/*                u32Block                      !Comment : Block number                                               */
+/*                                              !Range   : [0, u32BlocksNb - 1]                                       */
+/*                u32Column                     !Comment : Column of the binary format                                */
+/*                                              !Range   : [0, BINARY_COLUMNS_NUMBER - 1]                             */
+/* !Outputs     : ptrLocColumn                  !Comment : First value of the column, u32RowsNb values                */
+/* !Number      : 8                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+const void *LogDecoder_ptrBinaryColumn(const LogDecoder_strBinaryReaderType *ptrReader, uint32 u32Block,
+                                       uint32 u32Column)
+{
+    const char *ptrLocColumn = ptrReader->strInput.ptrBegin + ptrReader->ptrBlocks[u32Block].u64Offset;
+    uint32 u32LocIndex = FALSE;
+
+    for(u32LocIndex = 0U; u32LocIndex < u32Column; u32LocIndex++)
+    {
+        ptrLocColumn += BINARY_ALIGNED((uint64)ptrReader->ptrBlocks[u32Block].u32RowsNb
+                                       * LogDecoder_astrBinaryColumns[u32LocIndex].u8Width);
+    }
+
+    return ptrLocColumn;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bBinaryReadBlock                                                                         */
+/* !Description : Copy all the columns of a block into a batch, e.g. to write them again as .csv rows                 */
+/*                                                                                                                    */
+/* !Inputs      : ptrReader                     !Comment : Opened reader                                              */
+/*                u32Block                      !Comment : Block number                                               */
+/*                                              !Range   : [0, u32BlocksNb - 1]                                       */
+/* !Outputs     : ptrBatch                      !Comment : Batch holding the rows of the block                        */
+/*                bLocStatus                    !Comment : FALSE if the block is larger than the batch                */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 9                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bBinaryReadBlock(const LogDecoder_strBinaryReaderType *ptrReader, uint32 u32Block,
+                                    LogDecoder_strBatchType *ptrBatch)
+{
+    uint32 u32LocColumn = FALSE;
+
+    if(ptrReader->ptrBlocks[u32Block].u32RowsNb > ptrBatch->u32Capacity)
+    {
+        return FALSE;
+    }
+    ptrBatch->u32FramesNb = ptrReader->ptrBlocks[u32Block].u32RowsNb;
+    for(u32LocColumn = 0U; u32LocColumn < BINARY_COLUMNS_NUMBER; u32LocColumn++)
+    {
+        memcpy(LogDecoder_ptrBatchColumn(ptrBatch, u32LocColumn),
+               LogDecoder_ptrBinaryColumn(ptrReader, u32Block, u32LocColumn),
+               (size_t)ptrBatch->u32FramesNb * LogDecoder_astrBinaryColumns[u32LocColumn].u8Width);
+    }
+
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBinaryReaderClose                                                                     */
+/* !Description : Unmap the binary file                                                                               */
+/*                                                                                                                    */
+/* !Inputs      : ptrReader                     !Comment : Reader to be closed                                        */
+/* !Number      : 10                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidBinaryReaderClose(LogDecoder_strBinaryReaderType *ptrReader)
+{
+    LogDecoder_vidInputClose(&ptrReader->strInput);
+    memset(ptrReader, 0, sizeof(*ptrReader));
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
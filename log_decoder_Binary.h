@@ -0,0 +1,126 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Binary columnar output. The decoded rows are written by blocks, each column of a block being a      */
+/*                contiguous fixed-width array. The header describes the columns and the footer lists the blocks      */
+/*                with their row count and min / max timestamp, so that a reader can map the file and scan only       */
+/*                the columns and blocks it needs.                                                                    */
+/*                                                                                                                    */
+/*  File        : log_decoder_Binary.h                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_BINARY_H
+#define LOG_DECODER_BINARY_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+#include "log_decoder_Input.h"
+#include "log_decoder_Writer.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/*---------------------------------- Format ----------------------------------*/
+#define BINARY_MAGIC                    "LDCB"
+#define BINARY_FOOTER_MAGIC             "LDCF"
+#define BINARY_MAGIC_LENGTH             4U
+#define BINARY_VERSION                  2U
+/* Written in the native byte order, a reader with another byte order rejects the file                                */
+#define BINARY_BYTE_ORDER               0x01020304UL
+/* Every column and every block starts on this boundary, so that a mapped column can be used in place                 */
+#define BINARY_ALIGNMENT                8U
+#define BINARY_NAME_LENGTH              16U
+/*--------------------------------- Columns ----------------------------------*/
+#define BINARY_COLUMN_ID                0U
+#define BINARY_COLUMN_FRAME_NB          1U
+#define BINARY_COLUMN_TIMESTAMP         2U
+#define BINARY_COLUMN_VALUE             3U      /* First decoded value column, DECODED_xxx order            */
+#define BINARY_COLUMN_CHECKSUM_OK       7U
+#define BINARY_COLUMN_TIMEOUT_OK        8U
+#define BINARY_COLUMN_FRAME_DROP_CNT    9U
+#define BINARY_COLUMNS_NUMBER           10U
+/*------------------------------ Reader status -------------------------------*/
+#define BINARY_READER_OK                0U
+#define BINARY_READER_OPEN_ERROR        1U
+#define BINARY_READER_FORMAT_ERROR      2U
+#define BINARY_READER_VERSION_ERROR     3U
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+/*-------------------------------- File layout -------------------------------*/
+typedef struct
+{
+    char    acName[BINARY_NAME_LENGTH];     /* Name of the .csv column, NUL padded                     */
+    uint8   u8Width;                        /* Bytes per value                                          */
+    uint8   u8Signed;                       /* 1 for two's complement values                            */
+    uint8   u8Decimals;                     /* Fixed-point value = stored value / 10^u8Decimals         */
+    uint8   u8Reserved;
+}LogDecoder_strBinaryColumnType;
+typedef struct
+{
+    char    acMagic[BINARY_MAGIC_LENGTH];
+    uint16  u16Version;
+    uint16  u16ColumnsNb;
+    uint32p u32ByteOrder;
+    uint32p u32HeaderSize;
+    LogDecoder_strBinaryColumnType astrColumn[BINARY_COLUMNS_NUMBER];
+}LogDecoder_strBinaryHeaderType;
+typedef struct
+{
+    uint64  u64Offset;                      /* Position of the block from the start of the file         */
+    uint64  u64MinTimestamp;
+    uint64  u64MaxTimestamp;
+    uint32p u32RowsNb;
+    uint32p u32Reserved;
+}LogDecoder_strBinaryBlockType;
+/* Last bytes of the file, the block list is just before it                                                           */
+typedef struct
+{
+    uint64  u64RowsNb;
+    uint32p u32BlocksNb;
+    char    acMagic[BINARY_MAGIC_LENGTH];
+}LogDecoder_strBinaryTailType;
+/*---------------------------------- Writer ----------------------------------*/
+typedef struct
+{
+    LogDecoder_strWriterType      *ptrWriter;
+    LogDecoder_strBinaryBlockType *ptrBlocks;  /* Footer entries, written when the file is closed         */
+    uint32                         u32BlocksNb;
+    uint32                         u32BlocksCapacity;
+    uint64                         u64Offset;
+    uint64                         u64RowsNb;
+    boolean                        bError;
+}LogDecoder_strBinaryWriterType;
+/*---------------------------------- Reader ----------------------------------*/
+typedef struct
+{
+    LogDecoder_strInputType              strInput;
+    const LogDecoder_strBinaryHeaderType *ptrHeader;
+    const LogDecoder_strBinaryBlockType  *ptrBlocks;
+    uint32                               u32BlocksNb;
+    uint64                               u64RowsNb;
+}LogDecoder_strBinaryReaderType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+void LogDecoder_vidBinaryOpen(LogDecoder_strBinaryWriterType *ptrBinary, LogDecoder_strWriterType *ptrWriter);
+void LogDecoder_vidBinaryBatch(LogDecoder_strBinaryWriterType *ptrBinary, const LogDecoder_strBatchType *ptrBatch);
+boolean LogDecoder_bBinaryClose(LogDecoder_strBinaryWriterType *ptrBinary);
+uint8 LogDecoder_u8BinaryReaderOpen(LogDecoder_strBinaryReaderType *ptrReader, const char *ptrPath);
+const void *LogDecoder_ptrBinaryColumn(const LogDecoder_strBinaryReaderType *ptrReader, uint32 u32Block,
+                                       uint32 u32Column);
+boolean LogDecoder_bBinaryReadBlock(const LogDecoder_strBinaryReaderType *ptrReader, uint32 u32Block,
+                                    LogDecoder_strBatchType *ptrBatch);
+void LogDecoder_vidBinaryReaderClose(LogDecoder_strBinaryReaderType *ptrReader);
+
+#endif /* LOG_DECODER_BINARY_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
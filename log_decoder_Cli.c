@@ -0,0 +1,2291 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Log decoder is a simple console application, that takes a .csv format logfile as an input           */
+/*                and provides an output log file also in .csv format, with Payload decoded into meaningful           */
+/*                values and additional flags if certains checks are violated for a given frame.                      */
+/*                                                                                                                    */
+/*  File        : log_decoder_Cli.c                                                                                   */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_ptrOutputOpen                                                                                       */
+/* 2 / LogDecoder_vidOutputClose                                                                                      */
+/* 3 / LogDecoder_bSameFile                                                                                           */
+/* 4 / LogDecoder_vidBinToCsv                                                                                         */
+/* 5 / LogDecoder_vidCsvToBin                                                                                         */
+/* 6 / LogDecoder_vidDecompress                                                                                       */
+/* 7 / LogDecoder_vidBuildIndex                                                                                       */
+/* 8 / LogDecoder_vidFollowInterrupt                                                                                  */
+/* 9 / LogDecoder_vidMessage                                                                                          */
+/* 10 / LogDecoder_s32DecodeFile                                                                                      */
+/* 11 / LogDecoder_s32DecodeBatchFile                                                                                 */
+/* 12 / LogDecoder_ptrConcat                                                                                          */
+/* 13 / LogDecoder_bFileListAdd                                                                                       */
+/* 14 / LogDecoder_bFileListFill                                                                                      */
+/* 15 / LogDecoder_s32ComparePath                                                                                     */
+/* 16 / LogDecoder_s32CompareOutput                                                                                   */
+/* 17 / LogDecoder_s32CompareSize                                                                                     */
+/* 18 / LogDecoder_ptrCsvField                                                                                        */
+/* 19 / LogDecoder_vidDecodeBatch                                                                                     */
+/* 20 / LogDecoder_vidDecodeMerge                                                                                     */
+/* 21 / LogDecoder_vidMainFunction                                                                                    */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#define CLI_POSIX_FILES
+#endif
+
+#include <errno.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include "log_decoder_Batch.h"
+#include "log_decoder_Binary.h"
+#include "log_decoder_Cli.h"
+#include "log_decoder_Compress.h"
+#include "log_decoder_Index.h"
+#include "log_decoder_Input.h"
+#include "log_decoder_Kernel.h"
+#include "log_decoder_Merge.h"
+#include "log_decoder_Parallel.h"
+#include "log_decoder_Parser.h"
+#include "log_decoder_Record.h"
+#include "log_decoder_Reorder.h"
+#include "log_decoder_Schema.h"
+#include "log_decoder_Stats.h"
+#include "log_decoder_Summary.h"
+#include "log_decoder_Writer.h"
+
+#ifdef CLI_POSIX_FILES
+#include <dirent.h>
+#include <glob.h>
+#include <sys/stat.h>
+#endif
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define MESSAGE_MAX_LENGTH               512U
+/* Batch mode : a file is split between the workers from this size, by at most this number of files at a time, each   */
+/* of them holding the decoded rows of a whole round of chunks                                                        */
+#define SPLIT_MIN_FILE_SIZE              (2U * PARALLEL_CHUNK_SIZE)
+#define SPLIT_MAX_FILES_NUMBER           2U
+
+/**********************************************************************************************************************/
+/* LOCAL TYPEDEF                                                                                                      */
+/**********************************************************************************************************************/
+/* One input file decoded to one output file : the whole run, or one file of the batch mode                           */
+typedef struct
+{
+    const char                     *ptrInputPath;
+    char                           *ptrOutputPath;      /* NULL for a batch file of which only the summary is kept */
+    const char                     *ptrMessagePrefix;   /* Put before every message, the input path in batch mode  */
+    const char                     *ptrMessageEnd;      /* Put after every message which does not end a line       */
+    const LogDecoder_strRegistryType *ptrRegistry;      /* Frame definitions of "--schema", NULL for the built-in  */
+    const LogDecoder_strSelectType *ptrSelect;          /* Rows to be written, NULL for all of them                */
+    LogDecoder_strSummaryType      *ptrSummary;         /* Totals accumulated instead of the rows, or NULL         */
+    LogDecoder_strStatsType        *ptrStats;           /* Run statistics, NULL without "--stats"                  */
+    LogDecoder_strPoolType         *ptrPool;            /* Pool of the batch mode, NULL for a single input         */
+    uint32                          u32ThreadsNb;
+    uint32                          u32FollowLatency;
+    uint32                          u32ReorderWindow;   /* Reorder window (ms), 0 without "--reorder-window"      */
+    boolean                         bWrap16;
+    boolean                         bBinaryOutput;
+    boolean                         bCompress;          /* Output files compressed with "--compress"               */
+    boolean                         bStatsJson;
+    /*------------------------ Batch mode only ---------------------------*/
+    uint64                          u64InputSize;       /* The largest files are started first                     */
+    char                           *ptrSummaryPrefix;   /* File column of the summary rows                         */
+    char                           *ptrSummaryRows;     /* Summary rows of the file, kept until all are decoded    */
+    size_t                          u32SummaryRowsSize;
+    LogDecoder_strStatsType         strStats;           /* Statistics of the file, merged at the end               */
+}LogDecoder_strJobType;
+/* Input files of the batch mode                                                                                      */
+typedef struct
+{
+    char                          **aptrPath;
+    size_t                          u32FilesNb;
+    size_t                          u32Capacity;
+}LogDecoder_strFileListType;
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+/* Frame definitions loaded from the "--schema" file, too large for the stack                                         */
+static LogDecoder_strRegistryType LogDecoder_strLoadedRegistry;
+/* Per frame ID totals of "--summary", too large for the stack                                                        */
+static LogDecoder_strSummaryType LogDecoder_strSummary;
+/* Destination of the messages, stderr when the decoded rows are written to stdout                                    */
+static FILE *LogDecoder_ptrMessageFile = NULL;
+/* Pool of the batch mode, too large for the stack                                                                    */
+static LogDecoder_strPoolType LogDecoder_strPool;
+/* Batch files being split between the workers                                                                        */
+static PIPELINE_ATOMIC uint32 LogDecoder_u32SplitFilesNb = 0U;
+#ifdef PIPELINE_THREADS
+/* Taken by the batch files to add their summary to the totals of all the files                                       */
+static mtx_t LogDecoder_strSummaryMutex;
+#endif
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static FILE *LogDecoder_ptrOutputOpen(const char *ptrPath, const char *ptrMode);
+static void LogDecoder_vidOutputClose(FILE *ptrFile);
+static boolean LogDecoder_bSameFile(const char *ptrInputPath, const char *ptrOutputPath);
+static void LogDecoder_vidBinToCsv(const char *ptrInputPath, const char *ptrOutputPath);
+static void LogDecoder_vidCsvToBin(const char *ptrInputPath, const char *ptrOutputPath);
+static void LogDecoder_vidDecompress(const char *ptrInputPath, const char *ptrOutputPath);
+static void LogDecoder_vidBuildIndex(const char *ptrInputPath, const LogDecoder_strRegistryType *ptrRegistry,
+                                     boolean bWrap16, uint32 u32Interval);
+static void LogDecoder_vidFollowInterrupt(int s32Signal);
+static void LogDecoder_vidMessage(const LogDecoder_strJobType *ptrJob, const char *ptrFormat, ...);
+static int LogDecoder_s32DecodeFile(void *ptrArgument);
+static int LogDecoder_s32DecodeBatchFile(void *ptrArgument);
+static char *LogDecoder_ptrConcat(const char *ptrFirst, const char *ptrSecond, const char *ptrThird);
+static boolean LogDecoder_bFileListAdd(LogDecoder_strFileListType *ptrList, const char *ptrDirectory,
+                                       const char *ptrName);
+static boolean LogDecoder_bFileListFill(LogDecoder_strFileListType *ptrList, const char *ptrPattern);
+static int LogDecoder_s32ComparePath(const void *ptrFirst, const void *ptrSecond);
+static int LogDecoder_s32CompareOutput(const void *ptrFirst, const void *ptrSecond);
+static int LogDecoder_s32CompareSize(const void *ptrFirst, const void *ptrSecond);
+static char *LogDecoder_ptrCsvField(const char *ptrPath, const char *ptrSeparator, boolean bQuoted);
+static void LogDecoder_vidDecodeBatch(const LogDecoder_strJobType *ptrTemplate, const char *ptrPattern,
+                                      const char *ptrOutputDirectory, uint32 u32WorkersNb);
+static void LogDecoder_vidDecodeMerge(const LogDecoder_strJobType *ptrTemplate, const char *ptrPattern,
+                                      const char *ptrOutputPath);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrOutputOpen                                                                            */
+/* !Description : Open the output file, or take stdout for OUTPUT_STDOUT_PATH                                         */
+/*                                                                                                                    */
+/* !Inputs      : ptrPath                       !Comment : Path of the output file                                    */
+/*                ptrMode                       !Comment : fopen mode of the output file                              */
+/* !Outputs     : ptrLocFile                    !Comment : Opened output, NULL if it cannot be opened                 */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static FILE *LogDecoder_ptrOutputOpen(const char *ptrPath, const char *ptrMode)
+{
+    FILE *ptrLocFile = NULL;
+
+    if (strcmp(ptrPath, OUTPUT_STDOUT_PATH) == 0)
+    {
+        /* The writer writes large blocks straight to the descriptor, a slow reader of the pipe   */
+        /* blocks the writes and so the decoding, the memory in use stays the same                */
+        ptrLocFile = stdout;
+    }
+    else
+    {
+        ptrLocFile = fopen(ptrPath, ptrMode);
+    }
+
+    return ptrLocFile;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidOutputClose                                                                           */
+/* !Description : Close the output file, stdout is left open                                                          */
+/*                                                                                                                    */
+/* !Inputs      : ptrFile                       !Comment : Output opened by LogDecoder_ptrOutputOpen, or NULL         */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidOutputClose(FILE *ptrFile)
+{
+    if ((ptrFile != NULL) && (ptrFile != stdout))
+    {
+        fclose(ptrFile);
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bSameFile                                                                                */
+/* !Description : Check if the output path names the input file, which opening the output would truncate while it is  */
+/*                read (a mapped input then ends the process). Without POSIX stat the paths are compared.             */
+/*                                                                                                                    */
+/* !Inputs      : ptrInputPath                  !Comment : Path of the input file                                     */
+/*                ptrOutputPath                 !Comment : Path of the output file                                    */
+/* !Outputs     : bLocSameFile                  !Comment : TRUE if both paths name the same file                      */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bSameFile(const char *ptrInputPath, const char *ptrOutputPath)
+{
+    boolean bLocSameFile = FALSE;
+#ifdef CLI_POSIX_FILES
+    struct stat strLocInputStat;
+    struct stat strLocOutputStat;
+
+    /* stdin and stdout are not named by their path                                               */
+    if (  (strcmp(ptrInputPath, INPUT_STDIN_PATH) != 0) && (strcmp(ptrOutputPath, OUTPUT_STDOUT_PATH) != 0)
+       && (stat(ptrInputPath, &strLocInputStat) == 0) && (stat(ptrOutputPath, &strLocOutputStat) == 0) )
+    {
+        bLocSameFile = (boolean)(  (strLocInputStat.st_dev == strLocOutputStat.st_dev)
+                                && (strLocInputStat.st_ino == strLocOutputStat.st_ino) );
+    }
+#else
+    bLocSameFile = (boolean)(strcmp(ptrInputPath, ptrOutputPath) == 0);
+#endif
+
+    return bLocSameFile;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBinToCsv                                                                              */
+/* !Description : Convert a binary output file back to the .csv output, block by block                                */
+/*                                                                                                                    */
+/* !Inputs      : ptrInputPath                  !Comment : Binary file written with "--output-format=bin"             */
+/*                ptrOutputPath                 !Comment : .csv file to be written                                    */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidBinToCsv(const char *ptrInputPath, const char *ptrOutputPath)
+{
+    LogDecoder_strBinaryReaderType strLocReader;
+    LogDecoder_strBatchType strLocBatch;
+    LogDecoder_strWriterType strLocWriter = {FALSE};
+    FILE   *LocOutputFile = NULL;
+    uint8   u8LocReaderStatus = BINARY_READER_OK;
+    uint32  u32LocBlock = FALSE;
+    uint32  u32LocCapacity = 1U;
+    boolean bLocSameFile = FALSE;
+
+    /* The output is not opened over the input it would truncate                                  */
+    bLocSameFile = LogDecoder_bSameFile(ptrInputPath, ptrOutputPath);
+    u8LocReaderStatus = LogDecoder_u8BinaryReaderOpen(&strLocReader, ptrInputPath);
+    if ((u8LocReaderStatus == BINARY_READER_OK) && (bLocSameFile == FALSE))
+    {
+        LocOutputFile = LogDecoder_ptrOutputOpen(ptrOutputPath, "w");
+    }
+
+    if (u8LocReaderStatus == BINARY_READER_VERSION_ERROR)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Unsupported binary file version");
+    }
+    else if (u8LocReaderStatus == BINARY_READER_FORMAT_ERROR)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Invalid binary file");
+    }
+    else if (bLocSameFile == TRUE)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "The output file %s is the input file", ptrOutputPath);
+    }
+    else if (  (LocOutputFile == NULL)
+            || (LogDecoder_bWriterOpen(&strLocWriter, LocOutputFile, WRITER_BUFFER_SIZE) == FALSE) )
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Unable to open the input or the output file");
+    }
+    else
+    {
+        /* One batch large enough for the largest block                                           */
+        for (u32LocBlock = 0U; u32LocBlock < strLocReader.u32BlocksNb; u32LocBlock++)
+        {
+            if (strLocReader.ptrBlocks[u32LocBlock].u32RowsNb > u32LocCapacity)
+            {
+                u32LocCapacity = strLocReader.ptrBlocks[u32LocBlock].u32RowsNb;
+            }
+        }
+        if (LogDecoder_bBatchOpen(&strLocBatch, u32LocCapacity) == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Not enough memory to decode the input");
+        }
+        else
+        {
+            LogDecoder_vidWriterText(&strLocWriter, HEADER_FOR_OUTPUT_FILE, sizeof(HEADER_FOR_OUTPUT_FILE) - 1U);
+            for (u32LocBlock = 0U; u32LocBlock < strLocReader.u32BlocksNb; u32LocBlock++)
+            {
+                (void)LogDecoder_bBinaryReadBlock(&strLocReader, u32LocBlock, &strLocBatch);
+                LogDecoder_vidWriterBatch(&strLocWriter, &strLocBatch);
+            }
+            LogDecoder_vidBatchClose(&strLocBatch);
+        }
+        if (LogDecoder_bWriterClose(&strLocWriter) == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Unable to write the output file");
+        }
+    }
+
+    LogDecoder_vidOutputClose(LocOutputFile);
+    LogDecoder_vidBinaryReaderClose(&strLocReader);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidCsvToBin                                                                              */
+/* !Description : Convert a .csv log once into a record file, that the decoder then reads without any parsing. The    */
+/*                rows are parsed batch by batch and written as they are, nothing is validated nor decoded.           */
+/*                                                                                                                    */
+/* !Inputs      : ptrInputPath                  !Comment : .csv input log                                             */
+/*                ptrOutputPath                 !Comment : Record file to be written                                  */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidCsvToBin(const char *ptrInputPath, const char *ptrOutputPath)
+{
+    LogDecoder_strInputType strLocInput = {FALSE};
+    LogDecoder_strBatchType strLocBatch;
+    LogDecoder_strWriterType strLocWriter = {FALSE};
+    FILE   *LocOutputFile = NULL;
+    const char *ptrLocCursor = NULL;
+    uint8   u8LocParseStatus = PARSER_ROW_INCOMPLETE;
+    uint32  u32LocRowNumber = FALSE;
+    boolean bLocSameFile = FALSE;
+
+    /* The output is not opened over the input it would truncate                                  */
+    bLocSameFile = LogDecoder_bSameFile(ptrInputPath, ptrOutputPath);
+    if ((bLocSameFile == FALSE) && (LogDecoder_bInputOpen(&strLocInput, ptrInputPath, FALSE) == TRUE))
+    {
+        LocOutputFile = LogDecoder_ptrOutputOpen(ptrOutputPath, "wb");
+    }
+
+    if (bLocSameFile == TRUE)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "The output file %s is the input file", ptrOutputPath);
+    }
+    else if (  (LocOutputFile == NULL)
+            || (LogDecoder_bWriterOpen(&strLocWriter, LocOutputFile, WRITER_BUFFER_SIZE) == FALSE) )
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Unable to open the input or the output file");
+    }
+    else
+    {
+        ptrLocCursor = strLocInput.ptrBegin;
+        while (  ((u8LocParseStatus = LogDecoder_u8ParseHeader(&ptrLocCursor, strLocInput.ptrEnd,
+                                                               strLocInput.bLastBlock)) == PARSER_ROW_INCOMPLETE)
+              && (LogDecoder_bInputRefill(&strLocInput, ptrLocCursor) == TRUE) )
+        {
+            ptrLocCursor = strLocInput.ptrBegin;
+        }
+
+        if (u8LocParseStatus != PARSER_ROW_OK)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "First row must be in the following format :\n"
+                "ID,FrameNb,Timestamp,Payload,Checksum");
+        }
+        else if (LogDecoder_bBatchOpen(&strLocBatch, BATCH_FRAMES_NUMBER) == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Not enough memory to convert the input");
+        }
+        else
+        {
+            /* Reading, parsing and writing overlap                                               */
+            (void)LogDecoder_bInputStart(&strLocInput);
+            (void)LogDecoder_bWriterStart(&strLocWriter);
+            LogDecoder_vidRecordOpen(&strLocWriter);
+            while (u8LocParseStatus != PARSER_END_OF_DATA)
+            {
+                strLocBatch.u32FramesNb = FALSE;
+                u8LocParseStatus = LogDecoder_u8ParseBatch(&ptrLocCursor, strLocInput.ptrEnd, strLocInput.bLastBlock,
+                                                           NULL, &strLocBatch);
+                LogDecoder_vidRecordBatch(&strLocWriter, &strLocBatch);
+                u32LocRowNumber += strLocBatch.u32FramesNb;
+                if (u8LocParseStatus == PARSER_ROW_OK)
+                {
+                    /* Full batch, continue with the next one                                     */
+                }
+                else if (  (u8LocParseStatus == PARSER_ROW_INCOMPLETE)
+                        && (LogDecoder_bInputRefill(&strLocInput, ptrLocCursor) == TRUE) )
+                {
+                    ptrLocCursor = strLocInput.ptrBegin;
+                }
+                else if (u8LocParseStatus != PARSER_END_OF_DATA)
+                {
+                    /* The rows before the malformed one are converted, as they would be decoded  */
+                    fprintf(LogDecoder_ptrMessageFile, "Missing data in row number %lu", (u32LocRowNumber + 2U));
+                    break;
+                }
+                else
+                {
+                    /* End of the input data                                                      */
+                }
+            }
+            LogDecoder_vidBatchClose(&strLocBatch);
+        }
+        if (LogDecoder_bWriterClose(&strLocWriter) == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Unable to write the output file");
+        }
+    }
+
+    LogDecoder_vidOutputClose(LocOutputFile);
+    LogDecoder_vidInputClose(&strLocInput);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidDecompress                                                                            */
+/* !Description : Decompress a file written with "--compress" back to the output it holds, block by block             */
+/*                                                                                                                    */
+/* !Inputs      : ptrInputPath                  !Comment : Compressed file                                            */
+/*                ptrOutputPath                 !Comment : Decompressed file to be written                            */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidDecompress(const char *ptrInputPath, const char *ptrOutputPath)
+{
+    LogDecoder_strDecompressType strLocReader;
+    LogDecoder_strWriterType strLocWriter = {FALSE};
+    FILE   *LocOutputFile = NULL;
+    const char *ptrLocData = NULL;
+    size_t  u32LocSize = FALSE;
+    uint8   u8LocReaderStatus = COMPRESS_READER_OK;
+    boolean bLocSameFile = FALSE;
+
+    /* The output is not opened over the input it would truncate                                  */
+    bLocSameFile = LogDecoder_bSameFile(ptrInputPath, ptrOutputPath);
+    u8LocReaderStatus = LogDecoder_u8DecompressOpen(&strLocReader, ptrInputPath);
+    if ((u8LocReaderStatus == COMPRESS_READER_OK) && (bLocSameFile == FALSE))
+    {
+        LocOutputFile = LogDecoder_ptrOutputOpen(ptrOutputPath, "wb");
+    }
+
+    if (u8LocReaderStatus == COMPRESS_READER_VERSION_ERROR)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Unsupported compressed file version");
+    }
+    else if (u8LocReaderStatus == COMPRESS_READER_FORMAT_ERROR)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Invalid compressed file");
+    }
+    else if (u8LocReaderStatus == COMPRESS_READER_NO_MEMORY)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Not enough memory to decompress the input");
+    }
+    else if (bLocSameFile == TRUE)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "The output file %s is the input file", ptrOutputPath);
+    }
+    else if (  (LocOutputFile == NULL)
+            || (LogDecoder_bWriterOpen(&strLocWriter, LocOutputFile, WRITER_BUFFER_SIZE) == FALSE) )
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Unable to open the input or the output file");
+    }
+    else
+    {
+        /* Reading and decompressing overlap with the writes                                      */
+        (void)LogDecoder_bWriterStart(&strLocWriter);
+        while ((u8LocReaderStatus = LogDecoder_u8DecompressBlock(&strLocReader, &ptrLocData,
+                                                                 &u32LocSize)) == COMPRESS_READER_OK)
+        {
+            LogDecoder_vidWriterText(&strLocWriter, ptrLocData, u32LocSize);
+        }
+        /* The blocks before the invalid one are written                                          */
+        if (u8LocReaderStatus == COMPRESS_READER_TRUNCATED)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Truncated compressed file");
+        }
+        else if (u8LocReaderStatus == COMPRESS_READER_FORMAT_ERROR)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Invalid compressed file");
+        }
+        else
+        {
+            /* Empty block which ends the file                                                    */
+        }
+        if (LogDecoder_bWriterClose(&strLocWriter) == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Unable to write the output file");
+        }
+    }
+
+    LogDecoder_vidOutputClose(LocOutputFile);
+    LogDecoder_vidDecompressClose(&strLocReader);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidBuildIndex                                                                            */
+/* !Description : Write the index of a .csv input next to it, nothing is decoded                                      */
+/*                                                                                                                    */
+/* !Inputs      : ptrInputPath                  !Comment : .csv input file                                            */
+/*                ptrRegistry                   !Comment : Frame definitions, NULL for the built-in ones              */
+/*                bWrap16                       !Comment : TRUE for 16-bit FrameNb and Timestamp counters             */
+/*                u32Interval                   !Comment : Rows between two entries of the index                      */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidBuildIndex(const char *ptrInputPath, const LogDecoder_strRegistryType *ptrRegistry,
+                                     boolean bWrap16, uint32 u32Interval)
+{
+    LogDecoder_strInputType strLocInput = {FALSE};
+    LogDecoder_strContextType strLocContext;
+    const char *ptrLocCursor = NULL;
+    uint8   u8LocParseStatus = PARSER_ROW_INCOMPLETE;
+    uint8   u8LocIndexStatus = INDEX_BUILD_DONE;
+    uint32  u32LocRowNumber = FALSE;
+
+    if (LogDecoder_bInputOpen(&strLocInput, ptrInputPath, FALSE) == FALSE)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Unable to open the input file");
+        LogDecoder_vidInputClose(&strLocInput);
+        return;
+    }
+
+    ptrLocCursor = strLocInput.ptrBegin;
+    while (  ((u8LocParseStatus = LogDecoder_u8ParseHeader(&ptrLocCursor, strLocInput.ptrEnd,
+                                                           strLocInput.bLastBlock)) == PARSER_ROW_INCOMPLETE)
+          && (LogDecoder_bInputRefill(&strLocInput, ptrLocCursor) == TRUE) )
+    {
+        ptrLocCursor = strLocInput.ptrBegin;
+    }
+
+    if (u8LocParseStatus != PARSER_ROW_OK)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "First row must be in the following format :\n"
+            "ID,FrameNb,Timestamp,Payload,Checksum");
+    }
+    else
+    {
+        LogDecoder_vidInit(&strLocContext);
+        if (ptrRegistry != NULL)
+        {
+            LogDecoder_vidSetRegistry(&strLocContext, ptrRegistry);
+        }
+        LogDecoder_vidSetWrap16(&strLocContext, bWrap16);
+
+        u8LocIndexStatus = LogDecoder_u8IndexBuild(&strLocContext, &strLocInput, ptrLocCursor, ptrInputPath,
+                                                   u32Interval, &u32LocRowNumber);
+        if (u8LocIndexStatus == INDEX_BUILD_ROW_ERROR)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Missing data in row number %lu", (u32LocRowNumber + 2U));
+        }
+        else if (u8LocIndexStatus == INDEX_BUILD_NO_MEMORY)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Not enough memory to build the index");
+        }
+        else if (u8LocIndexStatus == INDEX_BUILD_WRITE_ERROR)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Unable to write the index file");
+        }
+        else
+        {
+            /* The index covers the whole input                                                   */
+        }
+    }
+
+    LogDecoder_vidInputClose(&strLocInput);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidFollowInterrupt                                                                       */
+/* !Description : SIGINT handler of the follow mode, the input ends at its current end and the output is completed    */
+/*                                                                                                                    */
+/* !Inputs      : s32Signal                     !Comment : Received signal                                            */
+/* !Number      : 8                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidFollowInterrupt(int s32Signal)
+{
+    (void)s32Signal;
+    LogDecoder_vidInputStop();
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidMessage                                                                               */
+/* !Description : Print a message of the decoding of a file, in one write so that the messages of the batch files     */
+/*                decoded at the same time are not mixed                                                              */
+/*                                                                                                                    */
+/* !Inputs      : ptrJob                        !Comment : Decoded file, gives the text put around the message        */
+/*                ptrFormat                     !Comment : printf format of the message, and its arguments            */
+/* !Number      : 9                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidMessage(const LogDecoder_strJobType *ptrJob, const char *ptrFormat, ...)
+{
+    char    acLocMessage[MESSAGE_MAX_LENGTH];
+    va_list strLocArguments;
+    size_t  u32LocLength = FALSE;
+
+    va_start(strLocArguments, ptrFormat);
+    (void)vsnprintf(acLocMessage, sizeof(acLocMessage), ptrFormat, strLocArguments);
+    va_end(strLocArguments);
+    u32LocLength = strlen(acLocMessage);
+    fprintf(LogDecoder_ptrMessageFile, "%s%s%s", ptrJob->ptrMessagePrefix, acLocMessage,
+            ((u32LocLength != 0U) && (acLocMessage[u32LocLength - 1U] == '\n')) ? "" : ptrJob->ptrMessageEnd);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32DecodeFile                                                                            */
+/* !Description : Decode one input file to its output file, with the options of the command line. A mapped input is   */
+/*                split between the threads, or between the workers of the batch mode when it is large.               */
+/*                                                                                                                    */
+/* !Inputs      : ptrArgument                   !Comment : File to be decoded (LogDecoder_strJobType)                 */
+/* !Outputs     : s32LocStatus                  !Comment : Task exit code, always 0, the errors are printed           */
+/* !Number      : 10                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32DecodeFile(void *ptrArgument)
+{
+    const LogDecoder_strJobType *ptrJob = (const LogDecoder_strJobType *)ptrArgument;
+    FILE   *LocOutputFile = NULL;
+    LogDecoder_strWriterType strLocWriter = {FALSE};
+    LogDecoder_strBinaryWriterType strLocBinary;
+    boolean bLocWriterOpened = FALSE;
+    boolean bLocBinaryOpened = FALSE;
+    boolean bLocSummaryOpened = FALSE;
+    boolean bLocWriteStatus = TRUE;
+    boolean bLocSplit = FALSE;
+    boolean bLocSameFile = FALSE;
+
+    LogDecoder_strInputType strLocInput = {FALSE};
+    const char *ptrLocCursor = NULL;
+    const char *ptrLocEnd = NULL;
+    boolean bLocInputOpened = FALSE;
+    uint8   u8LocParseStatus = PARSER_ROW_INCOMPLETE;
+    uint8   u8LocRecordStatus = RECORD_HEADER_INCOMPLETE;
+    uint8   u8LocParallelStatus = PARALLEL_DONE;
+    uint8   u8LocIndexStatus = INDEX_LOOKUP_MISSING;
+    boolean bLocRecords = FALSE;
+
+    LogDecoder_strContextType strLocContext;
+    LogDecoder_strBatchType strLocBatch;
+    LogDecoder_strReorderType strLocReorder;
+    LogDecoder_strBatchType *ptrLocRows = &strLocBatch;
+    boolean bLocLastRows = FALSE;
+    LogDecoder_strIndexRangeType strLocRange;
+    uint64  u64LocEndOffset = INDEX_END_OF_INPUT;
+
+    uint32 u32RowNumber = FALSE;
+
+    /* The input open and its first read are the first timed stage                                */
+    LogDecoder_vidStatsInit(ptrJob->ptrStats, ptrJob->u32ThreadsNb);
+    /* Open the Input .csv file, mapped in memory when it is a regular file which is not followed */
+    bLocInputOpened = LogDecoder_bInputOpen(&strLocInput, ptrJob->ptrInputPath, ptrJob->u32FollowLatency);
+    LogDecoder_vidStatsLap(ptrJob->ptrStats, STATS_STAGE_INPUT);
+    if (ptrJob->u32FollowLatency != 0U)
+    {
+        /* Ctrl+C ends the followed input, the rows read so far are still written                 */
+        (void)signal(SIGINT, LogDecoder_vidFollowInterrupt);
+    }
+    if (ptrJob->ptrOutputPath == NULL)
+    {
+        /* Summarised batch file : nothing is written, the writer stays empty in memory           */
+        bLocWriterOpened = LogDecoder_bWriterOpen(&strLocWriter, NULL, OUTPUT_ROW_MAX_LENGTH);
+    }
+    else if ((bLocSameFile = LogDecoder_bSameFile(ptrJob->ptrInputPath, ptrJob->ptrOutputPath)) == TRUE)
+    {
+        /* Opening the output would truncate the input while it is read                           */
+    }
+    else
+    {
+        /* Open the Output .csv file with write access, in binary mode for the binary or the      */
+        /* compressed output                                                                      */
+        LocOutputFile = LogDecoder_ptrOutputOpen(ptrJob->ptrOutputPath,
+                                                 ((ptrJob->bBinaryOutput == TRUE) || (ptrJob->bCompress == TRUE))
+                                                 ? "wb" : "w");
+        /* The rows are formatted in a large buffer, written to the file in large blocks          */
+        bLocWriterOpened = (boolean)(  (LocOutputFile != NULL)
+                                    && (LogDecoder_bWriterOpen(&strLocWriter, LocOutputFile,
+                                                               WRITER_BUFFER_SIZE) == TRUE)
+                                    && (  (ptrJob->bCompress == FALSE)
+                                       || (LogDecoder_bWriterCompress(&strLocWriter) == TRUE) ) );
+    }
+
+    if (bLocSameFile == TRUE)
+    {
+        LogDecoder_vidMessage(ptrJob, "The output file %s is the input file", ptrJob->ptrOutputPath);
+    }
+    else if ((bLocInputOpened == FALSE) || (bLocWriterOpened == FALSE))
+    {
+        LogDecoder_vidMessage(ptrJob, "Unable to open the input or the output file");
+    }
+    else
+    {
+        /* A file converted with csv2bin holds records, copied to the batches without any parsing */
+        ptrLocCursor = strLocInput.ptrBegin;
+        while (  ((u8LocRecordStatus = LogDecoder_u8RecordHeader(&ptrLocCursor, strLocInput.ptrEnd,
+                                                                 strLocInput.bLastBlock)) == RECORD_HEADER_INCOMPLETE)
+              && (LogDecoder_bInputRefill(&strLocInput, ptrLocCursor) == TRUE) )
+        {
+            ptrLocCursor = strLocInput.ptrBegin;
+        }
+        bLocRecords = (boolean)(u8LocRecordStatus == RECORD_HEADER_OK);
+        if (bLocRecords == TRUE)
+        {
+            u8LocParseStatus = PARSER_ROW_OK;
+        }
+        else if (u8LocRecordStatus == RECORD_HEADER_VERSION_ERROR)
+        {
+            u8LocParseStatus = PARSER_ROW_ERROR;
+        }
+        else
+        {
+            /* Scan and check the first row format is the same expected format                    */
+            ptrLocCursor = strLocInput.ptrBegin;
+            while (  ((u8LocParseStatus = LogDecoder_u8ParseHeader(&ptrLocCursor, strLocInput.ptrEnd,
+                                                                   strLocInput.bLastBlock)) == PARSER_ROW_INCOMPLETE)
+                  && (LogDecoder_bInputRefill(&strLocInput, ptrLocCursor) == TRUE) )
+            {
+                ptrLocCursor = strLocInput.ptrBegin;
+            }
+        }
+        LogDecoder_vidStatsLap(ptrJob->ptrStats, STATS_STAGE_PARSE);
+
+        LogDecoder_vidInit(&strLocContext);
+        if (ptrJob->ptrRegistry != NULL)
+        {
+            LogDecoder_vidSetRegistry(&strLocContext, ptrJob->ptrRegistry);
+        }
+        LogDecoder_vidSetWrap16(&strLocContext, ptrJob->bWrap16);
+
+        /* Time range : start from the last index entry before it, stop after the last entry in it, */
+        /* a record file has no index and is decoded from the start                               */
+        ptrLocEnd = strLocInput.ptrEnd;
+        if (  (u8LocParseStatus == PARSER_ROW_OK) && (bLocRecords == FALSE) && (ptrJob->ptrSelect != NULL)
+           && ((ptrJob->ptrSelect->u64FromTimestamp != 0U) || (ptrJob->ptrSelect->u64ToTimestamp != UINT64_MAX))
+           && (strcmp(ptrJob->ptrInputPath, INPUT_STDIN_PATH) != 0) )
+        {
+            u8LocIndexStatus = LogDecoder_u8IndexLookup(&strLocContext, ptrJob->ptrInputPath,
+                                                        ptrJob->ptrSelect, &strLocRange);
+            if (  (u8LocIndexStatus == INDEX_LOOKUP_OK)
+               && (LogDecoder_bInputSeek(&strLocInput, strLocRange.u64BeginOffset) == TRUE) )
+            {
+                ptrLocCursor    = strLocInput.ptrBegin;
+                ptrLocEnd       = strLocInput.ptrEnd;
+                u32RowNumber    = (uint32)strLocRange.u64RowNumber;
+                u64LocEndOffset = strLocRange.u64EndOffset;
+                if (  (strLocInput.ptrBuffer == NULL)
+                   && (u64LocEndOffset < LogDecoder_u64InputOffset(&strLocInput, ptrLocEnd)) )
+                {
+                    /* Mapped input : the rows after the range are not split between the threads  */
+                    ptrLocEnd = ptrLocCursor + (u64LocEndOffset - strLocRange.u64BeginOffset);
+                }
+            }
+            else if (u8LocIndexStatus == INDEX_LOOKUP_OK)
+            {
+                /* The input could not be positioned, it is decoded from the start                */
+                LogDecoder_vidReset(&strLocContext);
+            }
+            else if (u8LocIndexStatus == INDEX_LOOKUP_MISMATCH)
+            {
+                LogDecoder_vidMessage(ptrJob,
+                        "The index file does not match the input, it is decoded from the start\n");
+            }
+            else
+            {
+                /* No index, the input is decoded from the start                                  */
+            }
+        }
+        LogDecoder_vidStatsLap(ptrJob->ptrStats, STATS_STAGE_INPUT);
+
+        /* Start the output : .csv header, or binary file header, the summary is written at the end */
+        if ((u8LocParseStatus == PARSER_ROW_OK) && (ptrJob->ptrSummary != NULL))
+        {
+            bLocSummaryOpened = TRUE;
+        }
+        else if ((u8LocParseStatus == PARSER_ROW_OK) && (ptrJob->bBinaryOutput == TRUE))
+        {
+            LogDecoder_vidBinaryOpen(&strLocBinary, &strLocWriter);
+            bLocBinaryOpened = TRUE;
+        }
+        else if (u8LocParseStatus == PARSER_ROW_OK)
+        {
+            LogDecoder_vidWriterText(&strLocWriter, HEADER_FOR_OUTPUT_FILE, sizeof(HEADER_FOR_OUTPUT_FILE) - 1U);
+        }
+        else
+        {
+            /* Nothing is written                                                                 */
+        }
+        LogDecoder_vidStatsLap(ptrJob->ptrStats, STATS_STAGE_OUTPUT);
+
+        /* The whole input is mapped, it can be split between the threads, the frames held by a   */
+        /* reorder window would cross the chunks                                                  */
+        bLocSplit = (boolean)(  (u8LocParseStatus == PARSER_ROW_OK) && (ptrJob->u32ThreadsNb > 1U)
+                             && (strLocInput.ptrBuffer == NULL) && (ptrJob->u32ReorderWindow == 0U) );
+        if ((bLocSplit == TRUE) && (ptrJob->ptrPool != NULL))
+        {
+            /* Batch file : only a large one is split between the workers, and only a few files   */
+            /* at a time, each of them holds the decoded rows of a whole round of chunks          */
+            if ((size_t)(ptrLocEnd - ptrLocCursor) <= SPLIT_MIN_FILE_SIZE)
+            {
+                bLocSplit = FALSE;
+            }
+            else if (++LogDecoder_u32SplitFilesNb > SPLIT_MAX_FILES_NUMBER)
+            {
+                LogDecoder_u32SplitFilesNb--;
+                bLocSplit = FALSE;
+            }
+            else
+            {
+                /* Split, the count is released once the file is decoded                          */
+            }
+        }
+        if (bLocSplit == TRUE)
+        {
+            u8LocParallelStatus = LogDecoder_u8ParallelDecode(&strLocContext, ptrLocCursor, ptrLocEnd, bLocRecords,
+                                                              &strLocWriter,
+                                                              (bLocBinaryOpened == TRUE) ? &strLocBinary : NULL,
+                                                              ptrJob->ptrSelect, ptrJob->ptrSummary, ptrJob->ptrStats,
+                                                              ptrJob->u32ThreadsNb, ptrJob->ptrPool, &u32RowNumber);
+            if (ptrJob->ptrPool != NULL)
+            {
+                LogDecoder_u32SplitFilesNb--;
+            }
+            if ((u8LocParallelStatus == PARALLEL_ROW_ERROR) && (bLocRecords == TRUE))
+            {
+                LogDecoder_vidStatsReject(ptrJob->ptrStats);
+                LogDecoder_vidMessage(ptrJob, "Incomplete record number %lu", (u32RowNumber + 1U));
+            }
+            else if (u8LocParallelStatus == PARALLEL_ROW_ERROR)
+            {
+                LogDecoder_vidStatsReject(ptrJob->ptrStats);
+                LogDecoder_vidMessage(ptrJob, "Missing data in row number %lu", (u32RowNumber + 2U));
+            }
+            else if (u8LocParallelStatus == PARALLEL_NO_MEMORY)
+            {
+                LogDecoder_vidMessage(ptrJob, "Not enough memory to decode on %lu threads", ptrJob->u32ThreadsNb);
+            }
+            else
+            {
+                /* The whole input is decoded                                                     */
+            }
+        }
+        else if (  (u8LocParseStatus == PARSER_ROW_OK)
+                && (LogDecoder_bBatchOpen(&strLocBatch, BATCH_FRAMES_NUMBER) == FALSE) )
+        {
+            LogDecoder_vidMessage(ptrJob, "Not enough memory to decode the input");
+        }
+        else if (  (u8LocParseStatus == PARSER_ROW_OK) && (ptrJob->u32ReorderWindow != 0U)
+                && (LogDecoder_bReorderOpen(&strLocReorder, BATCH_FRAMES_NUMBER, ptrJob->u32ReorderWindow,
+                                            ptrJob->bWrap16) == FALSE) )
+        {
+            LogDecoder_vidMessage(ptrJob, "Not enough memory to decode the input");
+            LogDecoder_vidBatchClose(&strLocBatch);
+        }
+        else if(u8LocParseStatus == PARSER_ROW_OK)
+        {
+            if (ptrJob->ptrStats != NULL)
+            {
+                /* Streamed input, decoded by this thread whatever the "-j" option                */
+                ptrJob->ptrStats->u32ThreadsNb = 1U;
+            }
+            /* Reading, decoding and writing overlap, the rows of a followed input are read here  */
+            /* and the other workers of the batch mode decode the other files                     */
+            if ((ptrJob->u32FollowLatency == 0U) && (ptrJob->ptrPool == NULL))
+            {
+                (void)LogDecoder_bInputStart(&strLocInput);
+                (void)LogDecoder_bWriterStart(&strLocWriter);
+            }
+            while (u8LocParseStatus != PARSER_END_OF_DATA)
+            {
+                /* Each stage runs over the whole batch : parse, validate, decode, write          */
+                strLocBatch.u32FramesNb = FALSE;
+                if (bLocRecords == TRUE)
+                {
+                    u8LocParseStatus = LogDecoder_u8RecordBatch(&ptrLocCursor, strLocInput.ptrEnd,
+                                                                strLocInput.bLastBlock, &strLocBatch);
+                }
+                else
+                {
+                    u8LocParseStatus = LogDecoder_u8ParseBatch(&ptrLocCursor, strLocInput.ptrEnd,
+                                                               strLocInput.bLastBlock, ptrJob->ptrSelect,
+                                                               &strLocBatch);
+                }
+                u32RowNumber += strLocBatch.u32FramesNb;
+                if (ptrJob->u32ReorderWindow != 0U)
+                {
+                    /* The held frames go with the last rows, they are lost on a read error       */
+                    bLocLastRows = (boolean)(  (u8LocParseStatus == PARSER_END_OF_DATA)
+                                            || (u8LocParseStatus == PARSER_ROW_ERROR)
+                                            || (LogDecoder_u64InputOffset(&strLocInput, ptrLocCursor)
+                                                    >= u64LocEndOffset) );
+                    ptrLocRows = LogDecoder_ptrReorderBatch(&strLocReorder, &strLocBatch, bLocLastRows);
+                }
+                LogDecoder_vidStatsLap(ptrJob->ptrStats, STATS_STAGE_PARSE);
+                /* All the rows are tracked, only the selected ones are decoded and written       */
+                LogDecoder_vidBatchValidate(&strLocContext, ptrLocRows);
+                LogDecoder_vidBatchSelect(ptrJob->ptrSelect, ptrLocRows);
+                LogDecoder_vidStatsLap(ptrJob->ptrStats, STATS_STAGE_VALIDATE);
+                /* Counting the frames is not part of any stage                                   */
+                LogDecoder_vidStatsBatch(ptrJob->ptrStats, &strLocContext, ptrLocRows);
+                LogDecoder_vidStatsStart(ptrJob->ptrStats);
+                LogDecoder_vidBatchDecode(&strLocContext, ptrLocRows);
+                LogDecoder_vidStatsLap(ptrJob->ptrStats, STATS_STAGE_DECODE);
+                if (bLocSummaryOpened == TRUE)
+                {
+                    LogDecoder_vidSummaryBatch(ptrJob->ptrSummary, strLocContext.ptrRegistry, ptrLocRows);
+                }
+                else if (bLocBinaryOpened == TRUE)
+                {
+                    LogDecoder_vidBinaryBatch(&strLocBinary, ptrLocRows);
+                }
+                else
+                {
+                    LogDecoder_vidWriterBatch(&strLocWriter, ptrLocRows);
+                }
+                if (ptrJob->u32FollowLatency != 0U)
+                {
+                    /* Followed input : the rows leave the buffer before the next poll of the file */
+                    (void)LogDecoder_bWriterFlush(&strLocWriter);
+                }
+                LogDecoder_vidStatsLap(ptrJob->ptrStats, STATS_STAGE_OUTPUT);
+
+                if (  ((u8LocParseStatus == PARSER_ROW_OK) || (u8LocParseStatus == PARSER_ROW_INCOMPLETE))
+                   && (LogDecoder_u64InputOffset(&strLocInput, ptrLocCursor) >= u64LocEndOffset) )
+                {
+                    /* No row of the time range after this point of the input                     */
+                    u8LocParseStatus = PARSER_END_OF_DATA;
+                }
+                else if (u8LocParseStatus == PARSER_ROW_OK)
+                {
+                    /* Full batch, continue with the next one                                     */
+                }
+                else if (  (u8LocParseStatus == PARSER_ROW_INCOMPLETE)
+                        && (LogDecoder_bInputRefill(&strLocInput, ptrLocCursor) == TRUE) )
+                {
+                    /* The partial row is now at the start of the new data window                 */
+                    ptrLocCursor = strLocInput.ptrBegin;
+                    LogDecoder_vidStatsLap(ptrJob->ptrStats, STATS_STAGE_INPUT);
+                }
+                else if ((u8LocParseStatus != PARSER_END_OF_DATA) && (bLocRecords == TRUE))
+                {
+                    /* Truncated last record                                                      */
+                    LogDecoder_vidStatsReject(ptrJob->ptrStats);
+                    LogDecoder_vidMessage(ptrJob, "Incomplete record number %lu", (u32RowNumber + 1U));
+                    break;
+                }
+                else if (u8LocParseStatus != PARSER_END_OF_DATA)
+                {
+                    /* Malformed row, or a row longer than the whole read block                   */
+                    LogDecoder_vidStatsReject(ptrJob->ptrStats);
+                    LogDecoder_vidMessage(ptrJob, "Missing data in row number %lu", (u32RowNumber + 2U));
+                    break;
+                }
+                else
+                {
+                    /* End of the input data                                                      */
+                }
+            }
+            LogDecoder_vidBatchClose(&strLocBatch);
+            if (ptrJob->u32ReorderWindow != 0U)
+            {
+                LogDecoder_vidReorderClose(&strLocReorder);
+            }
+        }
+        else if (u8LocRecordStatus == RECORD_HEADER_VERSION_ERROR)
+        {
+            LogDecoder_vidMessage(ptrJob, "Unsupported record file version");
+        }
+        else
+        {
+            LogDecoder_vidMessage(ptrJob, "First row must be in the following format :\n"
+                "ID,FrameNb,Timestamp,Payload,Checksum");
+        }
+
+        /* All the rows are accumulated, the summary is the whole output, the batch mode writes   */
+        /* the summaries of all the files at the end                                              */
+        if ((bLocSummaryOpened == TRUE) && (ptrJob->ptrOutputPath != NULL))
+        {
+            LogDecoder_vidSummaryWrite(ptrJob->ptrSummary, strLocContext.ptrRegistry, &strLocWriter);
+        }
+
+        /* Rows of an unknown frame ID are written empty, report them once                        */
+        if (strLocContext.u32InvalidFramesNb != 0U)
+        {
+            LogDecoder_vidMessage(ptrJob, "Invalid Frame ID (%lu frames)", strLocContext.u32InvalidFramesNb);
+        }
+    }
+
+    /* Close input and output Files                                                               */
+    if (bLocInputOpened == TRUE)
+    {
+        LogDecoder_vidInputClose(&strLocInput);
+    }
+    if (bLocBinaryOpened == TRUE)
+    {
+        /* The footer goes through the writer, before it is closed                                */
+        bLocWriteStatus = LogDecoder_bBinaryClose(&strLocBinary);
+    }
+    if (bLocWriterOpened == TRUE)
+    {
+        bLocWriteStatus = (boolean)((LogDecoder_bWriterClose(&strLocWriter) == TRUE) && (bLocWriteStatus == TRUE));
+    }
+    if (bLocWriteStatus == FALSE)
+    {
+        LogDecoder_vidMessage(ptrJob, "Unable to write the output file");
+    }
+    if ((bLocInputOpened == TRUE) && (bLocWriterOpened == TRUE))
+    {
+        /* The last flush of the writer is part of the output stage                               */
+        LogDecoder_vidStatsLap(ptrJob->ptrStats, STATS_STAGE_OUTPUT);
+        LogDecoder_vidStatsEnd(ptrJob->ptrStats, &strLocContext);
+        if (ptrJob->ptrPool == NULL)
+        {
+            LogDecoder_vidStatsPrint(ptrJob->ptrStats, stderr, ptrJob->bStatsJson);
+        }
+    }
+    LogDecoder_vidOutputClose(LocOutputFile);
+
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32DecodeBatchFile                                                                       */
+/* !Description : Decode one file of the batch mode (pool job). With "--summary" the totals of the file are added to  */
+/*                those of all the files and only its summary rows are kept, the accumulators of thousands of files   */
+/*                would not fit in memory.                                                                            */
+/*                                                                                                                    */
+/* !Inputs      : ptrArgument                   !Comment : File to be decoded (LogDecoder_strJobType)                 */
+/* !Outputs     : ptrArgument                   !Comment : Summary rows of the file                                   */
+/*                s32LocStatus                  !Comment : Task exit code, always 0, the errors are printed           */
+/* !Number      : 11                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32DecodeBatchFile(void *ptrArgument)
+{
+    LogDecoder_strJobType *ptrJob = (LogDecoder_strJobType *)ptrArgument;
+    const LogDecoder_strRegistryType *ptrLocRegistry = (ptrJob->ptrRegistry != NULL) ? ptrJob->ptrRegistry
+                                                                                      : LogDecoder_ptrDefaultRegistry();
+    LogDecoder_strWriterType strLocRows = {FALSE};
+
+    if (ptrJob->ptrOutputPath != NULL)
+    {
+        return LogDecoder_s32DecodeFile(ptrJob);
+    }
+
+    ptrJob->ptrSummary = malloc(sizeof(LogDecoder_strSummaryType));
+    if (ptrJob->ptrSummary == NULL)
+    {
+        LogDecoder_vidMessage(ptrJob, "Not enough memory to decode the input");
+        return 0;
+    }
+    LogDecoder_vidSummaryInit(ptrJob->ptrSummary);
+    (void)LogDecoder_s32DecodeFile(ptrJob);
+
+    if (LogDecoder_bWriterOpen(&strLocRows, NULL, FRAME_IDS_NUMBER * (SUMMARY_ROW_MAX_LENGTH
+                                                                     + strlen(ptrJob->ptrSummaryPrefix))) == TRUE)
+    {
+        LogDecoder_vidSummaryRows(ptrJob->ptrSummary, ptrLocRegistry, ptrJob->ptrSummaryPrefix, &strLocRows);
+        ptrJob->ptrSummaryRows = malloc(strLocRows.u32Used + 1U);
+        if (ptrJob->ptrSummaryRows != NULL)
+        {
+            memcpy(ptrJob->ptrSummaryRows, strLocRows.ptrBuffer, strLocRows.u32Used);
+            ptrJob->u32SummaryRowsSize = strLocRows.u32Used;
+        }
+        (void)LogDecoder_bWriterClose(&strLocRows);
+    }
+    if (ptrJob->ptrSummaryRows == NULL)
+    {
+        LogDecoder_vidMessage(ptrJob, "Not enough memory to keep the summary");
+    }
+
+    /* Different files : their totals are added, no period or drop is counted between them        */
+#ifdef PIPELINE_THREADS
+    (void)mtx_lock(&LogDecoder_strSummaryMutex);
+#endif
+    LogDecoder_vidSummaryMerge(&LogDecoder_strSummary, ptrJob->ptrSummary, ptrLocRegistry, FALSE);
+#ifdef PIPELINE_THREADS
+    (void)mtx_unlock(&LogDecoder_strSummaryMutex);
+#endif
+    free(ptrJob->ptrSummary);
+    ptrJob->ptrSummary = NULL;
+
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrConcat                                                                                */
+/* !Description : Join three strings into a new one                                                                   */
+/*                                                                                                                    */
+/* !Inputs      : ptrFirst                      !Comment : First string                                               */
+/*                ptrSecond                     !Comment : Second string                                              */
+/*                ptrThird                      !Comment : Third string                                               */
+/* !Outputs     : ptrLocText                    !Comment : Joined string to be freed, NULL without memory             */
+/* !Number      : 12                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static char *LogDecoder_ptrConcat(const char *ptrFirst, const char *ptrSecond, const char *ptrThird)
+{
+    size_t u32LocFirstLength = strlen(ptrFirst);
+    size_t u32LocSecondLength = strlen(ptrSecond);
+    size_t u32LocThirdLength = strlen(ptrThird);
+    char *ptrLocText = malloc(u32LocFirstLength + u32LocSecondLength + u32LocThirdLength + 1U);
+
+    if (ptrLocText != NULL)
+    {
+        memcpy(ptrLocText, ptrFirst, u32LocFirstLength);
+        memcpy(&ptrLocText[u32LocFirstLength], ptrSecond, u32LocSecondLength);
+        memcpy(&ptrLocText[u32LocFirstLength + u32LocSecondLength], ptrThird, u32LocThirdLength + 1U);
+    }
+
+    return ptrLocText;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bFileListAdd                                                                             */
+/* !Description : Append a path to the input files of the batch mode                                                  */
+/*                                                                                                                    */
+/* !Inputs      : ptrList                       !Comment : Input files so far                                         */
+/*                ptrDirectory                  !Comment : Directory of the file, NULL when ptrName is the path       */
+/*                ptrName                       !Comment : Name of the file                                           */
+/* !Outputs     : ptrList                       !Comment : Input files, with the new one                              */
+/*                bLocStatus                    !Comment : FALSE without memory                                       */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 13                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bFileListAdd(LogDecoder_strFileListType *ptrList, const char *ptrDirectory,
+                                       const char *ptrName)
+{
+    char **aptrLocPath = NULL;
+    char *ptrLocPath = NULL;
+
+    if (ptrList->u32FilesNb == ptrList->u32Capacity)
+    {
+        aptrLocPath = realloc(ptrList->aptrPath, (2U * ptrList->u32Capacity + 16U) * sizeof(char *));
+        if (aptrLocPath == NULL)
+        {
+            return FALSE;
+        }
+        ptrList->aptrPath    = aptrLocPath;
+        ptrList->u32Capacity = 2U * ptrList->u32Capacity + 16U;
+    }
+    ptrLocPath = (ptrDirectory != NULL) ? LogDecoder_ptrConcat(ptrDirectory, "/", ptrName)
+                                        : LogDecoder_ptrConcat(ptrName, "", "");
+    if (ptrLocPath == NULL)
+    {
+        return FALSE;
+    }
+    ptrList->aptrPath[ptrList->u32FilesNb] = ptrLocPath;
+    ptrList->u32FilesNb++;
+
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bFileListFill                                                                            */
+/* !Description : List the input files of the batch mode : the .csv files of a directory, or the files matching a     */
+/*                glob pattern. Without POSIX directories and glob the pattern is the path of a single file.          */
+/*                                                                                                                    */
+/* !Inputs      : ptrPattern                    !Comment : Directory or glob pattern of "--batch"                     */
+/* !Outputs     : ptrList                       !Comment : Regular files found, not sorted                            */
+/*                bLocStatus                    !Comment : FALSE without memory                                       */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 14                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bFileListFill(LogDecoder_strFileListType *ptrList, const char *ptrPattern)
+{
+    boolean bLocStatus = TRUE;
+#ifdef CLI_POSIX_FILES
+    struct stat strLocStat;
+    DIR *ptrLocDirectory = NULL;
+    struct dirent *ptrLocEntry = NULL;
+    glob_t strLocGlob;
+    size_t u32LocLength = FALSE;
+    size_t u32LocIndex = FALSE;
+
+    if ((stat(ptrPattern, &strLocStat) == 0) && (S_ISDIR(strLocStat.st_mode)))
+    {
+        ptrLocDirectory = opendir(ptrPattern);
+        while (  (ptrLocDirectory != NULL) && (bLocStatus == TRUE)
+              && ((ptrLocEntry = readdir(ptrLocDirectory)) != NULL) )
+        {
+            u32LocLength = strlen(ptrLocEntry->d_name);
+            if (  (u32LocLength > (sizeof(BATCH_INPUT_EXTENSION) - 1U))
+               && (strcmp(&ptrLocEntry->d_name[u32LocLength - (sizeof(BATCH_INPUT_EXTENSION) - 1U)],
+                          BATCH_INPUT_EXTENSION) == 0) )
+            {
+                bLocStatus = LogDecoder_bFileListAdd(ptrList, ptrPattern, ptrLocEntry->d_name);
+                /* Only the regular files, not the directories or the devices named .csv          */
+                if (  (bLocStatus == TRUE)
+                   && (  (stat(ptrList->aptrPath[ptrList->u32FilesNb - 1U], &strLocStat) != 0)
+                      || (!S_ISREG(strLocStat.st_mode)) ) )
+                {
+                    ptrList->u32FilesNb--;
+                    free(ptrList->aptrPath[ptrList->u32FilesNb]);
+                }
+            }
+        }
+        if (ptrLocDirectory != NULL)
+        {
+            (void)closedir(ptrLocDirectory);
+        }
+    }
+    else if (glob(ptrPattern, 0, NULL, &strLocGlob) == 0)
+    {
+        for (u32LocIndex = 0U; (u32LocIndex < strLocGlob.gl_pathc) && (bLocStatus == TRUE); u32LocIndex++)
+        {
+            if ((stat(strLocGlob.gl_pathv[u32LocIndex], &strLocStat) == 0) && (S_ISREG(strLocStat.st_mode)))
+            {
+                bLocStatus = LogDecoder_bFileListAdd(ptrList, NULL, strLocGlob.gl_pathv[u32LocIndex]);
+            }
+        }
+        globfree(&strLocGlob);
+    }
+    else
+    {
+        /* Nothing matches the pattern                                                            */
+    }
+#else
+    bLocStatus = LogDecoder_bFileListAdd(ptrList, NULL, ptrPattern);
+#endif
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32ComparePath                                                                           */
+/* !Description : qsort order of the batch input paths, the order of the summary rows                                 */
+/*                                                                                                                    */
+/* !Inputs      : ptrFirst                      !Comment : First path (pointer to char *)                             */
+/*                ptrSecond                     !Comment : Second path (pointer to char *)                            */
+/* !Outputs     : s32LocOrder                   !Comment : Negative, 0 or positive as in strcmp                       */
+/* !Number      : 15                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32ComparePath(const void *ptrFirst, const void *ptrSecond)
+{
+    return strcmp(*(const char * const *)ptrFirst, *(const char * const *)ptrSecond);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32CompareOutput                                                                         */
+/* !Description : qsort order of the batch files by output path, to find two inputs with the same name                */
+/*                                                                                                                    */
+/* !Inputs      : ptrFirst                      !Comment : First file (pointer to LogDecoder_strJobType)              */
+/*                ptrSecond                     !Comment : Second file (pointer to LogDecoder_strJobType)             */
+/* !Outputs     : s32LocOrder                   !Comment : Negative, 0 or positive as in strcmp                       */
+/* !Number      : 16                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32CompareOutput(const void *ptrFirst, const void *ptrSecond)
+{
+    return strcmp((*(const LogDecoder_strJobType * const *)ptrFirst)->ptrOutputPath,
+                  (*(const LogDecoder_strJobType * const *)ptrSecond)->ptrOutputPath);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32CompareSize                                                                           */
+/* !Description : qsort order of the batch files, the largest first : the last files to end are small ones            */
+/*                                                                                                                    */
+/* !Inputs      : ptrFirst                      !Comment : First file (pointer to LogDecoder_strJobType)              */
+/*                ptrSecond                     !Comment : Second file (pointer to LogDecoder_strJobType)             */
+/* !Outputs     : s32LocOrder                   !Comment : Negative when the first file is the largest                */
+/* !Number      : 17                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32CompareSize(const void *ptrFirst, const void *ptrSecond)
+{
+    uint64 u64LocFirstSize = (*(const LogDecoder_strJobType * const *)ptrFirst)->u64InputSize;
+    uint64 u64LocSecondSize = (*(const LogDecoder_strJobType * const *)ptrSecond)->u64InputSize;
+
+    return (u64LocFirstSize > u64LocSecondSize) ? -1 : ((u64LocFirstSize < u64LocSecondSize) ? 1 : 0);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrCsvField                                                                              */
+/* !Description : File column of the batch summary rows or Source column of the merged rows : the input path and the */
+/*                separator, the path quoted when asked or when it holds a separator or a quote                       */
+/*                                                                                                                    */
+/* !Inputs      : ptrPath                       !Comment : Input path                                                 */
+/*                ptrSeparator                  !Comment : Separator written after the path                           */
+/*                bQuoted                       !Comment : TRUE to quote the path even without separator or quote     */
+/* !Outputs     : ptrLocField                   !Comment : Column to be freed, NULL without memory                    */
+/* !Number      : 18                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static char *LogDecoder_ptrCsvField(const char *ptrPath, const char *ptrSeparator, boolean bQuoted)
+{
+    char *ptrLocField = NULL;
+    size_t u32LocLength = FALSE;
+
+    if ((bQuoted == FALSE) && (strpbrk(ptrPath, ",\"\r\n") == NULL))
+    {
+        ptrLocField = LogDecoder_ptrConcat(ptrPath, ptrSeparator, "");
+    }
+    else
+    {
+        /* Every quote is doubled, the worst case doubles the path                                */
+        ptrLocField = malloc(2U * strlen(ptrPath) + strlen(ptrSeparator) + 3U);
+        if (ptrLocField != NULL)
+        {
+            ptrLocField[u32LocLength++] = '"';
+            for (; *ptrPath != '\0'; ptrPath++)
+            {
+                if (*ptrPath == '"')
+                {
+                    ptrLocField[u32LocLength++] = '"';
+                }
+                ptrLocField[u32LocLength++] = *ptrPath;
+            }
+            ptrLocField[u32LocLength++] = '"';
+            memcpy(&ptrLocField[u32LocLength], ptrSeparator, strlen(ptrSeparator) + 1U);
+        }
+    }
+
+    return ptrLocField;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidDecodeBatch                                                                           */
+/* !Description : Decode every file of a directory or of a glob pattern into the output directory, on a pool of       */
+/*                workers. Each file has its own decoder state and output file of the same name, the files are        */
+/*                started largest first and a large one is split into chunks shared by the idle workers. With         */
+/*                "--summary" nothing is decoded to the output directory but summary.csv : the summary rows of every  */
+/*                file, then those of all the files together with an empty file column.                               */
+/*                                                                                                                    */
+/* !Inputs      : ptrTemplate                   !Comment : Options of the command line, statistics and summary of     */
+/*                                                         all the files                                              */
+/*                ptrPattern                    !Comment : Directory of .csv files, or glob pattern                   */
+/*                ptrOutputDirectory            !Comment : Directory of the output files, created if missing          */
+/*                u32WorkersNb                  !Comment : Number of workers                                          */
+/*                                              !Range   : [1, POOL_MAX_WORKERS]                                      */
+/* !Number      : 19                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidDecodeBatch(const LogDecoder_strJobType *ptrTemplate, const char *ptrPattern,
+                                      const char *ptrOutputDirectory, uint32 u32WorkersNb)
+{
+    LogDecoder_strFileListType strLocList = {NULL};
+    LogDecoder_strJobType *ptrLocJobs = NULL;
+    LogDecoder_strJobType **aptrLocOrder = NULL;
+    LogDecoder_strTaskType *ptrLocTasks = NULL;
+    LogDecoder_strJobType *ptrLocJob = NULL;
+    LogDecoder_strWriterType strLocWriter = {FALSE};
+    FILE   *LocOutputFile = NULL;
+    char   *ptrLocPath = NULL;
+    const char *ptrLocName = NULL;
+    size_t  u32LocLength = FALSE;
+    size_t  u32LocIndex = FALSE;
+    boolean bLocStatus = TRUE;
+#ifdef CLI_POSIX_FILES
+    struct stat strLocInputStat;
+#endif
+
+    LogDecoder_vidStatsInit(ptrTemplate->ptrStats, u32WorkersNb);
+    if (LogDecoder_bFileListFill(&strLocList, ptrPattern) == FALSE)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Not enough memory to list the input files");
+        bLocStatus = FALSE;
+    }
+    else if (strLocList.u32FilesNb == 0U)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "No input file found");
+        bLocStatus = FALSE;
+    }
+#ifdef CLI_POSIX_FILES
+    else if ((mkdir(ptrOutputDirectory, 0777) != 0) && (errno != EEXIST))
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Unable to create the output directory");
+        bLocStatus = FALSE;
+    }
+#endif
+    else
+    {
+        ptrLocJobs   = calloc(strLocList.u32FilesNb, sizeof(LogDecoder_strJobType));
+        aptrLocOrder = malloc(strLocList.u32FilesNb * sizeof(LogDecoder_strJobType *));
+        ptrLocTasks  = malloc(strLocList.u32FilesNb * sizeof(LogDecoder_strTaskType));
+        bLocStatus   = (boolean)((ptrLocJobs != NULL) && (aptrLocOrder != NULL) && (ptrLocTasks != NULL));
+    }
+
+    /* One job per file, in the order of the paths : the order of the summary rows                */
+    if (bLocStatus == TRUE)
+    {
+        qsort(strLocList.aptrPath, strLocList.u32FilesNb, sizeof(char *), LogDecoder_s32ComparePath);
+    }
+    for (u32LocIndex = 0U; (u32LocIndex < strLocList.u32FilesNb) && (bLocStatus == TRUE); u32LocIndex++)
+    {
+        ptrLocJob  = &ptrLocJobs[u32LocIndex];
+        *ptrLocJob = *ptrTemplate;
+        ptrLocJob->ptrInputPath     = strLocList.aptrPath[u32LocIndex];
+        ptrLocJob->ptrMessagePrefix = LogDecoder_ptrConcat(ptrLocJob->ptrInputPath, ": ", "");
+        ptrLocJob->ptrMessageEnd    = "\n";
+        ptrLocJob->ptrStats         = (ptrTemplate->ptrStats != NULL) ? &ptrLocJob->strStats : NULL;
+        ptrLocJob->ptrPool          = &LogDecoder_strPool;
+        ptrLocJob->u32ThreadsNb     = u32WorkersNb;
+        ptrLocJob->ptrSummary       = NULL;
+        bLocStatus = (boolean)(ptrLocJob->ptrMessagePrefix != NULL);
+#ifdef CLI_POSIX_FILES
+        if (stat(ptrLocJob->ptrInputPath, &strLocInputStat) == 0)
+        {
+            ptrLocJob->u64InputSize = (uint64)strLocInputStat.st_size;
+        }
+#endif
+        if ((bLocStatus == TRUE) && (ptrTemplate->ptrSummary != NULL))
+        {
+            ptrLocJob->ptrSummaryPrefix = LogDecoder_ptrCsvField(ptrLocJob->ptrInputPath, ",", FALSE);
+            bLocStatus = (boolean)(ptrLocJob->ptrSummaryPrefix != NULL);
+        }
+        else if (bLocStatus == TRUE)
+        {
+            /* Output file of the same name, .bin in place of .csv for the binary output, and .ldz */
+            /* added for the compressed output                                                    */
+            ptrLocName = strrchr(ptrLocJob->ptrInputPath, '/');
+            ptrLocName = (ptrLocName != NULL) ? (ptrLocName + 1) : ptrLocJob->ptrInputPath;
+            ptrLocJob->ptrOutputPath = LogDecoder_ptrConcat(ptrOutputDirectory, "/", ptrLocName);
+            u32LocLength = (ptrLocJob->ptrOutputPath != NULL) ? strlen(ptrLocJob->ptrOutputPath) : 0U;
+            if (  (ptrTemplate->bBinaryOutput == TRUE) && (u32LocLength >= (sizeof(BATCH_INPUT_EXTENSION) - 1U))
+               && (strcmp(&ptrLocJob->ptrOutputPath[u32LocLength - (sizeof(BATCH_INPUT_EXTENSION) - 1U)],
+                          BATCH_INPUT_EXTENSION) == 0) )
+            {
+                memcpy(&ptrLocJob->ptrOutputPath[u32LocLength - (sizeof(BATCH_INPUT_EXTENSION) - 1U)],
+                       BATCH_BINARY_EXTENSION, sizeof(BATCH_BINARY_EXTENSION));
+            }
+            else if ((ptrTemplate->bBinaryOutput == TRUE) && (ptrLocJob->ptrOutputPath != NULL))
+            {
+                ptrLocPath = ptrLocJob->ptrOutputPath;
+                ptrLocJob->ptrOutputPath = LogDecoder_ptrConcat(ptrLocPath, BATCH_BINARY_EXTENSION, "");
+                free(ptrLocPath);
+            }
+            else
+            {
+                /* Same name as the input file                                                    */
+            }
+            if ((ptrTemplate->bCompress == TRUE) && (ptrLocJob->ptrOutputPath != NULL))
+            {
+                /* The compressed output is not a .csv or .bin file any more                      */
+                ptrLocPath = ptrLocJob->ptrOutputPath;
+                ptrLocJob->ptrOutputPath = LogDecoder_ptrConcat(ptrLocPath, BATCH_COMPRESS_EXTENSION, "");
+                free(ptrLocPath);
+            }
+            bLocStatus = (boolean)(ptrLocJob->ptrOutputPath != NULL);
+        }
+        else
+        {
+            /* Not enough memory                                                                  */
+        }
+        aptrLocOrder[u32LocIndex] = ptrLocJob;
+    }
+    if ((bLocStatus == FALSE) && (ptrLocJobs != NULL))
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Not enough memory to decode the input files");
+    }
+
+    /* Two inputs of the same name would be written to the same output file                       */
+    if ((bLocStatus == TRUE) && (ptrTemplate->ptrSummary == NULL))
+    {
+        qsort(aptrLocOrder, strLocList.u32FilesNb, sizeof(LogDecoder_strJobType *), LogDecoder_s32CompareOutput);
+        for (u32LocIndex = 0U; (u32LocIndex < strLocList.u32FilesNb) && (bLocStatus == TRUE); u32LocIndex++)
+        {
+            if (  (u32LocIndex > 0U)
+               && (strcmp(aptrLocOrder[u32LocIndex - 1U]->ptrOutputPath,
+                          aptrLocOrder[u32LocIndex]->ptrOutputPath) == 0) )
+            {
+                fprintf(LogDecoder_ptrMessageFile, "Two input files are named as the output file %s",
+                        aptrLocOrder[u32LocIndex]->ptrOutputPath);
+                bLocStatus = FALSE;
+            }
+            else if (LogDecoder_bSameFile(aptrLocOrder[u32LocIndex]->ptrInputPath,
+                                          aptrLocOrder[u32LocIndex]->ptrOutputPath) == TRUE)
+            {
+                fprintf(LogDecoder_ptrMessageFile, "The output file %s is the input file",
+                        aptrLocOrder[u32LocIndex]->ptrOutputPath);
+                bLocStatus = FALSE;
+            }
+            else
+            {
+                /* Output file of its own                                                         */
+            }
+        }
+    }
+
+#ifdef PIPELINE_THREADS
+    if ((bLocStatus == TRUE) && (mtx_init(&LogDecoder_strSummaryMutex, mtx_plain) != thrd_success))
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Unable to start the workers");
+        bLocStatus = FALSE;
+    }
+#endif
+    if (bLocStatus == TRUE)
+    {
+        /* The largest files first, the last files to end are the small ones                      */
+        qsort(aptrLocOrder, strLocList.u32FilesNb, sizeof(LogDecoder_strJobType *), LogDecoder_s32CompareSize);
+        for (u32LocIndex = 0U; u32LocIndex < strLocList.u32FilesNb; u32LocIndex++)
+        {
+            ptrLocTasks[u32LocIndex].ptrFunction = LogDecoder_s32DecodeBatchFile;
+            ptrLocTasks[u32LocIndex].ptrArgument = aptrLocOrder[u32LocIndex];
+            ptrLocTasks[u32LocIndex].ptrPending  = NULL;
+        }
+        LogDecoder_vidPoolRun(&LogDecoder_strPool, ptrLocTasks, strLocList.u32FilesNb, u32WorkersNb);
+#ifdef PIPELINE_THREADS
+        mtx_destroy(&LogDecoder_strSummaryMutex);
+#endif
+
+        if (ptrTemplate->ptrStats != NULL)
+        {
+            for (u32LocIndex = 0U; u32LocIndex < strLocList.u32FilesNb; u32LocIndex++)
+            {
+                LogDecoder_vidStatsMerge(ptrTemplate->ptrStats, &ptrLocJobs[u32LocIndex].strStats);
+            }
+            ptrTemplate->ptrStats->u64TotalTime = LogDecoder_u64StatsClock() - ptrTemplate->ptrStats->u64StartTime;
+            LogDecoder_vidStatsPrint(ptrTemplate->ptrStats, stderr, ptrTemplate->bStatsJson);
+        }
+    }
+
+    /* Summary rows of every file in the order of the paths, then the totals of all the files     */
+    if ((bLocStatus == TRUE) && (ptrTemplate->ptrSummary != NULL))
+    {
+        ptrLocPath    = LogDecoder_ptrConcat(ptrOutputDirectory, "/", (ptrTemplate->bCompress == TRUE)
+                                                                      ? BATCH_SUMMARY_FILE BATCH_COMPRESS_EXTENSION
+                                                                      : BATCH_SUMMARY_FILE);
+        LocOutputFile = (ptrLocPath != NULL)
+                      ? LogDecoder_ptrOutputOpen(ptrLocPath, (ptrTemplate->bCompress == TRUE) ? "wb" : "w") : NULL;
+        bLocStatus    = (boolean)(  (LocOutputFile != NULL)
+                                 && (LogDecoder_bWriterOpen(&strLocWriter, LocOutputFile,
+                                                            WRITER_BUFFER_SIZE) == TRUE)
+                                 && (  (ptrTemplate->bCompress == FALSE)
+                                    || (LogDecoder_bWriterCompress(&strLocWriter) == TRUE) ) );
+        if (bLocStatus == TRUE)
+        {
+            LogDecoder_vidWriterText(&strLocWriter, BATCH_SUMMARY_COLUMN, sizeof(BATCH_SUMMARY_COLUMN) - 1U);
+            LogDecoder_vidWriterText(&strLocWriter, HEADER_FOR_SUMMARY_FILE, sizeof(HEADER_FOR_SUMMARY_FILE) - 1U);
+            for (u32LocIndex = 0U; u32LocIndex < strLocList.u32FilesNb; u32LocIndex++)
+            {
+                if (ptrLocJobs[u32LocIndex].ptrSummaryRows != NULL)
+                {
+                    LogDecoder_vidWriterText(&strLocWriter, ptrLocJobs[u32LocIndex].ptrSummaryRows,
+                                             ptrLocJobs[u32LocIndex].u32SummaryRowsSize);
+                }
+            }
+            LogDecoder_vidSummaryRows(ptrTemplate->ptrSummary,
+                                      (ptrTemplate->ptrRegistry != NULL) ? ptrTemplate->ptrRegistry
+                                                                         : LogDecoder_ptrDefaultRegistry(),
+                                      ",", &strLocWriter);
+            bLocStatus = LogDecoder_bWriterClose(&strLocWriter);
+        }
+        if (bLocStatus == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Unable to write the summary file");
+        }
+        LogDecoder_vidOutputClose(LocOutputFile);
+        free(ptrLocPath);
+    }
+
+    for (u32LocIndex = 0U; (ptrLocJobs != NULL) && (u32LocIndex < strLocList.u32FilesNb); u32LocIndex++)
+    {
+        free((char *)ptrLocJobs[u32LocIndex].ptrMessagePrefix);
+        free(ptrLocJobs[u32LocIndex].ptrOutputPath);
+        free(ptrLocJobs[u32LocIndex].ptrSummaryPrefix);
+        free(ptrLocJobs[u32LocIndex].ptrSummaryRows);
+    }
+    for (u32LocIndex = 0U; u32LocIndex < strLocList.u32FilesNb; u32LocIndex++)
+    {
+        free(strLocList.aptrPath[u32LocIndex]);
+    }
+    free(strLocList.aptrPath);
+    free(ptrLocJobs);
+    free(aptrLocOrder);
+    free(ptrLocTasks);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidDecodeMerge                                                                           */
+/* !Description : Merge every file of a directory or of a glob pattern by Timestamp and decode the merged rows to a   */
+/*                single output file, each row starting with the Source column : the path of its input file. The      */
+/*                inputs are merged on the fly, only a few rows of each of them are in memory at any time. The        */
+/*                merged rows are validated as one log, like the frames of several channels recorded together.        */
+/*                                                                                                                    */
+/* !Inputs      : ptrTemplate                   !Comment : Options of the command line                                */
+/*                ptrPattern                    !Comment : Directory of .csv files, or glob pattern                   */
+/*                ptrOutputPath                 !Comment : Output file, "-" for stdout                                */
+/* !Number      : 20                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidDecodeMerge(const LogDecoder_strJobType *ptrTemplate, const char *ptrPattern,
+                                      const char *ptrOutputPath)
+{
+    LogDecoder_strFileListType strLocList = {NULL};
+    LogDecoder_strMergeType strLocMerge = {NULL};
+    const LogDecoder_strMergeSourceType *ptrLocSource = NULL;
+    char  **aptrLocSource = NULL;
+    FILE   *LocOutputFile = NULL;
+    LogDecoder_strWriterType strLocWriter = {FALSE};
+    LogDecoder_strContextType strLocContext;
+    LogDecoder_strBatchType strLocBatch;
+    LogDecoder_strReorderType strLocReorder = {NULL};
+    LogDecoder_strBatchType *ptrLocRows = &strLocBatch;
+    boolean bLocMergeOpened = FALSE;
+    boolean bLocWriterOpened = FALSE;
+    boolean bLocStatus = TRUE;
+    uint8   u8LocMergeStatus = MERGE_OPEN_OK;
+    uint8   u8LocParseStatus = PARSER_ROW_OK;
+    size_t  u32LocIndex = FALSE;
+
+    LogDecoder_vidStatsInit(ptrTemplate->ptrStats, 1U);
+    if (LogDecoder_bFileListFill(&strLocList, ptrPattern) == FALSE)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "Not enough memory to list the input files");
+        bLocStatus = FALSE;
+    }
+    else if (strLocList.u32FilesNb == 0U)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "No input file found");
+        bLocStatus = FALSE;
+    }
+    else if (strLocList.u32FilesNb > MERGE_MAX_SOURCES)
+    {
+        fprintf(LogDecoder_ptrMessageFile, "At most %lu input files can be merged", MERGE_MAX_SOURCES);
+        bLocStatus = FALSE;
+    }
+    else
+    {
+        /* Source column of every input, in the order of the paths : the order of equal Timestamps */
+        qsort(strLocList.aptrPath, strLocList.u32FilesNb, sizeof(char *), LogDecoder_s32ComparePath);
+        aptrLocSource = calloc(strLocList.u32FilesNb, sizeof(char *));
+        bLocStatus    = (boolean)(aptrLocSource != NULL);
+        for (u32LocIndex = 0U; (u32LocIndex < strLocList.u32FilesNb) && (bLocStatus == TRUE); u32LocIndex++)
+        {
+            aptrLocSource[u32LocIndex] = LogDecoder_ptrCsvField(strLocList.aptrPath[u32LocIndex],
+                                                                MERGE_SOURCE_SEPARATOR, TRUE);
+            bLocStatus = (boolean)(aptrLocSource[u32LocIndex] != NULL);
+        }
+        if (bLocStatus == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Not enough memory to merge the input files");
+        }
+    }
+
+    /* Open every input, check its header and read its first rows                                 */
+    if (bLocStatus == TRUE)
+    {
+        u8LocMergeStatus = LogDecoder_u8MergeOpen(&strLocMerge, (const char * const *)strLocList.aptrPath,
+                                                  (uint32)strLocList.u32FilesNb, ptrTemplate->ptrSelect,
+                                                  ptrTemplate->bWrap16);
+        bLocMergeOpened  = (boolean)(u8LocMergeStatus == MERGE_OPEN_OK);
+        if (u8LocMergeStatus == MERGE_OPEN_ERROR)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Unable to open the input file %s",
+                    strLocList.aptrPath[strLocMerge.u32ErrorSource]);
+        }
+        else if (u8LocMergeStatus == MERGE_HEADER_ERROR)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "%s: First row must be in the following format :\n"
+                    "ID,FrameNb,Timestamp,Payload,Checksum", strLocList.aptrPath[strLocMerge.u32ErrorSource]);
+        }
+        else if (u8LocMergeStatus == MERGE_VERSION_ERROR)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "%s: Unsupported record file version",
+                    strLocList.aptrPath[strLocMerge.u32ErrorSource]);
+        }
+        else if (u8LocMergeStatus == MERGE_NO_MEMORY)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Not enough memory to merge the input files");
+        }
+        else
+        {
+            /* Every input is ready                                                               */
+        }
+    }
+    LogDecoder_vidStatsLap(ptrTemplate->ptrStats, STATS_STAGE_INPUT);
+
+    /* The output is not opened over an input it would truncate                                   */
+    for (u32LocIndex = 0U; (u32LocIndex < strLocList.u32FilesNb) && (bLocMergeOpened == TRUE); u32LocIndex++)
+    {
+        if (LogDecoder_bSameFile(strLocList.aptrPath[u32LocIndex], ptrOutputPath) == TRUE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "The output file %s is the input file", ptrOutputPath);
+            bLocStatus = FALSE;
+            break;
+        }
+    }
+    if ((bLocMergeOpened == TRUE) && (bLocStatus == TRUE))
+    {
+        LocOutputFile    = LogDecoder_ptrOutputOpen(ptrOutputPath, (ptrTemplate->bCompress == TRUE) ? "wb" : "w");
+        bLocWriterOpened = (boolean)(  (LocOutputFile != NULL)
+                                    && (LogDecoder_bWriterOpen(&strLocWriter, LocOutputFile,
+                                                               WRITER_BUFFER_SIZE) == TRUE)
+                                    && (  (ptrTemplate->bCompress == FALSE)
+                                       || (LogDecoder_bWriterCompress(&strLocWriter) == TRUE) ) );
+        if (bLocWriterOpened == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Unable to open the output file");
+        }
+    }
+    if (bLocWriterOpened == TRUE)
+    {
+        LogDecoder_vidInit(&strLocContext);
+        if (ptrTemplate->ptrRegistry != NULL)
+        {
+            LogDecoder_vidSetRegistry(&strLocContext, ptrTemplate->ptrRegistry);
+        }
+        LogDecoder_vidSetWrap16(&strLocContext, ptrTemplate->bWrap16);
+        if (ptrTemplate->ptrSummary == NULL)
+        {
+            LogDecoder_vidWriterText(&strLocWriter, MERGE_SOURCE_COLUMN, sizeof(MERGE_SOURCE_COLUMN) - 1U);
+            LogDecoder_vidWriterText(&strLocWriter, HEADER_FOR_OUTPUT_FILE, sizeof(HEADER_FOR_OUTPUT_FILE) - 1U);
+        }
+        LogDecoder_vidStatsLap(ptrTemplate->ptrStats, STATS_STAGE_OUTPUT);
+
+        if (LogDecoder_bBatchOpen(&strLocBatch, BATCH_FRAMES_NUMBER) == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Not enough memory to decode the input");
+            u8LocParseStatus = PARSER_END_OF_DATA;
+        }
+        else if (  (ptrTemplate->u32ReorderWindow != 0U)
+                && (LogDecoder_bReorderOpen(&strLocReorder, BATCH_FRAMES_NUMBER, ptrTemplate->u32ReorderWindow,
+                                            ptrTemplate->bWrap16) == FALSE) )
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Not enough memory to decode the input");
+            u8LocParseStatus = PARSER_END_OF_DATA;
+        }
+        else
+        {
+            /* The inputs are read by this thread, the writing overlaps the merge and the decoding */
+            (void)LogDecoder_bWriterStart(&strLocWriter);
+        }
+        while (u8LocParseStatus == PARSER_ROW_OK)
+        {
+            /* Each stage runs over the whole batch : merge, validate, decode, write              */
+            strLocBatch.u32FramesNb = FALSE;
+            u8LocParseStatus = LogDecoder_u8MergeBatch(&strLocMerge, &strLocBatch);
+            if (ptrTemplate->u32ReorderWindow != 0U)
+            {
+                ptrLocRows = LogDecoder_ptrReorderBatch(&strLocReorder, &strLocBatch,
+                                                        (boolean)(u8LocParseStatus != PARSER_ROW_OK));
+            }
+            LogDecoder_vidStatsLap(ptrTemplate->ptrStats, STATS_STAGE_PARSE);
+            LogDecoder_vidBatchValidate(&strLocContext, ptrLocRows);
+            LogDecoder_vidBatchSelect(ptrTemplate->ptrSelect, ptrLocRows);
+            LogDecoder_vidStatsLap(ptrTemplate->ptrStats, STATS_STAGE_VALIDATE);
+            LogDecoder_vidStatsBatch(ptrTemplate->ptrStats, &strLocContext, ptrLocRows);
+            LogDecoder_vidStatsStart(ptrTemplate->ptrStats);
+            LogDecoder_vidBatchDecode(&strLocContext, ptrLocRows);
+            LogDecoder_vidStatsLap(ptrTemplate->ptrStats, STATS_STAGE_DECODE);
+            if (ptrTemplate->ptrSummary != NULL)
+            {
+                LogDecoder_vidSummaryBatch(ptrTemplate->ptrSummary, strLocContext.ptrRegistry, ptrLocRows);
+            }
+            else
+            {
+                LogDecoder_vidWriterSourceBatch(&strLocWriter, ptrLocRows, (const char * const *)aptrLocSource);
+            }
+            LogDecoder_vidStatsLap(ptrTemplate->ptrStats, STATS_STAGE_OUTPUT);
+        }
+        if (u8LocParseStatus == PARSER_ROW_ERROR)
+        {
+            /* The rows merged before the error are written                                       */
+            ptrLocSource = &strLocMerge.ptrSources[strLocMerge.u32ErrorSource];
+            LogDecoder_vidStatsReject(ptrTemplate->ptrStats);
+            if (ptrLocSource->bRecords == TRUE)
+            {
+                fprintf(LogDecoder_ptrMessageFile, "%s: Incomplete record number %lu",
+                        strLocList.aptrPath[strLocMerge.u32ErrorSource], (ptrLocSource->u32RowNumber + 1U));
+            }
+            else
+            {
+                fprintf(LogDecoder_ptrMessageFile, "%s: Missing data in row number %lu",
+                        strLocList.aptrPath[strLocMerge.u32ErrorSource], (ptrLocSource->u32RowNumber + 2U));
+            }
+        }
+        LogDecoder_vidBatchClose(&strLocBatch);
+        LogDecoder_vidReorderClose(&strLocReorder);
+
+        if (ptrTemplate->ptrSummary != NULL)
+        {
+            LogDecoder_vidSummaryWrite(ptrTemplate->ptrSummary, strLocContext.ptrRegistry, &strLocWriter);
+        }
+        /* Rows of an unknown frame ID are written empty, report them once                        */
+        if (strLocContext.u32InvalidFramesNb != 0U)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Invalid Frame ID (%lu frames)", strLocContext.u32InvalidFramesNb);
+        }
+        if (LogDecoder_bWriterClose(&strLocWriter) == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Unable to write the output file");
+        }
+        LogDecoder_vidStatsLap(ptrTemplate->ptrStats, STATS_STAGE_OUTPUT);
+        LogDecoder_vidStatsEnd(ptrTemplate->ptrStats, &strLocContext);
+        LogDecoder_vidStatsPrint(ptrTemplate->ptrStats, stderr, ptrTemplate->bStatsJson);
+    }
+    if (bLocMergeOpened == TRUE)
+    {
+        LogDecoder_vidMergeClose(&strLocMerge);
+    }
+    LogDecoder_vidOutputClose(LocOutputFile);
+
+    for (u32LocIndex = 0U; u32LocIndex < strLocList.u32FilesNb; u32LocIndex++)
+    {
+        if (aptrLocSource != NULL)
+        {
+            free(aptrLocSource[u32LocIndex]);
+        }
+        free(strLocList.aptrPath[u32LocIndex]);
+    }
+    free(aptrLocSource);
+    free(strLocList.aptrPath);
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidMainFunction                                                                          */
+/* !Description : Read Inputs from .csv file and call internal functions and write the .csv output file               */
+/*                                                                                                                    */
+/* !Inputs      : s32NumOfArg                   !Comment : Number of main arguments                                   */
+/*                                              !Range   :                                                            */
+/*                ptrMainArgs                   !Comment : main function given arguments                              */
+/*                                              !Range   :                                                            */
+/* !Number      : 21                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidMainFunction(int s32NumOfArg, char **ptrMainArgs)
+{
+    LogDecoder_strJobType strLocJob = {NULL};
+    boolean bLocBinaryOutput = FALSE;
+    boolean bLocBinToCsv = FALSE;
+    boolean bLocCsvToBin = FALSE;
+    boolean bLocDecompress = FALSE;
+    boolean bLocCompress = FALSE;
+    boolean bLocWrap16 = FALSE;
+    boolean bLocBuildIndex = FALSE;
+
+    char   *ptrLocArgs[ARGUMENTS_NUMBER] = {NULL};
+    uint32  u32LocArgsNb = FALSE;
+    uint32  u32LocThreadsNb = 1U;
+    boolean bLocThreadsGiven = FALSE;
+    char   *ptrLocBatchPattern = NULL;
+    char   *ptrLocMergePattern = NULL;
+    uint32  u32LocFollowLatency = FALSE;
+    uint32  u32LocReorderWindow = FALSE;
+    uint32  u32LocIndexInterval = INDEX_INTERVAL_ROWS;
+    uint32  u32LocFrameId = FALSE;
+    uint8   u8LocKernelLevel = KERNEL_LEVEL_AUTO;
+    char   *ptrLocOptionValue = NULL;
+    char   *ptrLocItem = NULL;
+    char   *ptrLocSchemaPath = NULL;
+    char   *ptrLocCompilePath = NULL;
+    uint32  u32LocSchemaErrorLine = FALSE;
+    int     s32LocArgIndex = FALSE;
+
+    LogDecoder_strStatsType strLocStats;
+    LogDecoder_strStatsType *ptrLocStats = NULL;
+    LogDecoder_strSummaryType *ptrLocSummary = NULL;
+    boolean bLocStatsJson = FALSE;
+    LogDecoder_strSelectType strLocSelect;
+    const LogDecoder_strSelectType *ptrLocSelect = NULL;
+
+    LogDecoder_vidSelectInit(&strLocSelect);
+    /* Separate the options from the input and output file names                                  */
+    for (s32LocArgIndex = 0; s32LocArgIndex < s32NumOfArg; s32LocArgIndex++)
+    {
+        if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_THREADS, sizeof(OPTION_THREADS) - 1U) == 0)
+        {
+            /* Thread count given either as "-j N" or as "-jN"                                    */
+            ptrLocOptionValue = ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_THREADS) - 1U;
+            if ((*ptrLocOptionValue == '\0') && ((s32LocArgIndex + 1) < s32NumOfArg))
+            {
+                s32LocArgIndex++;
+                ptrLocOptionValue = ptrMainArgs[s32LocArgIndex];
+            }
+            u32LocThreadsNb  = strtoul(ptrLocOptionValue, NULL, 10);
+            bLocThreadsGiven = TRUE;
+            if ((u32LocThreadsNb == 0U) || (u32LocThreadsNb > PARALLEL_MAX_THREADS))
+            {
+                u32LocArgsNb = ARGUMENTS_NUMBER + 1U;
+                break;
+            }
+        }
+        else if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_OUTPUT_FORMAT, sizeof(OPTION_OUTPUT_FORMAT) - 1U) == 0)
+        {
+            ptrLocOptionValue = ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_OUTPUT_FORMAT) - 1U;
+            bLocBinaryOutput  = (boolean)(strcmp(ptrLocOptionValue, OUTPUT_FORMAT_BIN) == 0);
+            if ((bLocBinaryOutput == FALSE) && (strcmp(ptrLocOptionValue, OUTPUT_FORMAT_CSV) != 0))
+            {
+                u32LocArgsNb = ARGUMENTS_NUMBER + 1U;
+                break;
+            }
+        }
+        else if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_FOLLOW, sizeof(OPTION_FOLLOW) - 1U) == 0)
+        {
+            /* Latency given either as "--follow=MS" or the default one with "--follow"           */
+            ptrLocOptionValue   = ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_FOLLOW) - 1U;
+            u32LocFollowLatency = FOLLOW_LATENCY_MS;
+            if (*ptrLocOptionValue == '=')
+            {
+                u32LocFollowLatency = strtoul(ptrLocOptionValue + 1, NULL, 10);
+            }
+            else if (*ptrLocOptionValue != '\0')
+            {
+                u32LocFollowLatency = FALSE;
+            }
+            if ((u32LocFollowLatency == 0U) || (u32LocFollowLatency > FOLLOW_MAX_LATENCY_MS))
+            {
+                u32LocArgsNb = ARGUMENTS_NUMBER + 1U;
+                break;
+            }
+        }
+        else if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_STATS, sizeof(OPTION_STATS) - 1U) == 0)
+        {
+            ptrLocOptionValue = ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_STATS) - 1U;
+            ptrLocStats   = &strLocStats;
+            bLocStatsJson = (boolean)(strcmp(ptrLocOptionValue, STATS_FORMAT_JSON) == 0);
+            if (  (bLocStatsJson == FALSE) && (*ptrLocOptionValue != '\0')
+               && (strcmp(ptrLocOptionValue, STATS_FORMAT_TEXT) != 0) )
+            {
+                u32LocArgsNb = ARGUMENTS_NUMBER + 1U;
+                break;
+            }
+        }
+        else if (strcmp(ptrMainArgs[s32LocArgIndex], OPTION_WRAP16) == 0)
+        {
+            bLocWrap16 = TRUE;
+        }
+        else if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_BUILD_INDEX, sizeof(OPTION_BUILD_INDEX) - 1U) == 0)
+        {
+            /* Interval given either as "--build-index=ROWS" or the default one with "--build-index" */
+            ptrLocOptionValue = ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_BUILD_INDEX) - 1U;
+            bLocBuildIndex    = TRUE;
+            if (*ptrLocOptionValue == '=')
+            {
+                u32LocIndexInterval = strtoul(ptrLocOptionValue + 1, NULL, 10);
+            }
+            else if (*ptrLocOptionValue != '\0')
+            {
+                u32LocIndexInterval = FALSE;
+            }
+            if ((u32LocIndexInterval == 0U) || (u32LocIndexInterval > UINT32_MAX))
+            {
+                u32LocArgsNb = ARGUMENTS_NUMBER + 1U;
+                break;
+            }
+        }
+        else if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_FROM, sizeof(OPTION_FROM) - 1U) == 0)
+        {
+            strLocSelect.u64FromTimestamp = strtoull(ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_FROM) - 1U, NULL, 10);
+            ptrLocSelect = &strLocSelect;
+        }
+        else if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_TO, sizeof(OPTION_TO) - 1U) == 0)
+        {
+            strLocSelect.u64ToTimestamp = strtoull(ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_TO) - 1U, NULL, 10);
+            ptrLocSelect = &strLocSelect;
+        }
+        else if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_TIME_RANGE, sizeof(OPTION_TIME_RANGE) - 1U) == 0)
+        {
+            /* "FROM:TO", either bound can be left out                                            */
+            ptrLocOptionValue = ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_TIME_RANGE) - 1U;
+            if (*ptrLocOptionValue != TIME_RANGE_SEPARATOR)
+            {
+                strLocSelect.u64FromTimestamp = strtoull(ptrLocOptionValue, &ptrLocOptionValue, 10);
+            }
+            if (*ptrLocOptionValue != TIME_RANGE_SEPARATOR)
+            {
+                u32LocArgsNb = ARGUMENTS_NUMBER + 1U;
+                break;
+            }
+            ptrLocOptionValue++;
+            if (*ptrLocOptionValue != '\0')
+            {
+                strLocSelect.u64ToTimestamp = strtoull(ptrLocOptionValue, NULL, 10);
+            }
+            ptrLocSelect = &strLocSelect;
+        }
+        else if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_IDS, sizeof(OPTION_IDS) - 1U) == 0)
+        {
+            /* "ID,ID,...", every ID from 0 to 255                                                */
+            ptrLocOptionValue = ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_IDS) - 1U;
+            memset(strLocSelect.abId, FALSE, sizeof(strLocSelect.abId));
+            do
+            {
+                /* An empty item ("--ids=" or "--ids=15,,78") leaves the end pointer at its start */
+                ptrLocItem    = ptrLocOptionValue;
+                u32LocFrameId = strtoul(ptrLocItem, &ptrLocOptionValue, 10);
+                if (  (ptrLocOptionValue == ptrLocItem) || (u32LocFrameId >= FRAME_IDS_NUMBER)
+                   || ((*ptrLocOptionValue != ',') && (*ptrLocOptionValue != '\0')) )
+                {
+                    u32LocArgsNb = ARGUMENTS_NUMBER + 1U;
+                    break;
+                }
+                strLocSelect.abId[u32LocFrameId] = TRUE;
+            }
+            while (*ptrLocOptionValue++ == ',');
+            if (u32LocArgsNb > ARGUMENTS_NUMBER)
+            {
+                break;
+            }
+            ptrLocSelect = &strLocSelect;
+        }
+        else if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_REORDER_WINDOW, sizeof(OPTION_REORDER_WINDOW) - 1U) == 0)
+        {
+            u32LocReorderWindow = strtoul(ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_REORDER_WINDOW) - 1U, NULL, 10);
+            if ((u32LocReorderWindow == 0U) || (u32LocReorderWindow > REORDER_MAX_WINDOW_MS))
+            {
+                u32LocArgsNb = ARGUMENTS_NUMBER + 1U;
+                break;
+            }
+        }
+        else if (strncmp(ptrMainArgs[s32LocArgIndex], OPTION_KERNEL, sizeof(OPTION_KERNEL) - 1U) == 0)
+        {
+            ptrLocOptionValue = ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_KERNEL) - 1U;
+            if (strcmp(ptrLocOptionValue, KERNEL_NAME_SCALAR) == 0)
+            {
+                u8LocKernelLevel = KERNEL_LEVEL_SCALAR;
+            }
+            else if (strcmp(ptrLocOptionValue, KERNEL_NAME_SSE2) == 0)
+            {
+                u8LocKernelLevel = KERNEL_LEVEL_SSE2;
+            }
+            else if (strcmp(ptrLocOptionValue, KERNEL_NAME_AVX2) == 0)
+            {
+                u8LocKernelLevel = KERNEL_LEVEL_AVX2;
+            }
+            else if (strcmp(ptrLocOptionValue, KERNEL_NAME_AUTO) == 0)
+            {
+                u8LocKernelLevel = KERNEL_LEVEL_AUTO;
+            }
+            else
+            {
+                u32LocArgsNb = ARGUMENTS_NUMBER + 1U;
+                break;
+            }
+        }
+        else if (strcmp(ptrMainArgs[s32LocArgIndex], OPTION_SUMMARY) == 0)
+        {
+            ptrLocSummary = &LogDecoder_strSummary;
+            LogDecoder_vidSummaryInit(ptrLocSummary);
+        }
+        else if (strcmp(ptrMainArgs[s32LocArgIndex], OPTION_ONLY_ANOMALIES) == 0)
+        {
+            strLocSelect.bOnlyAnomalies = TRUE;
+            ptrLocSelect = &strLocSelect;
+        }
+        else if ((s32LocArgIndex == 1) && (strcmp(ptrMainArgs[s32LocArgIndex], COMMAND_BIN2CSV) == 0))
+        {
+            bLocBinToCsv = TRUE;
+        }
+        else if ((s32LocArgIndex == 1) && (strcmp(ptrMainArgs[s32LocArgIndex], COMMAND_CSV2BIN) == 0))
+        {
+            bLocCsvToBin = TRUE;
+        }
+        else if ((s32LocArgIndex == 1) && (strcmp(ptrMainArgs[s32LocArgIndex], COMMAND_DECOMPRESS) == 0))
+        {
+            bLocDecompress = TRUE;
+        }
+        else if (strcmp(ptrMainArgs[s32LocArgIndex], OPTION_COMPRESS) == 0)
+        {
+            bLocCompress = TRUE;
+        }
+        else if (  (strcmp(ptrMainArgs[s32LocArgIndex], OPTION_SCHEMA) == 0)
+                && ((s32LocArgIndex + 1) < s32NumOfArg) )
+        {
+            s32LocArgIndex++;
+            ptrLocSchemaPath = ptrMainArgs[s32LocArgIndex];
+        }
+        else if (  (strcmp(ptrMainArgs[s32LocArgIndex], OPTION_BATCH) == 0)
+                && ((s32LocArgIndex + 1) < s32NumOfArg) )
+        {
+            s32LocArgIndex++;
+            ptrLocBatchPattern = ptrMainArgs[s32LocArgIndex];
+        }
+        else if (  (strcmp(ptrMainArgs[s32LocArgIndex], OPTION_MERGE) == 0)
+                && ((s32LocArgIndex + 1) < s32NumOfArg) )
+        {
+            s32LocArgIndex++;
+            ptrLocMergePattern = ptrMainArgs[s32LocArgIndex];
+        }
+        else if (  (strcmp(ptrMainArgs[s32LocArgIndex], OPTION_COMPILE_SCHEMA) == 0)
+                && ((s32LocArgIndex + 1) < s32NumOfArg) )
+        {
+            s32LocArgIndex++;
+            ptrLocCompilePath = ptrMainArgs[s32LocArgIndex];
+        }
+        else if (u32LocArgsNb < ARGUMENTS_NUMBER)
+        {
+            ptrLocArgs[u32LocArgsNb] = ptrMainArgs[s32LocArgIndex];
+            u32LocArgsNb++;
+        }
+        else
+        {
+            u32LocArgsNb++;
+        }
+    }
+
+    /* The messages must not be mixed with the decoded rows written to stdout                     */
+    LogDecoder_ptrMessageFile = stdout;
+    if (  (u32LocArgsNb == ARGUMENTS_NUMBER)
+       && (strcmp(ptrLocArgs[OUTPUT_ARGUMENT_NUMBER], OUTPUT_STDOUT_PATH) == 0) )
+    {
+        LogDecoder_ptrMessageFile = stderr;
+    }
+    else if (  (ptrLocMergePattern != NULL) && (u32LocArgsNb == MERGE_ARGUMENTS_NUMBER)
+            && (strcmp(ptrLocArgs[MERGE_OUTPUT_ARGUMENT_NUMBER], OUTPUT_STDOUT_PATH) == 0) )
+    {
+        LogDecoder_ptrMessageFile = stderr;
+    }
+    else
+    {
+        /* Messages on stdout                                                                     */
+    }
+
+    /* The kernel level is resolved once, before any decoding thread reads it                     */
+    LogDecoder_vidKernelSetLevel(u8LocKernelLevel);
+
+    /* Load the frame definitions before anything is decoded                                      */
+    if (ptrLocSchemaPath != NULL)
+    {
+        if (LogDecoder_bSchemaLoad(ptrLocSchemaPath, &LogDecoder_strLoadedRegistry, &u32LocSchemaErrorLine) == FALSE)
+        {
+            if (u32LocSchemaErrorLine == 0U)
+            {
+                fprintf(LogDecoder_ptrMessageFile, "Unable to open the schema file");
+            }
+            else
+            {
+                fprintf(LogDecoder_ptrMessageFile, "Invalid schema in line number %lu", u32LocSchemaErrorLine);
+            }
+            return;
+        }
+    }
+
+    /* Compile the schema (or the built-in frames) into a C header, nothing is decoded            */
+    if ((ptrLocCompilePath != NULL) && (u32LocArgsNb == 1U))
+    {
+        if (LogDecoder_bSchemaEmit((ptrLocSchemaPath != NULL) ? &LogDecoder_strLoadedRegistry
+                                                                : LogDecoder_ptrDefaultRegistry(),
+                                   ptrLocCompilePath) == FALSE)
+        {
+            fprintf(LogDecoder_ptrMessageFile, "Unable to write the compiled schema");
+        }
+        return;
+    }
+
+    /* With 16-bit source counters the Timestamp is only known once extended by the validation    */
+    strLocSelect.bParseTimestamp = (boolean)(bLocWrap16 == FALSE);
+
+    /* Index the input, nothing is decoded                                                        */
+    if (  (bLocBuildIndex == TRUE) && (u32LocArgsNb == 2U) && (ptrLocBatchPattern == NULL)
+       && (ptrLocMergePattern == NULL)
+       && (strcmp(ptrLocArgs[INPUT_ARGUMENT_NUMBER], INPUT_STDIN_PATH) != 0) )
+    {
+        LogDecoder_vidBuildIndex(ptrLocArgs[INPUT_ARGUMENT_NUMBER],
+                                 (ptrLocSchemaPath != NULL) ? &LogDecoder_strLoadedRegistry : NULL,
+                                 bLocWrap16, u32LocIndexInterval);
+        return;
+    }
+
+    /* Check if the number of arguments is equal to the expected number                           */
+    if (  ((ptrLocBatchPattern == NULL) && (ptrLocMergePattern == NULL) && (u32LocArgsNb != ARGUMENTS_NUMBER))
+       || ((ptrLocBatchPattern != NULL) && (u32LocArgsNb != BATCH_ARGUMENTS_NUMBER))
+       || ((ptrLocMergePattern != NULL) && (u32LocArgsNb != MERGE_ARGUMENTS_NUMBER))
+       || (  ((ptrLocBatchPattern != NULL) || (ptrLocMergePattern != NULL))
+          && (  (u32LocFollowLatency != 0U) || (bLocBinToCsv == TRUE) || (bLocCsvToBin == TRUE)
+             || (bLocDecompress == TRUE) ) )
+       || (  (bLocCompress == TRUE)
+          && ((bLocBinToCsv == TRUE) || (bLocCsvToBin == TRUE) || (bLocDecompress == TRUE)) )
+       || ((ptrLocMergePattern != NULL) && ((ptrLocBatchPattern != NULL) || (bLocBinaryOutput == TRUE)))
+       || (bLocBuildIndex == TRUE) || ((ptrLocSummary != NULL) && (bLocBinaryOutput == TRUE))
+       || (strLocSelect.u64FromTimestamp > strLocSelect.u64ToTimestamp) )
+    {
+        printf("Help Info:\n"
+            "\t- The first command shall be .exe file (for example: log_decoder.exe)\n"
+            "\t- The second command shall be .csv input file (for example: input_log.csv)\n"
+            "\t- The third command shall be .csv input file (for example: output_log.csv)\n"
+            "\t- All comands shall be delimited by whitespace (for example: log_decoder.exe input_log.csv output_log.csv)\n"
+            "\t- Option -j N decodes the input on N threads, from 1 to 64 (for example: log_decoder.exe -j 8 input_log.csv output_log.csv)\n"
+            "\t- Option --schema FILE loads the frame definitions from FILE (for example: log_decoder.exe --schema log_decoder.schema input_log.csv output_log.csv)\n"
+            "\t- Option --compile-schema HEADER writes the frame definitions as a C header, without input and output files (for example: log_decoder.exe --schema log_decoder.schema --compile-schema schema_gen.h)\n"
+            "\t- Option --output-format=bin writes a binary columnar file instead of the .csv file (for example: log_decoder.exe --output-format=bin input_log.csv output_log.bin)\n"
+            "\t- Option --follow[=MS] keeps decoding the rows appended to the input until Ctrl+C, each row is written about MS milliseconds (default 10) after it is appended (for example: log_decoder.exe --follow=10 input_log.csv output_log.csv)\n"
+            "\t- The input and the output file can be - to read stdin and write stdout, the messages then go to stderr (for example: zcat input_log.csv.gz | log_decoder.exe - - | grep ...)\n"
+            "\t- Option --stats[=text|json] prints the time of each stage and the frame counters on stderr at the end (for example: log_decoder.exe --stats=json input_log.csv output_log.csv)\n"
+            "\t- Option --build-index[=ROWS] writes the index of the input next to it as input_log.csv.idx, one entry every ROWS rows (default 65536), without output file (for example: log_decoder.exe --build-index input_log.csv)\n"
+            "\t- Options --from=MS and --to=MS write only the rows with a Timestamp in that range, the decoding starts from the index of the input when it has one (for example: log_decoder.exe --from=1000 --to=2000 input_log.csv output_log.csv)\n"
+            "\t- Options --ids=ID,ID,..., --time-range=FROM:TO and --only-anomalies write only the rows of these frame IDs, of that Timestamp range, or whose ChecksumOK or TimestampOk is 0, the other rows are not decoded (for example: log_decoder.exe --ids=15 --only-anomalies input_log.csv output_log.csv)\n"
+            "\t- Option --summary writes one row of totals per frame ID (frames, checksum failures, timeout violations, drops, period, jitter histogram, range of the decoded values) instead of the decoded rows (for example: log_decoder.exe --summary input_log.csv summary.csv)\n"
+            "\t- Option --batch DIR|'GLOB' decodes every .csv file of DIR, or every file matching GLOB, each into the output directory given in place of the input and output files, on one worker per processor or -j N; large files are split between the workers, with --summary the output directory gets summary.csv with the totals of every file and of all of them (for example: log_decoder.exe --batch 'logs/*.csv' decoded_logs)\n"
+            "\t- Option --merge DIR|'GLOB' merges every .csv file of DIR, or every file matching GLOB, by Timestamp into the single output file given in place of the input and output files, each row starting with the Source column (the path of its input file); only a few rows of each input are in memory (for example: log_decoder.exe --merge 'logs/can*.csv' merged_log.csv)\n"
+            "\t- Option --reorder-window=MS holds the frames of each ID for up to MS milliseconds (1 to 10000) and tracks them in FrameNb order, so that frames received slightly out of order give the right drops and timeouts; the input is then decoded on one thread (for example: log_decoder.exe --reorder-window=5 input_log.csv output_log.csv)\n"
+            "\t- Option --compress compresses the output files in independent blocks at about 250 MB/s, about 2.6 times smaller for the decoded rows, read back with the decompress command; with --batch the outputs are named NAME.csv.ldz (for example: log_decoder.exe --compress input_log.csv output_log.csv.ldz)\n"
+            "\t- Option --wrap16 reads FrameNb and Timestamp as 16-bit counters which wrap from 65535 to 0, the output holds their 64-bit values (for example: log_decoder.exe --wrap16 input_log.csv output_log.csv)\n"
+            "\t- Command bin2csv converts a binary file back to the .csv output (for example: log_decoder.exe bin2csv output_log.bin output_log.csv)\n"
+            "\t- Command csv2bin converts a .csv log once into fixed-size binary records, which are then decoded like the .csv log without any parsing (for example: log_decoder.exe csv2bin input_log.csv input_log.rec)\n"
+            "\t- Command decompress converts a file written with --compress back to the output it holds (for example: log_decoder.exe decompress output_log.csv.ldz output_log.csv)");
+        return;
+    }
+
+    /* Convert a binary output file back to .csv, nothing is decoded                              */
+    if (bLocBinToCsv == TRUE)
+    {
+        LogDecoder_vidBinToCsv(ptrLocArgs[INPUT_ARGUMENT_NUMBER], ptrLocArgs[OUTPUT_ARGUMENT_NUMBER]);
+        return;
+    }
+
+    /* Convert a .csv log into a record file, nothing is decoded                                  */
+    if (bLocCsvToBin == TRUE)
+    {
+        LogDecoder_vidCsvToBin(ptrLocArgs[INPUT_ARGUMENT_NUMBER], ptrLocArgs[OUTPUT_ARGUMENT_NUMBER]);
+        return;
+    }
+
+    /* Decompress a compressed output file, nothing is decoded                                    */
+    if (bLocDecompress == TRUE)
+    {
+        LogDecoder_vidDecompress(ptrLocArgs[INPUT_ARGUMENT_NUMBER], ptrLocArgs[OUTPUT_ARGUMENT_NUMBER]);
+        return;
+    }
+
+    /* Options shared by the single input and by every file of the batch mode                     */
+    strLocJob.ptrRegistry      = (ptrLocSchemaPath != NULL) ? &LogDecoder_strLoadedRegistry : NULL;
+    strLocJob.ptrSelect        = ptrLocSelect;
+    strLocJob.ptrSummary       = ptrLocSummary;
+    strLocJob.ptrStats         = ptrLocStats;
+    strLocJob.u32ThreadsNb     = u32LocThreadsNb;
+    strLocJob.u32FollowLatency = u32LocFollowLatency;
+    strLocJob.u32ReorderWindow = u32LocReorderWindow;
+    strLocJob.bWrap16          = bLocWrap16;
+    strLocJob.bBinaryOutput    = bLocBinaryOutput;
+    strLocJob.bCompress        = bLocCompress;
+    strLocJob.bStatsJson       = bLocStatsJson;
+    strLocJob.ptrMessagePrefix = "";
+    strLocJob.ptrMessageEnd    = "";
+    if (ptrLocMergePattern != NULL)
+    {
+        /* One output file for all the inputs, decoded by this thread                             */
+        LogDecoder_vidDecodeMerge(&strLocJob, ptrLocMergePattern, ptrLocArgs[MERGE_OUTPUT_ARGUMENT_NUMBER]);
+    }
+    else if (ptrLocBatchPattern != NULL)
+    {
+        /* One worker per processor unless "-j" is given                                          */
+        LogDecoder_vidDecodeBatch(&strLocJob, ptrLocBatchPattern, ptrLocArgs[BATCH_OUTPUT_ARGUMENT_NUMBER],
+                                  (bLocThreadsGiven == TRUE) ? u32LocThreadsNb : LogDecoder_u32PoolProcessors());
+    }
+    else
+    {
+        strLocJob.ptrInputPath  = ptrLocArgs[INPUT_ARGUMENT_NUMBER];
+        strLocJob.ptrOutputPath = ptrLocArgs[OUTPUT_ARGUMENT_NUMBER];
+        (void)LogDecoder_s32DecodeFile(&strLocJob);
+    }
+}
+
+/**********************************************************************************************************************/
+/* APPLICATION MAIN FUNCTION                                                                                          */
+/**********************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    LogDecoder_vidMainFunction(argc, argv);
+    return 0;
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
\ No newline at end of file
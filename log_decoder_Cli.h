@@ -0,0 +1,103 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Log decoder is a simple console application, that takes a .csv format logfile as an input           */
+/*                and provides an output log file also in .csv format, with Payload decoded into meaningful           */
+/*                values and additional flags if certains checks are violated for a given frame.                      */
+/*                                                                                                                    */
+/*  File        : log_decoder_Cli.h                                                                                   */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_CLI_H
+#define LOG_DECODER_CLI_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+#define ARGUMENTS_NUMBER                3U
+#define INPUT_ARGUMENT_NUMBER           1U
+#define OUTPUT_ARGUMENT_NUMBER          2U
+/* Output path written to the standard output, the messages then go to the standard error                             */
+#define OUTPUT_STDOUT_PATH              "-"
+#define OPTION_THREADS                  "-j"
+#define OPTION_SCHEMA                   "--schema"
+#define OPTION_COMPILE_SCHEMA           "--compile-schema"
+#define OPTION_OUTPUT_FORMAT            "--output-format="
+#define OUTPUT_FORMAT_CSV               "csv"
+#define OUTPUT_FORMAT_BIN               "bin"
+/* Statistics printed on stderr at the end as "--stats" (text) or "--stats=json"                                      */
+#define OPTION_STATS                    "--stats"
+#define STATS_FORMAT_TEXT               "=text"
+#define STATS_FORMAT_JSON               "=json"
+/* Follow a growing input as "--follow" or "--follow=MS", MS being the maximum latency of the decoded rows            */
+#define OPTION_FOLLOW                   "--follow"
+#define FOLLOW_LATENCY_MS               10U
+#define FOLLOW_MAX_LATENCY_MS           60000U
+/* FrameNb and Timestamp of the input are 16-bit counters which wrap, they are extended to 64 bits                    */
+#define OPTION_WRAP16                   "--wrap16"
+/* Index of the input written next to it as "--build-index" or "--build-index=ROWS", without output file              */
+#define OPTION_BUILD_INDEX              "--build-index"
+/* Rows of the time range [MS1, MS2] as "--from=MS1 --to=MS2", started from the index of the input when it has one    */
+#define OPTION_FROM                     "--from="
+#define OPTION_TO                       "--to="
+/* Rows written : "--ids=15,78" frame IDs, "--time-range=FROM:TO" Timestamp range (same as --from and --to) and       */
+/* "--only-anomalies" rows whose ChecksumOK or TimestampOk is 0, the other rows are tracked but not decoded           */
+#define OPTION_IDS                      "--ids="
+#define OPTION_TIME_RANGE               "--time-range="
+#define TIME_RANGE_SEPARATOR            ':'
+#define OPTION_ONLY_ANOMALIES           "--only-anomalies"
+/* Highest batch kernel level "--kernel=scalar|sse2|avx2|auto", to compare the kernels, the option is not in the help */
+#define OPTION_KERNEL                   "--kernel="
+#define KERNEL_NAME_AUTO                "auto"
+#define KERNEL_NAME_SCALAR              "scalar"
+#define KERNEL_NAME_SSE2                "sse2"
+#define KERNEL_NAME_AVX2                "avx2"
+/* Frames of an ID received up to MS ms out of order are tracked in FrameNb order with "--reorder-window=MS"          */
+#define OPTION_REORDER_WINDOW           "--reorder-window="
+/* Per frame ID totals written to the output file in place of the decoded rows                                        */
+#define OPTION_SUMMARY                  "--summary"
+/* Batch mode : "--batch DIR" decodes every DIR/NAME.csv, "--batch 'GLOB'" every matching file, to OUTDIR/NAME.csv    */
+/* (or .bin), the output directory being the only file argument. "--summary" writes OUTDIR/summary.csv instead.       */
+/* "--compress" adds .ldz to the name of every output file.                                                           */
+#define OPTION_BATCH                    "--batch"
+#define BATCH_ARGUMENTS_NUMBER          2U
+#define BATCH_OUTPUT_ARGUMENT_NUMBER    1U
+#define BATCH_INPUT_EXTENSION           ".csv"
+#define BATCH_BINARY_EXTENSION          ".bin"
+#define BATCH_COMPRESS_EXTENSION        ".ldz"
+#define BATCH_SUMMARY_FILE              "summary.csv"
+#define BATCH_SUMMARY_COLUMN            "File,"
+/* Merge mode : "--merge DIR|'GLOB' OUTPUT" merges the inputs of DIR or GLOB (.csv logs or records) by Timestamp      */
+/* into the single OUTPUT file, each row starting with the path of its input file                                     */
+#define OPTION_MERGE                    "--merge"
+#define MERGE_ARGUMENTS_NUMBER          2U
+#define MERGE_OUTPUT_ARGUMENT_NUMBER    1U
+#define MERGE_SOURCE_COLUMN             "Source,"
+/* The Source path of a row is always quoted, and followed by the separator of the decoded columns                    */
+#define MERGE_SOURCE_SEPARATOR          ", "
+/* Sub-command given in place of the input file : "log_decoder.exe bin2csv input.bin output.csv"                      */
+#define COMMAND_BIN2CSV                 "bin2csv"
+/* "log_decoder.exe csv2bin input.csv input.rec" converts a log once into records, decoded without any parsing        */
+#define COMMAND_CSV2BIN                 "csv2bin"
+/* Output files compressed in independent blocks, "log_decoder.exe decompress input.ldz output.csv" reads them back   */
+#define OPTION_COMPRESS                 "--compress"
+#define COMMAND_DECOMPRESS              "decompress"
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+void LogDecoder_vidMainFunction(int s32NumOfArg, char **ptrMainArgs);
+int main(int argc, char **argv);
+
+#endif /* LOG_DECODER_CLI_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,728 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Fast block compression of the output. A block is a list of sequences : a token (literals count in   */
+/*                its high 4 bits, match length - 4 in its low 4 bits), the extra literals count bytes, the literals, */
+/*                the 16-bit offset of the match back in the block and the extra match length bytes. The last         */
+/*                sequence of a block only holds literals. The matches are found greedily with a hash table of the    */
+/*                positions in the block, which is emptied for every block so that no block depends on another one.   */
+/*                                                                                                                    */
+/*  File        : log_decoder_Compress.c                                                                              */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_u32CompressRead                                                                                     */
+/* 2 / LogDecoder_u32CompressLoad                                                                                     */
+/* 3 / LogDecoder_vidCompressStore                                                                                    */
+/* 4 / LogDecoder_u32CompressHash                                                                                     */
+/* 5 / LogDecoder_u32CompressCount                                                                                    */
+/* 6 / LogDecoder_ptrCompressSequence                                                                                 */
+/* 7 / LogDecoder_bDecompressLength                                                                                   */
+/* 8 / LogDecoder_bDecompressData                                                                                     */
+/* 9 / LogDecoder_bCompressOpen                                                                                       */
+/* 10 / LogDecoder_vidCompressHeader                                                                                  */
+/* 11 / LogDecoder_u32CompressBlock                                                                                   */
+/* 12 / LogDecoder_vidCompressClose                                                                                   */
+/* 13 / LogDecoder_u8DecompressOpen                                                                                   */
+/* 14 / LogDecoder_u8DecompressBlock                                                                                  */
+/* 15 / LogDecoder_vidDecompressClose                                                                                 */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include <stdlib.h>
+#include "log_decoder_Compress.h"
+#include "log_decoder_Input.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define BITS_PER_BYTE                    8U
+/* Entries of the hash table, indexed by the top bits of the next 5 bytes times a large prime. Hashing one byte more  */
+/* than the shortest match gives fewer wrong candidates and longer matches on the decoded rows.                       */
+#define COMPRESS_HASH_BITS               16U
+#define COMPRESS_HASH_ENTRIES            (1UL << COMPRESS_HASH_BITS)
+#define COMPRESS_HASH_BYTES              5U
+#define COMPRESS_HASH_MULTIPLIER         889523592379ULL
+#define COMPRESS_MIN_MATCH               4U
+#define COMPRESS_MAX_OFFSET              65535U
+/* The last bytes of a block are always literals, no match starts in its last COMPRESS_SEARCH_MARGIN bytes            */
+#define COMPRESS_LAST_LITERALS           5U
+#define COMPRESS_SEARCH_MARGIN           12U
+/* After 2^COMPRESS_SKIP_SHIFT positions without match the search goes faster and faster over the data                */
+#define COMPRESS_SKIP_SHIFT              6U
+/* Lengths of the token, larger lengths go on in extra bytes                                                          */
+#define COMPRESS_TOKEN_SHIFT             4U
+#define COMPRESS_TOKEN_MAX               15U
+#define COMPRESS_LENGTH_BYTE_MAX         255U
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static uint32p LogDecoder_u32CompressRead(const uint8 *ptrData);
+static uint32p LogDecoder_u32CompressLoad(const char *ptrData);
+static void LogDecoder_vidCompressStore(char *ptrData, uint32p u32Value, uint8 u8Size);
+static uint32 LogDecoder_u32CompressHash(const uint8 *ptrData);
+static size_t LogDecoder_u32CompressCount(const uint8 *ptrInput, const uint8 *ptrMatch, const uint8 *ptrLimit);
+static uint8 *LogDecoder_ptrCompressSequence(uint8 *ptrOutput, const uint8 *ptrLiterals, size_t u32LiteralsNb,
+                                             size_t u32Offset, size_t u32MatchLength);
+static boolean LogDecoder_bDecompressLength(const uint8 **ptrInput, const uint8 *ptrEnd, size_t *ptrLength);
+static boolean LogDecoder_bDecompressData(const char *ptrData, size_t u32DataSize, char *ptrRaw, size_t u32RawSize);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32CompressRead                                                                          */
+/* !Description : Read 4 bytes of any alignment in the byte order of the machine, only compared to each other         */
+/*                                                                                                                    */
+/* !Inputs      : ptrData                       !Comment : First byte                                                 */
+/* !Outputs     : u32LocValue                   !Comment : The 4 bytes                                                */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint32p LogDecoder_u32CompressRead(const uint8 *ptrData)
+{
+    uint32p u32LocValue = FALSE;
+
+    memcpy(&u32LocValue, ptrData, sizeof(u32LocValue));
+
+    return u32LocValue;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32CompressLoad                                                                          */
+/* !Description : Read a little-endian 32-bit field of the file                                                       */
+/*                                                                                                                    */
+/* !Inputs      : ptrData                       !Comment : First byte of the field                                    */
+/* !Outputs     : u32LocValue                   !Comment : Value of the field                                         */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint32p LogDecoder_u32CompressLoad(const char *ptrData)
+{
+    const uint8 *ptrLocByte = (const uint8 *)ptrData;
+    uint32p u32LocValue = FALSE;
+    uint8 u8LocIndex = FALSE;
+
+    for(u8LocIndex = 0U; u8LocIndex < sizeof(uint32p); u8LocIndex++)
+    {
+        u32LocValue |= (uint32p)ptrLocByte[u8LocIndex] << (u8LocIndex * BITS_PER_BYTE);
+    }
+
+    return u32LocValue;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidCompressStore                                                                         */
+/* !Description : Write a little-endian field of the file                                                             */
+/*                                                                                                                    */
+/* !Inputs      : u32Value                      !Comment : Value of the field, its high bytes beyond u8Size dropped   */
+/*                u8Size                        !Comment : Bytes of the field                                         */
+/*                                              !Range   : [1, 4]                                                     */
+/* !Outputs     : ptrData                       !Comment : First byte of the field                                    */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidCompressStore(char *ptrData, uint32p u32Value, uint8 u8Size)
+{
+    uint8 *ptrLocByte = (uint8 *)ptrData;
+    uint8 u8LocIndex = FALSE;
+
+    for(u8LocIndex = 0U; u8LocIndex < u8Size; u8LocIndex++)
+    {
+        ptrLocByte[u8LocIndex] = (uint8)(u32Value >> (u8LocIndex * BITS_PER_BYTE));
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32CompressHash                                                                          */
+/* !Description : Entry of the hash table of a position. On a little-endian machine the 5 first bytes of the 8 read   */
+/*                are hashed, else other ones, which only changes the candidates of the matches.                      */
+/*                                                                                                                    */
+/* !Inputs      : ptrData                       !Comment : Position, followed by at least 8 bytes of the block        */
+/* !Outputs     : u32LocHash                    !Comment : Entry of the hash table                                    */
+/*                                              !Range   : [0, COMPRESS_HASH_ENTRIES - 1]                             */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint32 LogDecoder_u32CompressHash(const uint8 *ptrData)
+{
+    uint64 u64LocValue = FALSE;
+    uint32 u32LocHash = FALSE;
+
+    memcpy(&u64LocValue, ptrData, sizeof(u64LocValue));
+    u64LocValue <<= (sizeof(uint64) - COMPRESS_HASH_BYTES) * BITS_PER_BYTE;
+    u32LocHash = (uint32)((u64LocValue * COMPRESS_HASH_MULTIPLIER)
+                          >> ((sizeof(uint64) * BITS_PER_BYTE) - COMPRESS_HASH_BITS));
+
+    return u32LocHash;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32CompressCount                                                                         */
+/* !Description : Number of equal bytes from two positions of a block, compared 8 bytes at a time                     */
+/*                                                                                                                    */
+/* !Inputs      : ptrInput                      !Comment : Current position                                           */
+/*                ptrMatch                      !Comment : Earlier position                                           */
+/*                ptrLimit                      !Comment : End of the bytes that may be matched from ptrInput         */
+/* !Outputs     : u32LocCount                   !Comment : Number of equal bytes                                      */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static size_t LogDecoder_u32CompressCount(const uint8 *ptrInput, const uint8 *ptrMatch, const uint8 *ptrLimit)
+{
+    const uint8 *ptrLocStart = ptrInput;
+    uint64 u64LocInput = FALSE;
+    uint64 u64LocMatch = FALSE;
+    size_t u32LocCount = FALSE;
+
+    while((size_t)(ptrLimit - ptrInput) >= sizeof(uint64))
+    {
+        memcpy(&u64LocInput, ptrInput, sizeof(uint64));
+        memcpy(&u64LocMatch, ptrMatch, sizeof(uint64));
+        if(u64LocInput != u64LocMatch)
+        {
+            break;
+        }
+        ptrInput += sizeof(uint64);
+        ptrMatch += sizeof(uint64);
+    }
+    while((ptrInput < ptrLimit) && (*ptrInput == *ptrMatch))
+    {
+        ptrInput++;
+        ptrMatch++;
+    }
+    u32LocCount = (size_t)(ptrInput - ptrLocStart);
+
+    return u32LocCount;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrCompressSequence                                                                      */
+/* !Description : Write one sequence : token, literals and match. A token length of COMPRESS_TOKEN_MAX goes on in     */
+/*                extra bytes, each of them added to it, up to the first one below COMPRESS_LENGTH_BYTE_MAX.          */
+/*                                                                                                                    */
+/* !Inputs      : ptrOutput                     !Comment : Next byte of the compressed block                          */
+/*                ptrLiterals                   !Comment : Bytes since the end of the previous match                  */
+/*                u32LiteralsNb                 !Comment : Number of literals                                         */
+/*                u32Offset                     !Comment : Distance of the match back from its position               */
+/*                u32MatchLength                !Comment : Length of the match, 0 for the last sequence of the block  */
+/*                                              !Range   : 0, [COMPRESS_MIN_MATCH, ...]                               */
+/* !Outputs     : ptrOutput                     !Comment : Next byte after the sequence                               */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint8 *LogDecoder_ptrCompressSequence(uint8 *ptrOutput, const uint8 *ptrLiterals, size_t u32LiteralsNb,
+                                             size_t u32Offset, size_t u32MatchLength)
+{
+    uint8 *ptrLocToken = ptrOutput;
+    size_t u32LocLength = u32LiteralsNb;
+
+    ptrOutput++;
+    if(u32LocLength >= COMPRESS_TOKEN_MAX)
+    {
+        *ptrLocToken = (uint8)(COMPRESS_TOKEN_MAX << COMPRESS_TOKEN_SHIFT);
+        for(u32LocLength -= COMPRESS_TOKEN_MAX; u32LocLength >= COMPRESS_LENGTH_BYTE_MAX;
+            u32LocLength -= COMPRESS_LENGTH_BYTE_MAX)
+        {
+            *ptrOutput++ = (uint8)COMPRESS_LENGTH_BYTE_MAX;
+        }
+        *ptrOutput++ = (uint8)u32LocLength;
+    }
+    else
+    {
+        *ptrLocToken = (uint8)(u32LocLength << COMPRESS_TOKEN_SHIFT);
+    }
+    memcpy(ptrOutput, ptrLiterals, u32LiteralsNb);
+    ptrOutput += u32LiteralsNb;
+
+    if(u32MatchLength != 0U)
+    {
+        *ptrOutput++ = (uint8)u32Offset;
+        *ptrOutput++ = (uint8)(u32Offset >> BITS_PER_BYTE);
+        u32LocLength = u32MatchLength - COMPRESS_MIN_MATCH;
+        if(u32LocLength >= COMPRESS_TOKEN_MAX)
+        {
+            *ptrLocToken |= (uint8)COMPRESS_TOKEN_MAX;
+            for(u32LocLength -= COMPRESS_TOKEN_MAX; u32LocLength >= COMPRESS_LENGTH_BYTE_MAX;
+                u32LocLength -= COMPRESS_LENGTH_BYTE_MAX)
+            {
+                *ptrOutput++ = (uint8)COMPRESS_LENGTH_BYTE_MAX;
+            }
+            *ptrOutput++ = (uint8)u32LocLength;
+        }
+        else
+        {
+            *ptrLocToken |= (uint8)u32LocLength;
+        }
+    }
+
+    return ptrOutput;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bDecompressLength                                                                        */
+/* !Description : Add the extra bytes of a length to it, after a token length of COMPRESS_TOKEN_MAX                   */
+/*                                                                                                                    */
+/* !Inputs      : ptrInput                      !Comment : First extra byte                                           */
+/*                ptrEnd                        !Comment : End of the compressed block                                */
+/*                ptrLength                     !Comment : Length of the token                                        */
+/* !Outputs     : ptrInput                      !Comment : Byte after the extra bytes                                 */
+/*                ptrLength                     !Comment : Whole length                                               */
+/*                bLocStatus                    !Comment : FALSE if the block ends in the extra bytes                 */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bDecompressLength(const uint8 **ptrInput, const uint8 *ptrEnd, size_t *ptrLength)
+{
+    boolean bLocStatus = TRUE;
+    const uint8 *ptrLocInput = *ptrInput;
+    uint8 u8LocByte = (uint8)COMPRESS_LENGTH_BYTE_MAX;
+
+    while((u8LocByte == COMPRESS_LENGTH_BYTE_MAX) && (bLocStatus == TRUE))
+    {
+        if(ptrLocInput < ptrEnd)
+        {
+            u8LocByte = *ptrLocInput++;
+            *ptrLength += u8LocByte;
+        }
+        else
+        {
+            bLocStatus = FALSE;
+        }
+    }
+    *ptrInput = ptrLocInput;
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bDecompressData                                                                          */
+/* !Description : Decompress one block. Every length and offset is checked against the block bounds first, so that a  */
+/*                corrupted block is detected and never read or written out of its buffers.                           */
+/*                                                                                                                    */
+/* !Inputs      : ptrData                       !Comment : Compressed block                                           */
+/*                u32DataSize                   !Comment : Bytes of the compressed block                              */
+/*                u32RawSize                    !Comment : Bytes of the uncompressed block                            */
+/* !Outputs     : ptrRaw                        !Comment : Uncompressed block                                         */
+/*                bLocStatus                    !Comment : FALSE if the block is corrupted                            */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 8                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bDecompressData(const char *ptrData, size_t u32DataSize, char *ptrRaw, size_t u32RawSize)
+{
+    boolean bLocStatus = TRUE;
+    const uint8 *ptrLocInput = (const uint8 *)ptrData;
+    const uint8 *ptrLocEnd   = ptrLocInput + u32DataSize;
+    uint8 *ptrLocOutput      = (uint8 *)ptrRaw;
+    uint8 *ptrLocOutputEnd   = ptrLocOutput + u32RawSize;
+    const uint8 *ptrLocMatch = NULL;
+    size_t u32LocLength = FALSE;
+    size_t u32LocOffset = FALSE;
+    size_t u32LocCopy = FALSE;
+    uint8 u8LocToken = FALSE;
+
+    while((ptrLocInput < ptrLocEnd) && (bLocStatus == TRUE))
+    {
+        /* Literals                                                                               */
+        u8LocToken = *ptrLocInput++;
+        u32LocLength = (size_t)u8LocToken >> COMPRESS_TOKEN_SHIFT;
+        if(  ((u32LocLength == COMPRESS_TOKEN_MAX)
+           && (LogDecoder_bDecompressLength(&ptrLocInput, ptrLocEnd, &u32LocLength) == FALSE))
+          || (u32LocLength > (size_t)(ptrLocEnd - ptrLocInput))
+          || (u32LocLength > (size_t)(ptrLocOutputEnd - ptrLocOutput)) )
+        {
+            bLocStatus = FALSE;
+            break;
+        }
+        memcpy(ptrLocOutput, ptrLocInput, u32LocLength);
+        ptrLocOutput += u32LocLength;
+        ptrLocInput  += u32LocLength;
+        if(ptrLocInput == ptrLocEnd)
+        {
+            /* Last sequence of the block                                                         */
+            break;
+        }
+
+        /* Match                                                                                  */
+        u32LocLength = (size_t)u8LocToken & COMPRESS_TOKEN_MAX;
+        if((size_t)(ptrLocEnd - ptrLocInput) < sizeof(uint16))
+        {
+            bLocStatus = FALSE;
+            break;
+        }
+        u32LocOffset = (size_t)ptrLocInput[0] | ((size_t)ptrLocInput[1] << BITS_PER_BYTE);
+        ptrLocInput += sizeof(uint16);
+        if(  ((u32LocLength == COMPRESS_TOKEN_MAX)
+           && (LogDecoder_bDecompressLength(&ptrLocInput, ptrLocEnd, &u32LocLength) == FALSE))
+          || (u32LocOffset == 0U) || (u32LocOffset > (size_t)(ptrLocOutput - (uint8 *)ptrRaw))
+          || ((u32LocLength + COMPRESS_MIN_MATCH) > (size_t)(ptrLocOutputEnd - ptrLocOutput)) )
+        {
+            bLocStatus = FALSE;
+            break;
+        }
+        u32LocLength += COMPRESS_MIN_MATCH;
+        /* A match closer than its length repeats its first bytes, copied as the copied part grows */
+        ptrLocMatch = ptrLocOutput - u32LocOffset;
+        while(u32LocLength > 0U)
+        {
+            u32LocCopy = (size_t)(ptrLocOutput - ptrLocMatch);
+            u32LocCopy = (u32LocLength < u32LocCopy) ? u32LocLength : u32LocCopy;
+            memcpy(ptrLocOutput, ptrLocMatch, u32LocCopy);
+            ptrLocOutput += u32LocCopy;
+            u32LocLength -= u32LocCopy;
+        }
+    }
+
+    return (boolean)((bLocStatus == TRUE) && (ptrLocOutput == ptrLocOutputEnd));
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bCompressOpen                                                                            */
+/* !Description : Allocate the empty hash table and the block buffer of a compressor                                  */
+/*                                                                                                                    */
+/* !Outputs     : ptrCompress                   !Comment : Opened compressor                                          */
+/*                bLocStatus                    !Comment : FALSE if the buffers cannot be allocated                   */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 9                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bCompressOpen(LogDecoder_strCompressType *ptrCompress)
+{
+    boolean bLocStatus = FALSE;
+
+    ptrCompress->ptrTable = calloc(COMPRESS_HASH_ENTRIES, sizeof(uint32p));
+    ptrCompress->u32Base  = 1U;
+    ptrCompress->ptrBlock = malloc(COMPRESS_BLOCK_HEADER_SIZE + COMPRESS_BOUND(COMPRESS_BLOCK_SIZE));
+    bLocStatus = (boolean)((ptrCompress->ptrTable != NULL) && (ptrCompress->ptrBlock != NULL));
+    if(bLocStatus == FALSE)
+    {
+        LogDecoder_vidCompressClose(ptrCompress);
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidCompressHeader                                                                        */
+/* !Description : Format the header of a compressed file                                                              */
+/*                                                                                                                    */
+/* !Outputs     : ptrHeader                     !Comment : COMPRESS_HEADER_SIZE bytes                                 */
+/* !Number      : 10                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidCompressHeader(char *ptrHeader)
+{
+    memset(ptrHeader, 0, COMPRESS_HEADER_SIZE);
+    memcpy(ptrHeader, COMPRESS_MAGIC, COMPRESS_MAGIC_LENGTH);
+    LogDecoder_vidCompressStore(&ptrHeader[COMPRESS_HEADER_VERSION], COMPRESS_VERSION, sizeof(uint16));
+    LogDecoder_vidCompressStore(&ptrHeader[COMPRESS_HEADER_BLOCK_SIZE], COMPRESS_BLOCK_SIZE, sizeof(uint32p));
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32CompressBlock                                                                         */
+/* !Description : Compress one block with its header into the block buffer. A match is looked for at every position   */
+/*                from the last position of the same hash, the step grows after many positions without match so       */
+/*                that incompressible data goes through fast. A block which does not get smaller is stored raw.       */
+/*                                                                                                                    */
+/* !Inputs      : ptrCompress                   !Comment : Opened compressor                                          */
+/*                ptrData                       !Comment : Bytes to be compressed                                     */
+/*                u32Size                       !Comment : Number of bytes                                            */
+/*                                              !Range   : [1, COMPRESS_BLOCK_SIZE]                                   */
+/* !Outputs     : ptrCompress                   !Comment : Block buffer holding the block                             */
+/*                u32LocBlockSize               !Comment : Bytes of the block, header included                        */
+/* !Number      : 11                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+size_t LogDecoder_u32CompressBlock(LogDecoder_strCompressType *ptrCompress, const char *ptrData, size_t u32Size)
+{
+    const uint8 *ptrLocBase   = (const uint8 *)ptrData;
+    const uint8 *ptrLocEnd    = ptrLocBase + u32Size;
+    const uint8 *ptrLocInput  = ptrLocBase;
+    const uint8 *ptrLocAnchor = ptrLocBase;
+    const uint8 *ptrLocMatch  = NULL;
+    const uint8 *ptrLocSearchLimit = NULL;
+    const uint8 *ptrLocMatchLimit  = NULL;
+    uint8   *ptrLocOutput = (uint8 *)&ptrCompress->ptrBlock[COMPRESS_BLOCK_HEADER_SIZE];
+    uint32p *ptrLocTable  = ptrCompress->ptrTable;
+    uint32p  u32LocBase   = FALSE;
+    uint32p  u32LocEntry  = FALSE;
+    uint32p  u32LocValue  = FALSE;
+    uint32   u32LocHash   = FALSE;
+    uint32   u32LocAttempts = FALSE;
+    size_t   u32LocLength = FALSE;
+    size_t   u32LocBlockSize = FALSE;
+    boolean  bLocFound    = FALSE;
+
+    if(u32Size > COMPRESS_SEARCH_MARGIN)
+    {
+        /* The entries below the base of the block are from the previous blocks, they are ignored */
+        /* and the table is only emptied when the base would wrap                                 */
+        if(ptrCompress->u32Base > (UINT32_MAX - (2U * COMPRESS_BLOCK_SIZE)))
+        {
+            memset(ptrLocTable, 0, COMPRESS_HASH_ENTRIES * sizeof(uint32p));
+            ptrCompress->u32Base = 1U;
+        }
+        u32LocBase = ptrCompress->u32Base;
+        ptrCompress->u32Base += (uint32p)u32Size;
+        ptrLocSearchLimit = ptrLocEnd - COMPRESS_SEARCH_MARGIN;
+        ptrLocMatchLimit  = ptrLocEnd - COMPRESS_LAST_LITERALS;
+        ptrLocInput++;
+        while(ptrLocInput <= ptrLocSearchLimit)
+        {
+            bLocFound = FALSE;
+            u32LocAttempts = 1UL << COMPRESS_SKIP_SHIFT;
+            while((bLocFound == FALSE) && (ptrLocInput <= ptrLocSearchLimit))
+            {
+                u32LocValue = LogDecoder_u32CompressRead(ptrLocInput);
+                u32LocHash  = LogDecoder_u32CompressHash(ptrLocInput);
+                u32LocEntry = ptrLocTable[u32LocHash];
+                ptrLocTable[u32LocHash] = u32LocBase + (uint32p)(ptrLocInput - ptrLocBase);
+                if(  (u32LocEntry >= u32LocBase)
+                  && ((ptrLocTable[u32LocHash] - u32LocEntry) <= COMPRESS_MAX_OFFSET) )
+                {
+                    ptrLocMatch = ptrLocBase + (u32LocEntry - u32LocBase);
+                    bLocFound   = (boolean)(LogDecoder_u32CompressRead(ptrLocMatch) == u32LocValue);
+                }
+                if(bLocFound == FALSE)
+                {
+                    ptrLocInput += u32LocAttempts >> COMPRESS_SKIP_SHIFT;
+                    u32LocAttempts++;
+                }
+            }
+
+            if(bLocFound == TRUE)
+            {
+                /* The match may start in the literals before it                                  */
+                while(  (ptrLocInput > ptrLocAnchor) && (ptrLocMatch > ptrLocBase)
+                     && (ptrLocInput[-1] == ptrLocMatch[-1]) )
+                {
+                    ptrLocInput--;
+                    ptrLocMatch--;
+                }
+                u32LocLength = COMPRESS_MIN_MATCH + LogDecoder_u32CompressCount(ptrLocInput + COMPRESS_MIN_MATCH,
+                                                                                ptrLocMatch + COMPRESS_MIN_MATCH,
+                                                                                ptrLocMatchLimit);
+                ptrLocOutput = LogDecoder_ptrCompressSequence(ptrLocOutput, ptrLocAnchor,
+                                                              (size_t)(ptrLocInput - ptrLocAnchor),
+                                                              (size_t)(ptrLocInput - ptrLocMatch), u32LocLength);
+                ptrLocInput += u32LocLength;
+                ptrLocAnchor = ptrLocInput;
+                if(ptrLocInput <= ptrLocSearchLimit)
+                {
+                    /* A position inside the match, for the next repetitions of its end           */
+                    u32LocHash = LogDecoder_u32CompressHash(ptrLocInput - 2);
+                    ptrLocTable[u32LocHash] = u32LocBase + (uint32p)((ptrLocInput - 2) - ptrLocBase);
+                }
+            }
+        }
+    }
+    ptrLocOutput = LogDecoder_ptrCompressSequence(ptrLocOutput, ptrLocAnchor, (size_t)(ptrLocEnd - ptrLocAnchor),
+                                                  0U, 0U);
+
+    u32LocBlockSize = (size_t)(ptrLocOutput - (uint8 *)&ptrCompress->ptrBlock[COMPRESS_BLOCK_HEADER_SIZE]);
+    if(u32LocBlockSize < u32Size)
+    {
+        LogDecoder_vidCompressStore(&ptrCompress->ptrBlock[COMPRESS_BLOCK_DATA_SIZE], (uint32p)u32LocBlockSize,
+                                    sizeof(uint32p));
+    }
+    else
+    {
+        memcpy(&ptrCompress->ptrBlock[COMPRESS_BLOCK_HEADER_SIZE], ptrData, u32Size);
+        u32LocBlockSize = u32Size;
+        LogDecoder_vidCompressStore(&ptrCompress->ptrBlock[COMPRESS_BLOCK_DATA_SIZE],
+                                    (uint32p)(u32Size | COMPRESS_BLOCK_RAW), sizeof(uint32p));
+    }
+    LogDecoder_vidCompressStore(&ptrCompress->ptrBlock[COMPRESS_BLOCK_RAW_SIZE], (uint32p)u32Size, sizeof(uint32p));
+
+    return (COMPRESS_BLOCK_HEADER_SIZE + u32LocBlockSize);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidCompressClose                                                                         */
+/* !Description : Release the buffers of a compressor                                                                 */
+/*                                                                                                                    */
+/* !Inputs      : ptrCompress                   !Comment : Compressor, opened or not                                  */
+/* !Number      : 12                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidCompressClose(LogDecoder_strCompressType *ptrCompress)
+{
+    free(ptrCompress->ptrTable);
+    free(ptrCompress->ptrBlock);
+    ptrCompress->ptrTable = NULL;
+    ptrCompress->ptrBlock = NULL;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8DecompressOpen                                                                         */
+/* !Description : Open a compressed file, check its header and allocate the buffers of its largest block              */
+/*                                                                                                                    */
+/* !Inputs      : ptrPath                       !Comment : Compressed file, INPUT_STDIN_PATH for stdin                */
+/* !Outputs     : ptrReader                     !Comment : Reader of the first block, to be closed in any case        */
+/*                u8LocStatus                   !Comment : Open status                                                */
+/*                                              !Range   : COMPRESS_READER_OK,                                        */
+/*                                                         COMPRESS_READER_OPEN_ERROR,                                */
+/*                                                         COMPRESS_READER_FORMAT_ERROR,                              */
+/*                                                         COMPRESS_READER_VERSION_ERROR,                             */
+/*                                                         COMPRESS_READER_NO_MEMORY                                  */
+/* !Number      : 13                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8DecompressOpen(LogDecoder_strDecompressType *ptrReader, const char *ptrPath)
+{
+    char acLocHeader[COMPRESS_HEADER_SIZE] = {FALSE};
+    uint8 u8LocStatus = COMPRESS_READER_OK;
+
+    memset(ptrReader, 0, sizeof(*ptrReader));
+    ptrReader->ptrFile = (strcmp(ptrPath, INPUT_STDIN_PATH) == 0) ? stdin : fopen(ptrPath, "rb");
+    if(ptrReader->ptrFile == NULL)
+    {
+        u8LocStatus = COMPRESS_READER_OPEN_ERROR;
+    }
+    else if(  (fread(acLocHeader, 1U, sizeof(acLocHeader), ptrReader->ptrFile) != sizeof(acLocHeader))
+           || (memcmp(acLocHeader, COMPRESS_MAGIC, COMPRESS_MAGIC_LENGTH) != 0) )
+    {
+        u8LocStatus = COMPRESS_READER_FORMAT_ERROR;
+    }
+    else if(LogDecoder_u32CompressLoad(&acLocHeader[COMPRESS_HEADER_VERSION]) != COMPRESS_VERSION)
+    {
+        /* The reserved bytes after the version are 0                                             */
+        u8LocStatus = COMPRESS_READER_VERSION_ERROR;
+    }
+    else
+    {
+        ptrReader->u32BlockSize = LogDecoder_u32CompressLoad(&acLocHeader[COMPRESS_HEADER_BLOCK_SIZE]);
+        if((ptrReader->u32BlockSize == 0U) || (ptrReader->u32BlockSize > COMPRESS_MAX_BLOCK_SIZE))
+        {
+            u8LocStatus = COMPRESS_READER_FORMAT_ERROR;
+        }
+        else
+        {
+            ptrReader->ptrData = malloc(COMPRESS_BOUND(ptrReader->u32BlockSize));
+            ptrReader->ptrRaw  = malloc(ptrReader->u32BlockSize);
+            if((ptrReader->ptrData == NULL) || (ptrReader->ptrRaw == NULL))
+            {
+                u8LocStatus = COMPRESS_READER_NO_MEMORY;
+            }
+        }
+    }
+
+    return u8LocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8DecompressBlock                                                                        */
+/* !Description : Read and decompress the next block of a compressed file                                             */
+/*                                                                                                                    */
+/* !Inputs      : ptrReader                     !Comment : Opened reader                                              */
+/* !Outputs     : ptrRaw                        !Comment : Uncompressed bytes, valid until the next block is read     */
+/*                ptrSize                       !Comment : Number of uncompressed bytes                               */
+/*                u8LocStatus                   !Comment : Read status                                                */
+/*                                              !Range   : COMPRESS_READER_OK,                                        */
+/*                                                         COMPRESS_READER_END,                                       */
+/*                                                         COMPRESS_READER_FORMAT_ERROR,                              */
+/*                                                         COMPRESS_READER_TRUNCATED                                  */
+/* !Number      : 14                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8DecompressBlock(LogDecoder_strDecompressType *ptrReader, const char **ptrRaw, size_t *ptrSize)
+{
+    char acLocHeader[COMPRESS_BLOCK_HEADER_SIZE] = {FALSE};
+    size_t u32LocDataSize = FALSE;
+    size_t u32LocRawSize = FALSE;
+    boolean bLocStored = FALSE;
+    uint8 u8LocStatus = COMPRESS_READER_OK;
+
+    if(fread(acLocHeader, 1U, sizeof(acLocHeader), ptrReader->ptrFile) != sizeof(acLocHeader))
+    {
+        /* The file ends before its empty block                                                   */
+        u8LocStatus = COMPRESS_READER_TRUNCATED;
+    }
+    else
+    {
+        u32LocDataSize = LogDecoder_u32CompressLoad(&acLocHeader[COMPRESS_BLOCK_DATA_SIZE]);
+        u32LocRawSize  = LogDecoder_u32CompressLoad(&acLocHeader[COMPRESS_BLOCK_RAW_SIZE]);
+        bLocStored     = (boolean)((u32LocDataSize & COMPRESS_BLOCK_RAW) != 0U);
+        u32LocDataSize &= ~(size_t)COMPRESS_BLOCK_RAW;
+        if((u32LocDataSize == 0U) && (u32LocRawSize == 0U) && (bLocStored == FALSE))
+        {
+            u8LocStatus = COMPRESS_READER_END;
+        }
+        else if(  (u32LocRawSize == 0U) || (u32LocRawSize > ptrReader->u32BlockSize)
+               || ((bLocStored == TRUE) && (u32LocDataSize != u32LocRawSize))
+               || (u32LocDataSize > COMPRESS_BOUND(ptrReader->u32BlockSize)) )
+        {
+            u8LocStatus = COMPRESS_READER_FORMAT_ERROR;
+        }
+        else if(fread(ptrReader->ptrData, 1U, u32LocDataSize, ptrReader->ptrFile) != u32LocDataSize)
+        {
+            u8LocStatus = COMPRESS_READER_TRUNCATED;
+        }
+        else if(bLocStored == TRUE)
+        {
+            *ptrRaw  = ptrReader->ptrData;
+            *ptrSize = u32LocRawSize;
+        }
+        else if(LogDecoder_bDecompressData(ptrReader->ptrData, u32LocDataSize, ptrReader->ptrRaw,
+                                           u32LocRawSize) == TRUE)
+        {
+            *ptrRaw  = ptrReader->ptrRaw;
+            *ptrSize = u32LocRawSize;
+        }
+        else
+        {
+            u8LocStatus = COMPRESS_READER_FORMAT_ERROR;
+        }
+    }
+
+    return u8LocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidDecompressClose                                                                       */
+/* !Description : Release the buffers of a reader and close its file, stdin is left open                              */
+/*                                                                                                                    */
+/* !Inputs      : ptrReader                     !Comment : Reader, opened or not                                      */
+/* !Number      : 15                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidDecompressClose(LogDecoder_strDecompressType *ptrReader)
+{
+    if((ptrReader->ptrFile != NULL) && (ptrReader->ptrFile != stdin))
+    {
+        fclose(ptrReader->ptrFile);
+    }
+    free(ptrReader->ptrData);
+    free(ptrReader->ptrRaw);
+    memset(ptrReader, 0, sizeof(*ptrReader));
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
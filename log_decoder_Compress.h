@@ -0,0 +1,85 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Fast block compression of the output ("--compress"), in the LZ77 byte format of LZ4 : every block   */
+/*                of the file is compressed on its own, so that the blocks can be decompressed independently, and     */
+/*                the reader of such a file for the "decompress" command.                                             */
+/*                                                                                                                    */
+/*  File        : log_decoder_Compress.h                                                                              */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_COMPRESS_H
+#define LOG_DECODER_COMPRESS_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/*---------------------------------- Format ----------------------------------*/
+/* Every field is little-endian whatever the byte order of the machine which wrote the file                           */
+#define COMPRESS_MAGIC                  "LDCZ"
+#define COMPRESS_MAGIC_LENGTH           4U
+#define COMPRESS_VERSION                1U
+/* Header : magic, u16 version, u16 reserved, u32 largest uncompressed block, u32 reserved                            */
+#define COMPRESS_HEADER_SIZE            16U
+#define COMPRESS_HEADER_VERSION         4U
+#define COMPRESS_HEADER_BLOCK_SIZE      8U
+/* Block : u32 stored size, u32 uncompressed size, then the stored bytes. A block which does not get smaller is       */
+/* stored as it is, with COMPRESS_BLOCK_RAW in its stored size. The file ends with an empty block.                    */
+#define COMPRESS_BLOCK_HEADER_SIZE      8U
+#define COMPRESS_BLOCK_DATA_SIZE        0U
+#define COMPRESS_BLOCK_RAW_SIZE         4U
+#define COMPRESS_BLOCK_RAW              0x80000000UL
+/* Uncompressed bytes of a block written by the decoder, the largest block accepted by the reader                     */
+#define COMPRESS_BLOCK_SIZE             (1U * 1024U * 1024U)
+#define COMPRESS_MAX_BLOCK_SIZE         (64U * 1024U * 1024U)
+/* Largest compressed size of a block of u32Size bytes                                                                */
+#define COMPRESS_BOUND(u32Size)         ((u32Size) + ((u32Size) / 255U) + 16U)
+/*------------------------------- Reader status ------------------------------*/
+#define COMPRESS_READER_OK              0U
+#define COMPRESS_READER_END             1U      /* Empty block which ends the file                          */
+#define COMPRESS_READER_OPEN_ERROR      2U
+#define COMPRESS_READER_FORMAT_ERROR    3U
+#define COMPRESS_READER_VERSION_ERROR   4U
+#define COMPRESS_READER_TRUNCATED       5U
+#define COMPRESS_READER_NO_MEMORY       6U
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+typedef struct
+{
+    uint32p *ptrTable;              /* Last position of each hash, u32Base + offset in the block, or NULL     */
+    char    *ptrBlock;              /* Block header and stored bytes of the last compressed block             */
+    uint32p  u32Base;               /* Table entry of the first byte of the next block                        */
+}LogDecoder_strCompressType;
+typedef struct
+{
+    FILE   *ptrFile;
+    char   *ptrData;                /* Stored bytes of the current block                                      */
+    char   *ptrRaw;                 /* Uncompressed bytes of the current block                                */
+    size_t  u32BlockSize;           /* Largest uncompressed block of the file                                 */
+}LogDecoder_strDecompressType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+boolean LogDecoder_bCompressOpen(LogDecoder_strCompressType *ptrCompress);
+void LogDecoder_vidCompressHeader(char *ptrHeader);
+size_t LogDecoder_u32CompressBlock(LogDecoder_strCompressType *ptrCompress, const char *ptrData, size_t u32Size);
+void LogDecoder_vidCompressClose(LogDecoder_strCompressType *ptrCompress);
+uint8 LogDecoder_u8DecompressOpen(LogDecoder_strDecompressType *ptrReader, const char *ptrPath);
+uint8 LogDecoder_u8DecompressBlock(LogDecoder_strDecompressType *ptrReader, const char **ptrRaw, size_t *ptrSize);
+void LogDecoder_vidDecompressClose(LogDecoder_strDecompressType *ptrReader);
+
+#endif /* LOG_DECODER_COMPRESS_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
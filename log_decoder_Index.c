@@ -0,0 +1,602 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Sparse timestamp index of a .csv log. The index is built by one tracking pass over the log (parse   */
+/*                and validate stages, nothing is decoded). Each entry stores the position of a row, the tracking     */
+/*                state of the frame IDs before that row, the largest timestamp before it and the smallest timestamp */
+/*                from it to the end, so that the rows of a time range are found without scanning the whole log.      */
+/*                                                                                                                    */
+/*  File        : log_decoder_Index.c                                                                                 */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_ptrIndexPath                                                                                        */
+/* 2 / LogDecoder_vidIndexInputIdentity                                                                               */
+/* 3 / LogDecoder_bIndexInputHash                                                                                     */
+/* 4 / LogDecoder_bIndexAddEntry                                                                                      */
+/* 5 / LogDecoder_bIndexWrite                                                                                         */
+/* 6 / LogDecoder_u8IndexBuild                                                                                        */
+/* 7 / LogDecoder_u8IndexLookup                                                                                       */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#define INDEX_POSIX_STAT
+#endif
+
+#include <limits.h>
+#include <stdlib.h>
+#include "log_decoder_Index.h"
+#include "log_decoder_Parser.h"
+
+#ifdef INDEX_POSIX_STAT
+#include <sys/stat.h>
+#endif
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define INDEX_ENTRIES_FIRST_CAPACITY     64U
+/* 64-bit FNV-1a hash of the checked bytes of the log                                                                 */
+#define INDEX_HASH_BASIS                 0xCBF29CE484222325ULL
+#define INDEX_HASH_PRIME                 0x00000100000001B3ULL
+
+/**********************************************************************************************************************/
+/* LOCAL TYPEDEF                                                                                                      */
+/**********************************************************************************************************************/
+typedef struct
+{
+    LogDecoder_strIndexEntryType  *ptrEntries;
+    LogDecoder_strFrameStateType  *ptrStates;       /* u32IdsNb states per entry, in the order of au8Id    */
+    uint32                         u32EntriesNb;
+    uint32                         u32Capacity;
+    uint32                         u32IdsNb;
+    uint8                          au8Id[FRAME_IDS_NUMBER];
+}LogDecoder_strIndexBuilderType;
+typedef struct
+{
+    uint64  u64Inode;                       /* File serial number, 0 if unknown                         */
+    uint64  u64Time;                        /* Last change in ns, 0 if unknown                          */
+    uint64  u64Size;                        /* Size in bytes, 0 if the log cannot be read               */
+}LogDecoder_strIndexIdentityType;
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static char *LogDecoder_ptrIndexPath(const char *ptrInputPath);
+static void LogDecoder_vidIndexInputIdentity(const char *ptrInputPath, LogDecoder_strIndexIdentityType *ptrIdentity);
+static boolean LogDecoder_bIndexInputHash(const char *ptrInputPath, const LogDecoder_strIndexEntryType *ptrEntries,
+                                          uint64 u64EntriesNb, uint64 u64InputSize, uint64 *ptrHash);
+static boolean LogDecoder_bIndexAddEntry(LogDecoder_strIndexBuilderType *ptrBuilder,
+                                         const LogDecoder_strContextType *ptrContext, uint64 u64Offset,
+                                         uint64 u64RowNumber, uint64 u64MaxTimestamp);
+static boolean LogDecoder_bIndexWrite(const char *ptrIndexPath, const LogDecoder_strIndexHeaderType *ptrHeader,
+                                      const LogDecoder_strIndexBuilderType *ptrBuilder);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrIndexPath                                                                             */
+/* !Description : Get the path of the index of a log, the log path followed by INDEX_FILE_EXTENSION                   */
+/*                                                                                                                    */
+/* !Inputs      : ptrInputPath                  !Comment : Path of the .csv log                                       */
+/* !Outputs     : ptrLocPath                    !Comment : Allocated path to be freed, NULL if no memory              */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static char *LogDecoder_ptrIndexPath(const char *ptrInputPath)
+{
+    size_t u32LocLength = strlen(ptrInputPath);
+    char *ptrLocPath = malloc(u32LocLength + sizeof(INDEX_FILE_EXTENSION));
+
+    if(ptrLocPath != NULL)
+    {
+        memcpy(ptrLocPath, ptrInputPath, u32LocLength);
+        memcpy(ptrLocPath + u32LocLength, INDEX_FILE_EXTENSION, sizeof(INDEX_FILE_EXTENSION));
+    }
+
+    return ptrLocPath;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidIndexInputIdentity                                                                    */
+/* !Description : Get the file serial number, the time of the last change and the size of the log. A log with the     */
+/*                same ones as at the build has not been changed since, any other one has its bytes checked.          */
+/*                                                                                                                    */
+/* !Inputs      : ptrInputPath                  !Comment : Path of the .csv log                                       */
+/* !Outputs     : ptrIdentity                   !Comment : Identity of the log, serial number and time 0 when the     */
+/*                                                         platform has none                                          */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidIndexInputIdentity(const char *ptrInputPath, LogDecoder_strIndexIdentityType *ptrIdentity)
+{
+#ifdef INDEX_POSIX_STAT
+    struct stat strLocFileStat;
+
+    memset(ptrIdentity, 0, sizeof(*ptrIdentity));
+    if(stat(ptrInputPath, &strLocFileStat) == 0)
+    {
+        ptrIdentity->u64Inode = (uint64)strLocFileStat.st_ino;
+        ptrIdentity->u64Time  = ((uint64)strLocFileStat.st_mtim.tv_sec * 1000000000ULL)
+                              + (uint64)strLocFileStat.st_mtim.tv_nsec;
+        ptrIdentity->u64Size  = (strLocFileStat.st_size > 0) ? (uint64)strLocFileStat.st_size : 0U;
+    }
+#else
+    FILE *ptrLocFile = fopen(ptrInputPath, "rb");
+    long s32LocPosition = -1L;
+
+    memset(ptrIdentity, 0, sizeof(*ptrIdentity));
+    if(ptrLocFile != NULL)
+    {
+        if(fseek(ptrLocFile, 0L, SEEK_END) == 0)
+        {
+            s32LocPosition = ftell(ptrLocFile);
+        }
+        ptrIdentity->u64Size = (s32LocPosition > 0L) ? (uint64)s32LocPosition : 0U;
+        fclose(ptrLocFile);
+    }
+#endif
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bIndexInputHash                                                                          */
+/* !Description : Hash the INDEX_CHECK_BYTES of the log at every entry, then the ones before the end of the indexed   */
+/*                rows. Only bytes before u64InputSize are read, the hash does not change when rows are appended.     */
+/*                                                                                                                    */
+/* !Inputs      : ptrInputPath                  !Comment : Path of the .csv log                                       */
+/*                ptrEntries                    !Comment : Entries of the index                                       */
+/*                u64EntriesNb                  !Comment : Number of entries                                          */
+/*                u64InputSize                  !Comment : Bytes of the log covered by the entries                    */
+/* !Outputs     : ptrHash                       !Comment : Hash of the checked bytes                                  */
+/*                bLocStatus                    !Comment : FALSE if the bytes could not be read                       */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bIndexInputHash(const char *ptrInputPath, const LogDecoder_strIndexEntryType *ptrEntries,
+                                          uint64 u64EntriesNb, uint64 u64InputSize, uint64 *ptrHash)
+{
+    FILE *ptrLocFile = fopen(ptrInputPath, "rb");
+    uint8 au8LocBytes[INDEX_CHECK_BYTES];
+    uint64 u64LocOffset = FALSE;
+    uint64 u64LocIndex = FALSE;
+    size_t u32LocSize = FALSE;
+    size_t u32LocByte = FALSE;
+    boolean bLocStatus = (boolean)(ptrLocFile != NULL);
+
+    *ptrHash = INDEX_HASH_BASIS;
+    for(u64LocIndex = 0U; (u64LocIndex <= u64EntriesNb) && (bLocStatus == TRUE); u64LocIndex++)
+    {
+        /* Entries first, then the last bytes of the indexed rows                                 */
+        u64LocOffset = (u64LocIndex < u64EntriesNb) ? ptrEntries[u64LocIndex].u64Offset
+                     : ((u64InputSize > INDEX_CHECK_BYTES) ? (u64InputSize - INDEX_CHECK_BYTES) : 0U);
+        bLocStatus = (boolean)((u64LocOffset <= u64InputSize) && (u64LocOffset <= (uint64)LONG_MAX));
+        if(bLocStatus == TRUE)
+        {
+            u32LocSize = ((u64InputSize - u64LocOffset) < INDEX_CHECK_BYTES) ? (size_t)(u64InputSize - u64LocOffset)
+                                                                             : INDEX_CHECK_BYTES;
+            bLocStatus = (boolean)(  (fseek(ptrLocFile, (long)u64LocOffset, SEEK_SET) == 0)
+                                  && (fread(au8LocBytes, 1U, u32LocSize, ptrLocFile) == u32LocSize) );
+        }
+        for(u32LocByte = 0U; (u32LocByte < u32LocSize) && (bLocStatus == TRUE); u32LocByte++)
+        {
+            *ptrHash = (*ptrHash ^ au8LocBytes[u32LocByte]) * INDEX_HASH_PRIME;
+        }
+    }
+    if(ptrLocFile != NULL)
+    {
+        fclose(ptrLocFile);
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bIndexAddEntry                                                                           */
+/* !Description : Append an entry at the next row to be parsed, with the current tracking state of the IDs            */
+/*                                                                                                                    */
+/* !Inputs      : ptrBuilder                    !Comment : Entries built so far                                       */
+/*                ptrContext                    !Comment : Tracking state before the row                              */
+/*                u64Offset                     !Comment : Position of the row in the log                             */
+/*                u64RowNumber                  !Comment : Rows before the row, header excluded                       */
+/*                u64MaxTimestamp               !Comment : Largest timestamp of the rows before the row               */
+/* !Outputs     : ptrBuilder                    !Comment : Entries with the new one last                              */
+/*                bLocStatus                    !Comment : FALSE if there is not enough memory                        */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bIndexAddEntry(LogDecoder_strIndexBuilderType *ptrBuilder,
+                                         const LogDecoder_strContextType *ptrContext, uint64 u64Offset,
+                                         uint64 u64RowNumber, uint64 u64MaxTimestamp)
+{
+    LogDecoder_strIndexEntryType *ptrLocEntries = NULL;
+    LogDecoder_strFrameStateType *ptrLocStates = NULL;
+    LogDecoder_strIndexEntryType *ptrLocEntry = NULL;
+    uint32 u32LocCapacity = FALSE;
+    uint32 u32LocIndex = FALSE;
+
+    if(ptrBuilder->u32EntriesNb == ptrBuilder->u32Capacity)
+    {
+        u32LocCapacity = (ptrBuilder->u32Capacity == 0U) ? INDEX_ENTRIES_FIRST_CAPACITY
+                                                         : (2U * ptrBuilder->u32Capacity);
+        ptrLocEntries = realloc(ptrBuilder->ptrEntries, u32LocCapacity * sizeof(LogDecoder_strIndexEntryType));
+        if(ptrLocEntries == NULL)
+        {
+            return FALSE;
+        }
+        ptrBuilder->ptrEntries = ptrLocEntries;
+        /* One more state so that the allocation is never empty when no ID is defined             */
+        ptrLocStates = realloc(ptrBuilder->ptrStates,
+                               ((u32LocCapacity * ptrBuilder->u32IdsNb) + 1U) * sizeof(LogDecoder_strFrameStateType));
+        if(ptrLocStates == NULL)
+        {
+            return FALSE;
+        }
+        ptrBuilder->ptrStates   = ptrLocStates;
+        ptrBuilder->u32Capacity = u32LocCapacity;
+    }
+
+    ptrLocEntry = &ptrBuilder->ptrEntries[ptrBuilder->u32EntriesNb];
+    ptrLocEntry->u64Offset             = u64Offset;
+    ptrLocEntry->u64RowNumber          = u64RowNumber;
+    ptrLocEntry->u64MaxTimestampBefore = u64MaxTimestamp;
+    ptrLocEntry->u64MinTimestampAfter  = UINT64_MAX;
+
+    ptrLocStates = &ptrBuilder->ptrStates[ptrBuilder->u32EntriesNb * ptrBuilder->u32IdsNb];
+    for(u32LocIndex = 0U; u32LocIndex < ptrBuilder->u32IdsNb; u32LocIndex++)
+    {
+        /* The padding of the state is cleared, the file content only depends on the log          */
+        memset(&ptrLocStates[u32LocIndex], 0, sizeof(LogDecoder_strFrameStateType));
+        ptrLocStates[u32LocIndex].u64FrameNbNm1   =
+            ptrContext->astrFrameState[ptrBuilder->au8Id[u32LocIndex]].u64FrameNbNm1;
+        ptrLocStates[u32LocIndex].u64TimestampNm1 =
+            ptrContext->astrFrameState[ptrBuilder->au8Id[u32LocIndex]].u64TimestampNm1;
+        ptrLocStates[u32LocIndex].u64FrameDropCnt =
+            ptrContext->astrFrameState[ptrBuilder->au8Id[u32LocIndex]].u64FrameDropCnt;
+        ptrLocStates[u32LocIndex].bFirstReading   =
+            ptrContext->astrFrameState[ptrBuilder->au8Id[u32LocIndex]].bFirstReading;
+    }
+    ptrBuilder->u32EntriesNb++;
+
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bIndexWrite                                                                              */
+/* !Description : Write the index file : header, entries, then the tracking states of every entry                     */
+/*                                                                                                                    */
+/* !Inputs      : ptrIndexPath                  !Comment : Path of the index file                                     */
+/*                ptrHeader                     !Comment : Header of the index                                        */
+/*                ptrBuilder                    !Comment : Entries and their tracking states                          */
+/* !Outputs     : bLocStatus                    !Comment : FALSE if the file could not be written                     */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bIndexWrite(const char *ptrIndexPath, const LogDecoder_strIndexHeaderType *ptrHeader,
+                                      const LogDecoder_strIndexBuilderType *ptrBuilder)
+{
+    FILE *ptrLocFile = fopen(ptrIndexPath, "wb");
+    size_t u32LocStatesNb = (size_t)ptrBuilder->u32EntriesNb * ptrBuilder->u32IdsNb;
+    boolean bLocStatus = FALSE;
+
+    if(ptrLocFile != NULL)
+    {
+        bLocStatus = (boolean)(  (fwrite(ptrHeader, sizeof(*ptrHeader), 1U, ptrLocFile) == 1U)
+                              && (fwrite(ptrBuilder->ptrEntries, sizeof(LogDecoder_strIndexEntryType),
+                                         ptrBuilder->u32EntriesNb, ptrLocFile) == ptrBuilder->u32EntriesNb)
+                              && (fwrite(ptrBuilder->ptrStates, sizeof(LogDecoder_strFrameStateType),
+                                         u32LocStatesNb, ptrLocFile) == u32LocStatesNb) );
+        bLocStatus = (boolean)((fclose(ptrLocFile) == 0) && (bLocStatus == TRUE));
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8IndexBuild                                                                             */
+/* !Description : Track all the rows of the log and write its index next to it. The rows are parsed and validated     */
+/*                by batches of at most u32Interval rows, an entry is added before the first batch and then before    */
+/*                the first batch which starts u32Interval rows or more after the previous entry. The index of a log  */
+/*                with a malformed row stops at that row, as the decoding does.                                       */
+/*                                                                                                                    */
+/* !Inputs      : ptrContext                    !Comment : Initialized decoder context, registry and bWrap16 set      */
+/*                ptrInput                      !Comment : Opened log                                                 */
+/*                ptrCursor                     !Comment : First row of the log (after the header)                    */
+/*                ptrInputPath                  !Comment : Path of the log, the index is written next to it           */
+/*                u32Interval                   !Comment : Rows between two entries                                   */
+/*                                              !Range   : [1, 2^32 - 1]                                              */
+/* !Outputs     : ptrContext                    !Comment : Tracking state at the end of the log                       */
+/*                ptrRowNumber                  !Comment : Number of rows tracked                                     */
+/*                u8LocStatus                   !Comment : Build status                                               */
+/*                                              !Range   : INDEX_BUILD_DONE,                                          */
+/*                                                         INDEX_BUILD_ROW_ERROR,                                     */
+/*                                                         INDEX_BUILD_NO_MEMORY,                                     */
+/*                                                         INDEX_BUILD_WRITE_ERROR                                    */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8IndexBuild(LogDecoder_strContextType *ptrContext, LogDecoder_strInputType *ptrInput,
+                              const char *ptrCursor, const char *ptrInputPath, uint32 u32Interval,
+                              uint32 *ptrRowNumber)
+{
+    LogDecoder_strIndexBuilderType strLocBuilder;
+    LogDecoder_strIndexHeaderType strLocHeader;
+    LogDecoder_strIndexIdentityType strLocIdentity;
+    LogDecoder_strBatchType strLocBatch;
+    LogDecoder_strIndexEntryType *ptrLocEntry = NULL;
+    const char *ptrLocCursor = ptrCursor;
+    char *ptrLocIndexPath = NULL;
+    uint64 u64LocMaxTimestamp = FALSE;
+    uint64 u64LocEntryRow = FALSE;
+    uint32 u32LocIndex = FALSE;
+    uint8 u8LocParseStatus = PARSER_ROW_OK;
+    uint8 u8LocStatus = INDEX_BUILD_DONE;
+
+    *ptrRowNumber = FALSE;
+    memset(&strLocBuilder, 0, sizeof(strLocBuilder));
+    memset(&strLocHeader, 0, sizeof(strLocHeader));
+    for(u32LocIndex = 0U; u32LocIndex < FRAME_IDS_NUMBER; u32LocIndex++)
+    {
+        strLocHeader.abDefined[u32LocIndex] = ptrContext->ptrRegistry->astrFrame[u32LocIndex].bDefined;
+        if(strLocHeader.abDefined[u32LocIndex] == TRUE)
+        {
+            strLocBuilder.au8Id[strLocBuilder.u32IdsNb] = (uint8)u32LocIndex;
+            strLocBuilder.u32IdsNb++;
+        }
+    }
+    if(LogDecoder_bBatchOpen(&strLocBatch, (u32Interval < BATCH_FRAMES_NUMBER) ? u32Interval
+                                                                               : BATCH_FRAMES_NUMBER) == FALSE)
+    {
+        return INDEX_BUILD_NO_MEMORY;
+    }
+
+    while((u8LocParseStatus != PARSER_END_OF_DATA) && (u8LocStatus == INDEX_BUILD_DONE))
+    {
+        if(  (strLocBuilder.u32EntriesNb == 0U) || ((uint64)(*ptrRowNumber - u64LocEntryRow) >= u32Interval) )
+        {
+            if(LogDecoder_bIndexAddEntry(&strLocBuilder, ptrContext, LogDecoder_u64InputOffset(ptrInput, ptrLocCursor),
+                                         *ptrRowNumber, u64LocMaxTimestamp) == FALSE)
+            {
+                u8LocStatus = INDEX_BUILD_NO_MEMORY;
+                break;
+            }
+            u64LocEntryRow = *ptrRowNumber;
+        }
+
+        /* Tracking pass only, the decoded values are not part of the index                       */
+        strLocBatch.u32FramesNb = FALSE;
+        u8LocParseStatus = LogDecoder_u8ParseBatch(&ptrLocCursor, ptrInput->ptrEnd, ptrInput->bLastBlock, NULL,
+                                                   &strLocBatch);
+        LogDecoder_vidBatchValidate(ptrContext, &strLocBatch);
+        ptrLocEntry = &strLocBuilder.ptrEntries[strLocBuilder.u32EntriesNb - 1U];
+        for(u32LocIndex = 0U; u32LocIndex < strLocBatch.u32FramesNb; u32LocIndex++)
+        {
+            if(strLocBatch.ptrTimestamp[u32LocIndex] > u64LocMaxTimestamp)
+            {
+                u64LocMaxTimestamp = strLocBatch.ptrTimestamp[u32LocIndex];
+            }
+            if(strLocBatch.ptrTimestamp[u32LocIndex] < ptrLocEntry->u64MinTimestampAfter)
+            {
+                ptrLocEntry->u64MinTimestampAfter = strLocBatch.ptrTimestamp[u32LocIndex];
+            }
+        }
+        *ptrRowNumber += strLocBatch.u32FramesNb;
+
+        if(u8LocParseStatus == PARSER_ROW_OK)
+        {
+            /* Full batch, continue with the next one                                             */
+        }
+        else if(  (u8LocParseStatus == PARSER_ROW_INCOMPLETE)
+               && (LogDecoder_bInputRefill(ptrInput, ptrLocCursor) == TRUE) )
+        {
+            ptrLocCursor = ptrInput->ptrBegin;
+        }
+        else if(u8LocParseStatus != PARSER_END_OF_DATA)
+        {
+            /* The index covers the rows before the malformed row, still written                  */
+            u8LocStatus = INDEX_BUILD_ROW_ERROR;
+        }
+        else
+        {
+            /* End of the log                                                                     */
+        }
+    }
+    LogDecoder_vidBatchClose(&strLocBatch);
+
+    if(u8LocStatus != INDEX_BUILD_NO_MEMORY)
+    {
+        /* Smallest timestamp from each entry to the end, from the smallest one of each interval  */
+        for(u32LocIndex = strLocBuilder.u32EntriesNb - 1U; u32LocIndex > 0U; u32LocIndex--)
+        {
+            if(strLocBuilder.ptrEntries[u32LocIndex].u64MinTimestampAfter
+               < strLocBuilder.ptrEntries[u32LocIndex - 1U].u64MinTimestampAfter)
+            {
+                strLocBuilder.ptrEntries[u32LocIndex - 1U].u64MinTimestampAfter =
+                    strLocBuilder.ptrEntries[u32LocIndex].u64MinTimestampAfter;
+            }
+        }
+
+        memcpy(strLocHeader.acMagic, INDEX_MAGIC, INDEX_MAGIC_LENGTH);
+        strLocHeader.u16Version   = INDEX_VERSION;
+        strLocHeader.u16IdsNb     = (uint16)strLocBuilder.u32IdsNb;
+        strLocHeader.u32ByteOrder = (uint32p)INDEX_BYTE_ORDER;
+        strLocHeader.u32Interval  = (uint32p)u32Interval;
+        strLocHeader.u64InputSize = LogDecoder_u64InputOffset(ptrInput, ptrLocCursor);
+        strLocHeader.u64EntriesNb = strLocBuilder.u32EntriesNb;
+        strLocHeader.bWrap16      = ptrContext->bWrap16;
+        /* The log this index describes : its identity now, and its bytes for a log changed since */
+        LogDecoder_vidIndexInputIdentity(ptrInputPath, &strLocIdentity);
+        strLocHeader.u64InputInode = strLocIdentity.u64Inode;
+        strLocHeader.u64InputTime  = strLocIdentity.u64Time;
+
+        ptrLocIndexPath = LogDecoder_ptrIndexPath(ptrInputPath);
+        if(  (ptrLocIndexPath == NULL)
+          || (LogDecoder_bIndexInputHash(ptrInputPath, strLocBuilder.ptrEntries, strLocHeader.u64EntriesNb,
+                                         strLocHeader.u64InputSize, &strLocHeader.u64InputHash) == FALSE)
+          || (LogDecoder_bIndexWrite(ptrLocIndexPath, &strLocHeader, &strLocBuilder) == FALSE) )
+        {
+            u8LocStatus = INDEX_BUILD_WRITE_ERROR;
+        }
+        free(ptrLocIndexPath);
+    }
+    free(strLocBuilder.ptrEntries);
+    free(strLocBuilder.ptrStates);
+
+    return u8LocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8IndexLookup                                                                            */
+/* !Description : Find in the index of a log where the decoding of a time range starts and where it can stop, and     */
+/*                set the tracking state of the context as it is at the start. The decoding starts at the last entry  */
+/*                with no row of the range before it, and stops at the first next entry with no row of the range      */
+/*                from it to the end. The index must have been built from the same log, with the same frame IDs       */
+/*                and the same bWrap16 setting. A log changed since the build must still have the same bytes at       */
+/*                the entries and at the end of the indexed rows, else the index is not used. Rows appended to the    */
+/*                log after the build are decoded too.                                                                */
+/*                                                                                                                    */
+/* !Inputs      : ptrContext                    !Comment : Initialized decoder context, registry and bWrap16 set      */
+/*                ptrInputPath                  !Comment : Path of the log                                            */
+/*                ptrSelect                     !Comment : Time range to be decoded                                   */
+/* !Outputs     : ptrContext                    !Comment : Tracking state before the first row of ptrRange            */
+/*                ptrRange                      !Comment : Rows to be decoded                                         */
+/*                u8LocStatus                   !Comment : Lookup status, the context is only changed when OK         */
+/*                                              !Range   : INDEX_LOOKUP_OK,                                           */
+/*                                                         INDEX_LOOKUP_MISSING,                                      */
+/*                                                         INDEX_LOOKUP_MISMATCH                                      */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8IndexLookup(LogDecoder_strContextType *ptrContext, const char *ptrInputPath,
+                               const LogDecoder_strSelectType *ptrSelect, LogDecoder_strIndexRangeType *ptrRange)
+{
+    LogDecoder_strInputType strLocIndex;
+    LogDecoder_strIndexIdentityType strLocIdentity;
+    const LogDecoder_strIndexHeaderType *ptrLocHeader = NULL;
+    const LogDecoder_strIndexEntryType *ptrLocEntries = NULL;
+    const LogDecoder_strFrameStateType *ptrLocStates = NULL;
+    char *ptrLocIndexPath = LogDecoder_ptrIndexPath(ptrInputPath);
+    boolean abLocDefined[FRAME_IDS_NUMBER] = {FALSE};
+    uint64 u64LocSize = FALSE;
+    uint64 u64LocHash = FALSE;
+    uint64 u64LocFirst = FALSE;
+    uint64 u64LocLast = FALSE;
+    uint32 u32LocIdsNb = FALSE;
+    uint32 u32LocIndex = FALSE;
+    uint8 u8LocStatus = INDEX_LOOKUP_MISMATCH;
+
+    memset(&strLocIndex, 0, sizeof(strLocIndex));
+    if(  (ptrLocIndexPath == NULL)
+      || (LogDecoder_bInputOpen(&strLocIndex, ptrLocIndexPath, FALSE) == FALSE)
+      || (LogDecoder_bInputLoad(&strLocIndex) == FALSE) )
+    {
+        LogDecoder_vidInputClose(&strLocIndex);
+        free(ptrLocIndexPath);
+        return INDEX_LOOKUP_MISSING;
+    }
+    free(ptrLocIndexPath);
+
+    for(u32LocIndex = 0U; u32LocIndex < FRAME_IDS_NUMBER; u32LocIndex++)
+    {
+        abLocDefined[u32LocIndex] = ptrContext->ptrRegistry->astrFrame[u32LocIndex].bDefined;
+        u32LocIdsNb += abLocDefined[u32LocIndex];
+    }
+    u64LocSize = (uint64)(strLocIndex.ptrEnd - strLocIndex.ptrBegin);
+    LogDecoder_vidIndexInputIdentity(ptrInputPath, &strLocIdentity);
+
+    /* Header : format, then the log and the options it was built with                            */
+    ptrLocHeader = (const LogDecoder_strIndexHeaderType *)strLocIndex.ptrBegin;
+    if(  (u64LocSize >= sizeof(LogDecoder_strIndexHeaderType))
+      && (memcmp(ptrLocHeader->acMagic, INDEX_MAGIC, INDEX_MAGIC_LENGTH) == 0)
+      && (ptrLocHeader->u16Version == INDEX_VERSION)
+      && (ptrLocHeader->u32ByteOrder == (uint32p)INDEX_BYTE_ORDER)
+      && (ptrLocHeader->u16IdsNb == u32LocIdsNb)
+      && (memcmp(ptrLocHeader->abDefined, abLocDefined, sizeof(abLocDefined)) == 0)
+      && (ptrLocHeader->bWrap16 == ptrContext->bWrap16)
+      && (ptrLocHeader->u64InputSize <= strLocIdentity.u64Size)
+      && (ptrLocHeader->u64EntriesNb > 0U)
+      && (ptrLocHeader->u64EntriesNb <= (u64LocSize / sizeof(LogDecoder_strIndexEntryType)))
+      && (u64LocSize == (  sizeof(LogDecoder_strIndexHeaderType)
+                         + (ptrLocHeader->u64EntriesNb * (  sizeof(LogDecoder_strIndexEntryType)
+                                                          + (u32LocIdsNb * sizeof(LogDecoder_strFrameStateType)))))) )
+    {
+        ptrLocEntries = (const LogDecoder_strIndexEntryType *)(strLocIndex.ptrBegin
+                                                               + sizeof(LogDecoder_strIndexHeaderType));
+        ptrLocStates  = (const LogDecoder_strFrameStateType *)(ptrLocEntries + ptrLocHeader->u64EntriesNb);
+        /* Log unchanged since the build, or still the same bytes where the entries point         */
+        if(  (strLocIdentity.u64Time == 0U) || (strLocIdentity.u64Inode != ptrLocHeader->u64InputInode)
+          || (strLocIdentity.u64Time != ptrLocHeader->u64InputTime)
+          || (strLocIdentity.u64Size != ptrLocHeader->u64InputSize) )
+        {
+            if(  (LogDecoder_bIndexInputHash(ptrInputPath, ptrLocEntries, ptrLocHeader->u64EntriesNb,
+                                             ptrLocHeader->u64InputSize, &u64LocHash) == FALSE)
+              || (u64LocHash != ptrLocHeader->u64InputHash) )
+            {
+                ptrLocEntries = NULL;
+            }
+        }
+    }
+
+    if(ptrLocEntries != NULL)
+    {
+        /* The largest timestamp before an entry only grows, the last entry before the range      */
+        u64LocFirst = ptrLocHeader->u64EntriesNb - 1U;
+        while((u64LocFirst > 0U) && (ptrLocEntries[u64LocFirst].u64MaxTimestampBefore >= ptrSelect->u64FromTimestamp))
+        {
+            u64LocFirst--;
+        }
+        /* The smallest timestamp after an entry only grows, the first entry after the range      */
+        u64LocLast = u64LocFirst + 1U;
+        while(  (u64LocLast < ptrLocHeader->u64EntriesNb)
+             && (ptrLocEntries[u64LocLast].u64MinTimestampAfter <= ptrSelect->u64ToTimestamp) )
+        {
+            u64LocLast++;
+        }
+
+        ptrRange->u64BeginOffset = ptrLocEntries[u64LocFirst].u64Offset;
+        ptrRange->u64RowNumber   = ptrLocEntries[u64LocFirst].u64RowNumber;
+        /* Rows appended after the build are not described by the entries, they are all decoded   */
+        ptrRange->u64EndOffset   = (  (u64LocLast < ptrLocHeader->u64EntriesNb)
+                                   && (ptrLocHeader->u64InputSize == strLocIdentity.u64Size) )
+                                   ? ptrLocEntries[u64LocLast].u64Offset : INDEX_END_OF_INPUT;
+
+        LogDecoder_vidReset(ptrContext);
+        ptrLocStates += u64LocFirst * u32LocIdsNb;
+        for(u32LocIndex = 0U; u32LocIndex < FRAME_IDS_NUMBER; u32LocIndex++)
+        {
+            if(abLocDefined[u32LocIndex] == TRUE)
+            {
+                ptrContext->astrFrameState[u32LocIndex] = *ptrLocStates;
+                ptrLocStates++;
+            }
+        }
+        u8LocStatus = INDEX_LOOKUP_OK;
+    }
+    LogDecoder_vidInputClose(&strLocIndex);
+
+    return u8LocStatus;
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,99 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Sparse timestamp index of a .csv log, written next to it as a sidecar file. Every Nth row, an       */
+/*                entry gives the position of the row in the log and the tracking state of every frame ID at that     */
+/*                row, so that a time range is decoded from the nearest entry with the rows of a full decoding.       */
+/*                                                                                                                    */
+/*  File        : log_decoder_Index.h                                                                                 */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_INDEX_H
+#define LOG_DECODER_INDEX_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+#include "log_decoder_Batch.h"
+#include "log_decoder_Input.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/*---------------------------------- Format ----------------------------------*/
+/* The index of "log.csv" is "log.csv.idx"                                                                            */
+#define INDEX_FILE_EXTENSION            ".idx"
+#define INDEX_MAGIC                     "LDCI"
+#define INDEX_MAGIC_LENGTH              4U
+#define INDEX_VERSION                   2U
+/* Written in the native byte order, a reader with another byte order rejects the file                                */
+#define INDEX_BYTE_ORDER                0x01020304UL
+/* Bytes of the log hashed at every entry and at the end of the indexed rows, to detect a rewritten log               */
+#define INDEX_CHECK_BYTES               64U
+/* Default number of rows between two entries                                                                         */
+#define INDEX_INTERVAL_ROWS             (64U * 1024U)
+/* End offset of a range which goes to the end of the log                                                             */
+#define INDEX_END_OF_INPUT              UINT64_MAX
+/*------------------------------- Build status -------------------------------*/
+#define INDEX_BUILD_DONE                0U
+#define INDEX_BUILD_ROW_ERROR           1U
+#define INDEX_BUILD_NO_MEMORY           2U
+#define INDEX_BUILD_WRITE_ERROR         3U
+/*------------------------------ Lookup status -------------------------------*/
+#define INDEX_LOOKUP_OK                 0U
+#define INDEX_LOOKUP_MISSING            1U
+#define INDEX_LOOKUP_MISMATCH           2U
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+/*-------------------------------- File layout -------------------------------*/
+/* Header, then the entries, then u16IdsNb tracking states (LogDecoder_strFrameStateType) per entry                   */
+typedef struct
+{
+    char    acMagic[INDEX_MAGIC_LENGTH];
+    uint16  u16Version;
+    uint16  u16IdsNb;                       /* Frame IDs of the registry, tracked in every entry        */
+    uint32p u32ByteOrder;
+    uint32p u32Interval;                    /* Rows between two entries                                 */
+    uint64  u64InputSize;                   /* Bytes of the log covered by the entries                  */
+    uint64  u64EntriesNb;
+    uint64  u64InputInode;                  /* File serial number of the log at the build, 0 if unknown */
+    uint64  u64InputTime;                   /* Last change of the log at the build in ns, 0 if unknown  */
+    uint64  u64InputHash;                   /* Hash of the log bytes at the entries and at the end      */
+    boolean abDefined[FRAME_IDS_NUMBER];    /* Frame IDs of the registry used to build the index        */
+    boolean bWrap16;                        /* Built with 16-bit source counters                        */
+    uint8   au8Reserved[7];
+}LogDecoder_strIndexHeaderType;
+typedef struct
+{
+    uint64  u64Offset;                      /* Position of the row in the log                           */
+    uint64  u64RowNumber;                   /* Rows of the log before this row, header excluded         */
+    uint64  u64MaxTimestampBefore;          /* Largest timestamp of the rows before this row            */
+    uint64  u64MinTimestampAfter;           /* Smallest timestamp of this row and of the next ones      */
+}LogDecoder_strIndexEntryType;
+/*---------------------------------- Lookup ----------------------------------*/
+typedef struct
+{
+    uint64  u64BeginOffset;                 /* First row to be decoded                                  */
+    uint64  u64EndOffset;                   /* No selected row from here, INDEX_END_OF_INPUT if unknown */
+    uint64  u64RowNumber;                   /* Rows of the log before u64BeginOffset                    */
+}LogDecoder_strIndexRangeType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8IndexBuild(LogDecoder_strContextType *ptrContext, LogDecoder_strInputType *ptrInput,
+                              const char *ptrCursor, const char *ptrInputPath, uint32 u32Interval,
+                              uint32 *ptrRowNumber);
+uint8 LogDecoder_u8IndexLookup(LogDecoder_strContextType *ptrContext, const char *ptrInputPath,
+                               const LogDecoder_strSelectType *ptrSelect, LogDecoder_strIndexRangeType *ptrRange);
+
+#endif /* LOG_DECODER_INDEX_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
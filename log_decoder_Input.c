@@ -0,0 +1,713 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Input backend. Regular files are memory-mapped read-only and handed to the parser as a single       */
+/*                contiguous [begin, end) byte range, pipes and character devices are read in large blocks            */
+/*                through a streaming fallback. A followed file is always streamed, its end is polled for appended    */
+/*                data until a stop is requested. Once started, a reader thread reads the stream ahead of the parser, */
+/*                or touches the pages of the mapped file ahead of it, so that the disk and the decoding overlap.     */
+/*                                                                                                                    */
+/*  File        : log_decoder_Input.c                                                                                 */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_bInputMap                                                                                           */
+/* 2 / LogDecoder_u32InputRead                                                                                        */
+/* 3 / LogDecoder_vidInputWait                                                                                        */
+/* 4 / LogDecoder_s32InputReader                                                                                      */
+/* 5 / LogDecoder_s32InputPrefetch                                                                                    */
+/* 6 / LogDecoder_ptrInputReaderNew                                                                                   */
+/* 7 / LogDecoder_vidInputReaderRelease                                                                               */
+/* 8 / LogDecoder_bInputOpen                                                                                          */
+/* 9 / LogDecoder_bInputRefill                                                                                        */
+/* 10 / LogDecoder_bInputLoad                                                                                         */
+/* 11 / LogDecoder_u64InputOffset                                                                                     */
+/* 12 / LogDecoder_bInputSeek                                                                                         */
+/* 13 / LogDecoder_bInputStart                                                                                        */
+/* 14 / LogDecoder_vidInputStop                                                                                       */
+/* 15 / LogDecoder_vidInputClose                                                                                      */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#define INPUT_POSIX_IO
+#endif
+
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "log_decoder_Input.h"
+
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+#ifdef INPUT_POSIX_IO
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+/* Set from a signal handler to end the followed inputs at their current end                                          */
+static volatile sig_atomic_t LogDecoder_s32InputStopRequest = 0;
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bInputMap(LogDecoder_strInputType *ptrInput);
+static size_t LogDecoder_u32InputRead(FILE *ptrFile, char *ptrDestination, size_t u32Size);
+static void LogDecoder_vidInputWait(uint32 u32Period);
+static int LogDecoder_s32InputReader(void *ptrArgument);
+static int LogDecoder_s32InputPrefetch(void *ptrArgument);
+static LogDecoder_strInputReaderType *LogDecoder_ptrInputReaderNew(size_t u32DataSize);
+static void LogDecoder_vidInputReaderRelease(LogDecoder_strInputReaderType *ptrReader);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bInputMap                                                                                */
+/* !Description : Map the opened file read-only if it is a regular file, with a sequential access hint                */
+/*                                                                                                                    */
+/* !Inputs      : ptrInput                      !Comment : Opened input, ptrFile is valid                             */
+/* !Outputs     : bLocMapped                    !Comment : TRUE if the whole file is now in the data window           */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bInputMap(LogDecoder_strInputType *ptrInput)
+{
+    boolean bLocMapped = FALSE;
+#ifdef INPUT_POSIX_IO
+    struct stat strLocFileStat;
+    void *ptrLocMapping = MAP_FAILED;
+
+    if(  (fstat(fileno(ptrInput->ptrFile), &strLocFileStat) == 0) && (S_ISREG(strLocFileStat.st_mode))
+      && ((uint64)strLocFileStat.st_size <= (uint64)SIZE_MAX) )
+    {
+        if(strLocFileStat.st_size == 0)
+        {
+            /* Nothing to map, an empty file is an empty window                                   */
+            bLocMapped = TRUE;
+        }
+        else
+        {
+            ptrLocMapping = mmap(NULL, (size_t)strLocFileStat.st_size, PROT_READ, MAP_PRIVATE,
+                                 fileno(ptrInput->ptrFile), 0);
+            if(ptrLocMapping != MAP_FAILED)
+            {
+                /* The parser walks the file once from the start to the end                       */
+                (void)posix_madvise(ptrLocMapping, (size_t)strLocFileStat.st_size, POSIX_MADV_SEQUENTIAL);
+                ptrInput->ptrMapping     = ptrLocMapping;
+                ptrInput->u32MappingSize = (size_t)strLocFileStat.st_size;
+                ptrInput->ptrBegin       = (const char *)ptrLocMapping;
+                ptrInput->ptrEnd         = ptrInput->ptrBegin + ptrInput->u32MappingSize;
+                bLocMapped = TRUE;
+            }
+        }
+    }
+#else
+    (void)ptrInput;
+#endif
+
+    return bLocMapped;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32InputRead                                                                             */
+/* !Description : Read the next bytes available from the streaming source                                             */
+/*                                                                                                                    */
+/* !Inputs      : ptrFile                       !Comment : Opened streaming source                                    */
+/*                ptrDestination                !Comment : Where to store the read bytes                              */
+/*                u32Size                       !Comment : Free space at ptrDestination                               */
+/* !Outputs     : u32LocReadSize                !Comment : Number of read bytes, 0 at the end of the input            */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static size_t LogDecoder_u32InputRead(FILE *ptrFile, char *ptrDestination, size_t u32Size)
+{
+    size_t u32LocReadSize = FALSE;
+#ifdef INPUT_POSIX_IO
+    ssize_t s32LocResult = 0;
+
+    /* A single read() returns whatever the pipe holds, the parser asks again for partial rows    */
+    do
+    {
+        s32LocResult = read(fileno(ptrFile), ptrDestination, u32Size);
+    } while((s32LocResult < 0) && (errno == EINTR));
+    u32LocReadSize = (s32LocResult > 0) ? (size_t)s32LocResult : 0U;
+#else
+    u32LocReadSize = fread(ptrDestination, 1U, u32Size, ptrFile);
+#endif
+
+    return u32LocReadSize;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidInputWait                                                                             */
+/* !Description : Wait before polling a followed file again, a signal ends the wait early                             */
+/*                                                                                                                    */
+/* !Inputs      : u32Period                     !Comment : Waiting time in ms                                         */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidInputWait(uint32 u32Period)
+{
+#ifndef __STDC_NO_THREADS__
+    struct timespec strLocDuration;
+
+    strLocDuration.tv_sec  = (time_t)(u32Period / 1000U);
+    strLocDuration.tv_nsec = (long)(u32Period % 1000U) * 1000000L;
+    (void)thrd_sleep(&strLocDuration, NULL);
+#else
+    /* No portable sleep, the end of the file is polled again at once                             */
+    (void)u32Period;
+#endif
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32InputReader                                                                           */
+/* !Description : Reader thread of a stream. Every free block is filled after its INPUT_STREAM_BLOCK_SIZE first       */
+/*                bytes, which are kept for the partial row of the previous block, and handed to the parser. An       */
+/*                empty block ends the stream. The reader is let go at the end, and freed if the input is closed.     */
+/*                                                                                                                    */
+/* !Inputs      : ptrArgument                   !Comment : Reader of a stream (LogDecoder_strInputReaderType)         */
+/* !Outputs     : s32LocResult                  !Comment : Always 0                                                   */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32InputReader(void *ptrArgument)
+{
+    LogDecoder_strInputReaderType *ptrLocReader = (LogDecoder_strInputReaderType *)ptrArgument;
+    LogDecoder_strBlockType *ptrLocBlock = NULL;
+    size_t u32LocReadSize = FALSE;
+
+    do
+    {
+        ptrLocBlock = LogDecoder_ptrQueueGet(&ptrLocReader->strStage.strFree);
+        u32LocReadSize = FALSE;
+        if(ptrLocReader->strStage.bStop == FALSE)
+        {
+            u32LocReadSize = LogDecoder_u32InputRead(ptrLocReader->ptrFile,
+                                                     ptrLocBlock->ptrData + INPUT_STREAM_BLOCK_SIZE,
+                                                     INPUT_STREAM_BLOCK_SIZE);
+        }
+        ptrLocBlock->u32Size = u32LocReadSize;
+        LogDecoder_vidQueuePut(&ptrLocReader->strStage.strFull, ptrLocBlock);
+    } while(u32LocReadSize != 0U);
+    LogDecoder_vidInputReaderRelease(ptrLocReader);
+
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32InputPrefetch                                                                         */
+/* !Description : Reader thread of a mapped file. The file is walked one window of INPUT_STREAM_BLOCK_SIZE bytes at a */
+/*                time, one byte of every page is read so that the page faults wait for the disk in this thread, and  */
+/*                the window is handed to the parser. At most PIPELINE_QUEUE_DEPTH windows are ahead of the parser.   */
+/*                                                                                                                    */
+/* !Inputs      : ptrArgument                   !Comment : Reader of a mapped file (LogDecoder_strInputReaderType)    */
+/* !Outputs     : s32LocResult                  !Comment : Always 0                                                   */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32InputPrefetch(void *ptrArgument)
+{
+    LogDecoder_strInputReaderType *ptrLocReader = (LogDecoder_strInputReaderType *)ptrArgument;
+    LogDecoder_strBlockType *ptrLocBlock = NULL;
+    const volatile char *ptrLocPage = NULL;
+    size_t u32LocSize = FALSE;
+
+    while((ptrLocReader->ptrPrefetch < ptrLocReader->ptrMappingEnd) && (ptrLocReader->strStage.bStop == FALSE))
+    {
+        ptrLocBlock = LogDecoder_ptrQueueGet(&ptrLocReader->strStage.strFree);
+        u32LocSize  = (size_t)(ptrLocReader->ptrMappingEnd - ptrLocReader->ptrPrefetch);
+        u32LocSize  = (u32LocSize < INPUT_STREAM_BLOCK_SIZE) ? u32LocSize : INPUT_STREAM_BLOCK_SIZE;
+        for(ptrLocPage = ptrLocReader->ptrPrefetch; ptrLocPage < (ptrLocReader->ptrPrefetch + u32LocSize);
+            ptrLocPage += INPUT_PAGE_SIZE)
+        {
+            (void)*ptrLocPage;
+        }
+        ptrLocBlock->ptrData = (char *)ptrLocReader->ptrPrefetch;
+        ptrLocBlock->u32Size = u32LocSize;
+        ptrLocReader->ptrPrefetch += u32LocSize;
+        LogDecoder_vidQueuePut(&ptrLocReader->strStage.strFull, ptrLocBlock);
+    }
+    LogDecoder_vidInputReaderRelease(ptrLocReader);
+
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrInputReaderNew                                                                        */
+/* !Description : Allocate the reader of an input, used by the input and by the reader thread until both let it go    */
+/*                                                                                                                    */
+/* !Inputs      : u32DataSize                   !Comment : Bytes of each read block, 0 when the blocks are windows of */
+/*                                                         the mapped file                                            */
+/* !Outputs     : ptrLocReader                  !Comment : Reader with its blocks, NULL without memory                */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static LogDecoder_strInputReaderType *LogDecoder_ptrInputReaderNew(size_t u32DataSize)
+{
+    LogDecoder_strInputReaderType *ptrLocReader = calloc(1U, sizeof(LogDecoder_strInputReaderType));
+    uint32 u32LocIndex = FALSE;
+
+    if((ptrLocReader != NULL) && (u32DataSize != 0U))
+    {
+        ptrLocReader->ptrData = malloc(PIPELINE_QUEUE_DEPTH * u32DataSize);
+        if(ptrLocReader->ptrData == NULL)
+        {
+            free(ptrLocReader);
+            return NULL;
+        }
+        for(u32LocIndex = 0U; u32LocIndex < PIPELINE_QUEUE_DEPTH; u32LocIndex++)
+        {
+            ptrLocReader->astrBlock[u32LocIndex].ptrData = ptrLocReader->ptrData + (u32LocIndex * u32DataSize);
+        }
+    }
+    if(ptrLocReader != NULL)
+    {
+        ptrLocReader->u32OwnersNb = 2U;
+    }
+
+    return ptrLocReader;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidInputReaderRelease                                                                    */
+/* !Description : Let the reader go, from the reader thread when it returns or from the input when it is closed. The  */
+/*                last of the two frees the reader : its queues, its blocks and the stream it read, stdin excepted.   */
+/*                                                                                                                    */
+/* !Inputs      : ptrReader                     !Comment : Reader of a started stage                                  */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidInputReaderRelease(LogDecoder_strInputReaderType *ptrReader)
+{
+    /* Atomic decrement, a single thread sees the reader let go by both                           */
+    if(--ptrReader->u32OwnersNb == 0U)
+    {
+        LogDecoder_vidStageRelease(&ptrReader->strStage);
+        if((ptrReader->ptrFile != NULL) && (ptrReader->ptrFile != stdin))
+        {
+            fclose(ptrReader->ptrFile);
+        }
+        free(ptrReader->ptrData);
+        free(ptrReader);
+    }
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bInputOpen                                                                               */
+/* !Description : Open the input file, map it when possible else prepare the streaming block and read it. A followed  */
+/*                regular file is never mapped, the data appended to it after the open must still be read.            */
+/*                                                                                                                    */
+/* !Inputs      : ptrPath                       !Comment : Path of the input file                                     */
+/*                u32FollowPeriod               !Comment : Polling period in ms to follow the file, 0 to read it once */
+/* !Outputs     : ptrInput                      !Comment : Input with its first data window                           */
+/*                bLocStatus                    !Comment : TRUE if the input is ready                                 */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 8                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bInputOpen(LogDecoder_strInputType *ptrInput, const char *ptrPath, uint32 u32FollowPeriod)
+{
+    boolean bLocStatus = FALSE;
+#ifdef INPUT_POSIX_IO
+    struct stat strLocFileStat;
+#endif
+
+    memset(ptrInput, 0, sizeof(*ptrInput));
+    ptrInput->ptrFile = (strcmp(ptrPath, INPUT_STDIN_PATH) == 0) ? stdin : fopen(ptrPath, "rb");
+
+    if(ptrInput->ptrFile != NULL)
+    {
+        ptrInput->u32FollowPeriod = u32FollowPeriod;
+#ifdef INPUT_POSIX_IO
+        /* A read on a pipe already waits for the data, its end is the end of the input           */
+        if(  (fstat(fileno(ptrInput->ptrFile), &strLocFileStat) != 0)
+          || (!S_ISREG(strLocFileStat.st_mode)) )
+        {
+            ptrInput->u32FollowPeriod = FALSE;
+        }
+#endif
+        if((u32FollowPeriod == 0U) && (LogDecoder_bInputMap(ptrInput) == TRUE))
+        {
+            ptrInput->bLastBlock = TRUE;
+            bLocStatus = TRUE;
+        }
+        else
+        {
+            ptrInput->ptrBuffer = malloc(INPUT_STREAM_BLOCK_SIZE);
+            if(ptrInput->ptrBuffer != NULL)
+            {
+                ptrInput->ptrBegin = ptrInput->ptrBuffer;
+                ptrInput->ptrEnd   = ptrInput->ptrBuffer;
+                bLocStatus = LogDecoder_bInputRefill(ptrInput, ptrInput->ptrBegin);
+            }
+        }
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bInputRefill                                                                             */
+/* !Description : Keep the unconsumed bytes [ptrConsumed, ptrEnd) and append the next data of the stream. When a      */
+/*                followed file has no new data, wait one polling period and return with the same data window. With   */
+/*                a reader thread, the next read block is taken and the unconsumed bytes are copied in front of its   */
+/*                data, or the window of a mapped file is extended to the next page range read ahead.                 */
+/*                                                                                                                    */
+/* !Inputs      : ptrInput                      !Comment : Opened input                                               */
+/*                ptrConsumed                   !Comment : First byte not yet consumed by the parser                  */
+/* !Outputs     : bLocStatus                    !Comment : FALSE if there is no room left for new data                */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 9                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bInputRefill(LogDecoder_strInputType *ptrInput, const char *ptrConsumed)
+{
+    boolean bLocStatus = FALSE;
+    size_t u32LocRemaining = (size_t)(ptrInput->ptrEnd - ptrConsumed);
+    size_t u32LocReadSize = FALSE;
+    LogDecoder_strBlockType *ptrLocBlock = NULL;
+
+    if((ptrInput->ptrBuffer == NULL) && (ptrInput->ptrReader != NULL))
+    {
+        /* Mapped file read ahead : the window ends where the reader thread has got so far        */
+        ptrInput->ptrBegin = ptrConsumed;
+        if(ptrInput->bLastBlock == FALSE)
+        {
+            ptrLocBlock = LogDecoder_ptrQueueGet(&ptrInput->ptrReader->strStage.strFull);
+            LogDecoder_vidQueuePut(&ptrInput->ptrReader->strStage.strFree, ptrInput->ptrBlock);
+            ptrInput->ptrBlock   = ptrLocBlock;
+            ptrInput->ptrEnd     = ptrLocBlock->ptrData + ptrLocBlock->u32Size;
+            ptrInput->bLastBlock = (boolean)(ptrInput->ptrEnd == ((const char *)ptrInput->ptrMapping
+                                                                  + ptrInput->u32MappingSize));
+        }
+        bLocStatus = TRUE;
+    }
+    else if(ptrInput->ptrBuffer == NULL)
+    {
+        /* A mapped file is already complete                                                      */
+        ptrInput->ptrBegin = ptrConsumed;
+        bLocStatus = TRUE;
+    }
+    else if(  (ptrInput->ptrReader == NULL) && (ptrInput->bLastBlock == FALSE)
+           && (u32LocRemaining < INPUT_STREAM_BLOCK_SIZE) )
+    {
+        /* Move the partial row to the start of the block and read the next data                  */
+        ptrInput->u64Offset += (uint64)(ptrConsumed - ptrInput->ptrBuffer);
+        memmove(ptrInput->ptrBuffer, ptrConsumed, u32LocRemaining);
+        u32LocReadSize = LogDecoder_u32InputRead(ptrInput->ptrFile, ptrInput->ptrBuffer + u32LocRemaining,
+                                                 INPUT_STREAM_BLOCK_SIZE - u32LocRemaining);
+        ptrInput->bLastBlock = (boolean)(  ((u32LocReadSize == 0U) && (ptrInput->u32FollowPeriod == 0U))
+                                         || (LogDecoder_s32InputStopRequest != 0) );
+        ptrInput->ptrBegin   = ptrInput->ptrBuffer;
+        ptrInput->ptrEnd     = ptrInput->ptrBuffer + u32LocRemaining + u32LocReadSize;
+        if((u32LocReadSize == 0U) && (ptrInput->bLastBlock == FALSE))
+        {
+            /* Nothing appended yet to the followed file, the end of file flag is cleared to retry */
+            LogDecoder_vidInputWait(ptrInput->u32FollowPeriod);
+            clearerr(ptrInput->ptrFile);
+        }
+        bLocStatus = TRUE;
+    }
+    else if((ptrInput->bLastBlock == FALSE) && (u32LocRemaining < INPUT_STREAM_BLOCK_SIZE))
+    {
+        /* The partial row goes in front of the next read block, the previous block is given back */
+        ptrLocBlock = LogDecoder_ptrQueueGet(&ptrInput->ptrReader->strStage.strFull);
+        memcpy(ptrLocBlock->ptrData + INPUT_STREAM_BLOCK_SIZE - u32LocRemaining, ptrConsumed, u32LocRemaining);
+        ptrInput->u64Offset += (uint64)(ptrConsumed - ptrInput->ptrBegin);
+        if(ptrInput->ptrBlock != NULL)
+        {
+            LogDecoder_vidQueuePut(&ptrInput->ptrReader->strStage.strFree, ptrInput->ptrBlock);
+        }
+        ptrInput->ptrBlock   = ptrLocBlock;
+        ptrInput->bLastBlock = (boolean)(ptrLocBlock->u32Size == 0U);
+        ptrInput->ptrBegin   = ptrLocBlock->ptrData + INPUT_STREAM_BLOCK_SIZE - u32LocRemaining;
+        ptrInput->ptrEnd     = ptrLocBlock->ptrData + INPUT_STREAM_BLOCK_SIZE + ptrLocBlock->u32Size;
+        bLocStatus = TRUE;
+    }
+    else
+    {
+        /* Either the stream is over or a single row is longer than the whole block               */
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bInputLoad                                                                               */
+/* !Description : Make the whole input available as a single data window, for the readers that need random            */
+/*                access. A mapped file is already complete, a stream is read to its end in a growing block.          */
+/*                                                                                                                    */
+/* !Inputs      : ptrInput                      !Comment : Input just opened, nothing consumed yet                    */
+/* !Outputs     : ptrInput                      !Comment : Input with [ptrBegin, ptrEnd) holding all the data         */
+/*                bLocStatus                    !Comment : FALSE if there is not enough memory                        */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 10                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bInputLoad(LogDecoder_strInputType *ptrInput)
+{
+    char *ptrLocBuffer = NULL;
+    size_t u32LocSize = (size_t)(ptrInput->ptrEnd - ptrInput->ptrBegin);
+    size_t u32LocCapacity = INPUT_STREAM_BLOCK_SIZE;
+    size_t u32LocReadSize = FALSE;
+
+    while(ptrInput->bLastBlock == FALSE)
+    {
+        if(u32LocSize == u32LocCapacity)
+        {
+            /* Double the block, the data read so far is kept at its start                        */
+            ptrLocBuffer = realloc(ptrInput->ptrBuffer, 2U * u32LocCapacity);
+            if(ptrLocBuffer == NULL)
+            {
+                return FALSE;
+            }
+            ptrInput->ptrBuffer = ptrLocBuffer;
+            u32LocCapacity = 2U * u32LocCapacity;
+        }
+        u32LocReadSize = LogDecoder_u32InputRead(ptrInput->ptrFile, ptrInput->ptrBuffer + u32LocSize,
+                                                 u32LocCapacity - u32LocSize);
+        u32LocSize += u32LocReadSize;
+        ptrInput->bLastBlock = (boolean)(u32LocReadSize == 0U);
+        ptrInput->ptrBegin   = ptrInput->ptrBuffer;
+        ptrInput->ptrEnd     = ptrInput->ptrBuffer + u32LocSize;
+    }
+
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u64InputOffset                                                                           */
+/* !Description : Get the position in the file of a byte of the current data window                                   */
+/*                                                                                                                    */
+/* !Inputs      : ptrInput                      !Comment : Opened input                                               */
+/*                ptrCursor                     !Comment : Byte of the data window [ptrBegin, ptrEnd]                 */
+/* !Outputs     : u64LocOffset                  !Comment : Number of bytes of the file before ptrCursor               */
+/* !Number      : 11                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint64 LogDecoder_u64InputOffset(const LogDecoder_strInputType *ptrInput, const char *ptrCursor)
+{
+    const char *ptrLocBase = (ptrInput->ptrMapping != NULL) ? (const char *)ptrInput->ptrMapping : ptrInput->ptrBegin;
+    uint64 u64LocOffset = ptrInput->u64Offset;
+
+    if(ptrLocBase != NULL)
+    {
+        u64LocOffset += (uint64)(ptrCursor - ptrLocBase);
+    }
+
+    return u64LocOffset;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bInputSeek                                                                               */
+/* !Description : Move the data window to the given position of the file. A mapped file only moves its window, a      */
+/*                streamed regular file is repositioned and read again from there. A pipe cannot be repositioned.     */
+/*                                                                                                                    */
+/* !Inputs      : ptrInput                      !Comment : Opened input, nothing consumed after the seek position     */
+/*                u64Offset                     !Comment : New position, the start of a row                           */
+/* !Outputs     : ptrInput                      !Comment : Input with its data window starting at u64Offset           */
+/*                bLocStatus                    !Comment : FALSE if the input did not move                            */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 12                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bInputSeek(LogDecoder_strInputType *ptrInput, uint64 u64Offset)
+{
+    boolean bLocStatus = FALSE;
+
+    if(ptrInput->ptrBuffer == NULL)
+    {
+        if(u64Offset <= (uint64)ptrInput->u32MappingSize)
+        {
+            ptrInput->ptrBegin = (const char *)ptrInput->ptrMapping + u64Offset;
+            bLocStatus = TRUE;
+        }
+    }
+    else if(  (ptrInput->ptrFile != stdin) && (u64Offset <= (uint64)LONG_MAX)
+           && (fseek(ptrInput->ptrFile, (long)u64Offset, SEEK_SET) == 0) )
+    {
+        /* The block restarts empty at the new position                                           */
+        ptrInput->u64Offset  = u64Offset;
+        ptrInput->ptrBegin   = ptrInput->ptrBuffer;
+        ptrInput->ptrEnd     = ptrInput->ptrBuffer;
+        ptrInput->bLastBlock = FALSE;
+        bLocStatus = LogDecoder_bInputRefill(ptrInput, ptrInput->ptrBegin);
+    }
+    else
+    {
+        /* Pipe or position out of the reach of fseek                                             */
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bInputStart                                                                              */
+/* !Description : Start the reader thread, which then reads the input ahead of the parser. A stream gets              */
+/*                PIPELINE_QUEUE_DEPTH blocks of twice INPUT_STREAM_BLOCK_SIZE, a mapped file larger than one window  */
+/*                gets its first window at once. A followed file stays read by the parser thread, which waits for     */
+/*                its new data anyway. The input can no longer be repositioned.                                       */
+/*                                                                                                                    */
+/* !Inputs      : ptrInput                      !Comment : Opened input, after its last seek                          */
+/* !Outputs     : ptrInput                      !Comment : Input read by the reader thread                            */
+/*                bLocStatus                    !Comment : FALSE if the parser thread still reads the input           */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 13                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bInputStart(LogDecoder_strInputType *ptrInput)
+{
+    LogDecoder_strInputReaderType *ptrLocReader = NULL;
+    boolean bLocStatus = FALSE;
+
+    if(  (ptrInput->u32FollowPeriod != 0U) || (ptrInput->bLastBlock == TRUE)
+      || (ptrInput->ptrReader != NULL) )
+    {
+        /* Followed file, or nothing left to be read                                              */
+    }
+    else if(ptrInput->ptrBuffer == NULL)
+    {
+        if(  ((size_t)(ptrInput->ptrEnd - ptrInput->ptrBegin) > INPUT_STREAM_BLOCK_SIZE)
+          && ((ptrLocReader = LogDecoder_ptrInputReaderNew(0U)) != NULL) )
+        {
+            ptrLocReader->ptrPrefetch   = ptrInput->ptrBegin;
+            ptrLocReader->ptrMappingEnd = (const char *)ptrInput->ptrMapping + ptrInput->u32MappingSize;
+            bLocStatus = LogDecoder_bStageStart(&ptrLocReader->strStage, LogDecoder_s32InputPrefetch, ptrLocReader,
+                                                ptrLocReader->astrBlock, PIPELINE_QUEUE_DEPTH);
+        }
+        if(bLocStatus == TRUE)
+        {
+            /* The parser starts with the first window read ahead                                 */
+            ptrInput->ptrReader  = ptrLocReader;
+            ptrInput->ptrBlock   = LogDecoder_ptrQueueGet(&ptrLocReader->strStage.strFull);
+            ptrInput->ptrEnd     = ptrInput->ptrBlock->ptrData + ptrInput->ptrBlock->u32Size;
+            ptrInput->bLastBlock = FALSE;
+        }
+    }
+    else
+    {
+        ptrLocReader = LogDecoder_ptrInputReaderNew(2U * INPUT_STREAM_BLOCK_SIZE);
+        if(ptrLocReader != NULL)
+        {
+            ptrLocReader->ptrFile = ptrInput->ptrFile;
+            bLocStatus = LogDecoder_bStageStart(&ptrLocReader->strStage, LogDecoder_s32InputReader, ptrLocReader,
+                                                ptrLocReader->astrBlock, PIPELINE_QUEUE_DEPTH);
+        }
+        if(bLocStatus == TRUE)
+        {
+            /* The current window stays in the streaming block until the first refill             */
+            ptrInput->ptrReader = ptrLocReader;
+            ptrInput->ptrBlock  = NULL;
+        }
+    }
+    if((bLocStatus == FALSE) && (ptrLocReader != NULL))
+    {
+        free(ptrLocReader->ptrData);
+        free(ptrLocReader);
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidInputStop                                                                             */
+/* !Description : Request the followed inputs to end at their current end of file. Only sets a flag, so it can be     */
+/*                called from a signal handler.                                                                       */
+/*                                                                                                                    */
+/* !Number      : 14                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidInputStop(void)
+{
+    LogDecoder_s32InputStopRequest = 1;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidInputClose                                                                            */
+/* !Description : Stop the reader thread, release the mapping or the streaming blocks and close the input file, stdin */
+/*                is left open. A reader thread which may be waiting for a pipe that is never closed is detached      */
+/*                instead, its reader is freed and its file closed by the thread itself when its read returns.        */
+/*                                                                                                                    */
+/* !Inputs      : ptrInput                      !Comment : Input to be closed                                         */
+/* !Number      : 15                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidInputClose(LogDecoder_strInputType *ptrInput)
+{
+    LogDecoder_strInputReaderType *ptrLocReader = ptrInput->ptrReader;
+
+    if(ptrLocReader == NULL)
+    {
+        /* The parser thread read the input                                                       */
+    }
+    else if((ptrInput->ptrBuffer != NULL) && (ptrInput->bLastBlock == FALSE))
+    {
+        /* The decoding ended before the end of the stream : the reader thread keeps the stream,  */
+        /* it is closed with the reader by the last of the two threads                            */
+        LogDecoder_vidStageStop(&ptrLocReader->strStage, FALSE);
+        ptrInput->ptrFile = NULL;
+        LogDecoder_vidInputReaderRelease(ptrLocReader);
+    }
+    else
+    {
+        /* The pages being read ahead must not be unmapped under the reader thread                */
+        LogDecoder_vidStageStop(&ptrLocReader->strStage, TRUE);
+        free(ptrLocReader->ptrData);
+        free(ptrLocReader);
+    }
+#ifdef INPUT_POSIX_IO
+    if(ptrInput->ptrMapping != NULL)
+    {
+        (void)munmap(ptrInput->ptrMapping, ptrInput->u32MappingSize);
+    }
+#endif
+    free(ptrInput->ptrBuffer);
+    if((ptrInput->ptrFile != NULL) && (ptrInput->ptrFile != stdin))
+    {
+        fclose(ptrInput->ptrFile);
+    }
+    memset(ptrInput, 0, sizeof(*ptrInput));
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,79 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Input backend. Regular files are memory-mapped read-only and handed to the parser as a single       */
+/*                contiguous [begin, end) byte range, pipes and character devices are read in large blocks            */
+/*                through a streaming fallback. A followed file is always streamed, its end is polled for appended    */
+/*                data until a stop is requested. Once started, a reader thread reads the stream ahead of the parser, */
+/*                or touches the pages of the mapped file ahead of it, so that the disk and the decoding overlap.     */
+/*                                                                                                                    */
+/*  File        : log_decoder_Input.h                                                                                 */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_INPUT_H
+#define LOG_DECODER_INPUT_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder_Pipeline.h"
+#include "log_decoder_Types.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+#define INPUT_STREAM_BLOCK_SIZE         (4U * 1024U * 1024U)
+/* Step of the reader thread through a mapped file, one byte is read per page to bring the page in memory             */
+#define INPUT_PAGE_SIZE                 4096U
+/* Input path read from the standard input, always streamed                                                           */
+#define INPUT_STDIN_PATH                "-"
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+/* Reader thread of an input and what it reads, allocated apart from the input : a detached reader thread still uses  */
+/* it after the input is closed, the last of the two threads to let it go frees it                                    */
+typedef struct
+{
+    LogDecoder_strStageType  strStage;      /* Reader thread and its queues                                   */
+    LogDecoder_strBlockType  astrBlock[PIPELINE_QUEUE_DEPTH];   /* Read blocks, or read-ahead windows         */
+    char                    *ptrData;       /* Memory of the read blocks, NULL for a mapped file              */
+    FILE                    *ptrFile;       /* Stream read, NULL for a mapped file                            */
+    const char              *ptrPrefetch;   /* Next byte of the mapped file to be read ahead                  */
+    const char              *ptrMappingEnd; /* End of the mapped file                                         */
+    PIPELINE_ATOMIC uint32   u32OwnersNb;   /* Threads still using the reader, the input and its thread       */
+}LogDecoder_strInputReaderType;
+typedef struct
+{
+    const char *ptrBegin;           /* First byte of the data window handed to the parser                     */
+    const char *ptrEnd;             /* One past the last byte of the data window                              */
+    char       *ptrBuffer;          /* Streaming block, NULL when the file is mapped                          */
+    void       *ptrMapping;         /* Mapped file, NULL in streaming mode                                    */
+    size_t      u32MappingSize;
+    FILE       *ptrFile;            /* Streaming source                                                       */
+    uint64      u64Offset;          /* Position in the file of ptrBegin for a stream, of the mapping else     */
+    boolean     bLastBlock;         /* TRUE when no data follows ptrEnd                                       */
+    uint32      u32FollowPeriod;    /* Polling period in ms of a followed file, 0 when the file is read once  */
+    LogDecoder_strInputReaderType *ptrReader;   /* Reader thread, NULL when the parser thread reads           */
+    LogDecoder_strBlockType       *ptrBlock;    /* Block of the data window, NULL before the first one        */
+}LogDecoder_strInputType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+boolean LogDecoder_bInputOpen(LogDecoder_strInputType *ptrInput, const char *ptrPath, uint32 u32FollowPeriod);
+boolean LogDecoder_bInputRefill(LogDecoder_strInputType *ptrInput, const char *ptrConsumed);
+boolean LogDecoder_bInputLoad(LogDecoder_strInputType *ptrInput);
+uint64 LogDecoder_u64InputOffset(const LogDecoder_strInputType *ptrInput, const char *ptrCursor);
+boolean LogDecoder_bInputSeek(LogDecoder_strInputType *ptrInput, uint64 u64Offset);
+boolean LogDecoder_bInputStart(LogDecoder_strInputType *ptrInput);
+void LogDecoder_vidInputStop(void);
+void LogDecoder_vidInputClose(LogDecoder_strInputType *ptrInput);
+
+#endif /* LOG_DECODER_INPUT_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
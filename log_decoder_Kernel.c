@@ -0,0 +1,463 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Batch kernels working on structure-of-arrays frames : checksum validation and signal decoding       */
+/*                of N payloads at once, with SSE2 / AVX2 versions selected at run time from the CPU features         */
+/*                and a scalar version for the other targets.                                                         */
+/*                                                                                                                    */
+/*  File        : log_decoder_Kernel.c                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_vidChecksumScalar                                                                                   */
+/* 2 / LogDecoder_vidSignalScalar                                                                                     */
+/* 3 / LogDecoder_vidChecksumSse2                                                                                     */
+/* 4 / LogDecoder_vidSignalSse2                                                                                       */
+/* 5 / LogDecoder_vidChecksumAvx2                                                                                     */
+/* 6 / LogDecoder_vidSignalAvx2                                                                                       */
+/* 7 / LogDecoder_u8KernelResolve                                                                                     */
+/* 8 / LogDecoder_u8KernelLevel                                                                                       */
+/* 9 / LogDecoder_vidKernelSetLevel                                                                                   */
+/* 10 / LogDecoder_vidKernelChecksum                                                                                  */
+/* 11 / LogDecoder_vidKernelSignal                                                                                    */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder_Kernel.h"
+
+/* The SIMD kernels need the GCC / Clang target attribute and CPU detection, on x86 only                              */
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define KERNEL_X86_SIMD
+#include <immintrin.h>
+#endif
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define SHIFT_8BITS                      8U
+#define SHIFT_16BITS                     16U
+#define MASK_1BYTE                       0xFFU
+/* Two bytes of each 32 bits word, their sums never overflow a 16 bits half                                           */
+#define MASK_ODD_BYTES                   0x00FF00FFU
+#define SSE2_LANES_NUMBER                4U
+#define AVX2_LANES_NUMBER                8U
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+/* Kernel level used by the batch functions, resolved once from the CPU features, KERNEL_LEVEL_AUTO until then        */
+static uint8 LogDecoder_u8Level = KERNEL_LEVEL_AUTO;
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static void LogDecoder_vidChecksumScalar(const uint32p *ptrPayload, const uint8 *ptrChecksum, uint8 *ptrChecksumOK,
+                                         uint32 u32FramesNb);
+static void LogDecoder_vidSignalScalar(const uint32p *ptrPayload, uint32 u32FramesNb,
+                                       const LogDecoder_strSignalDefType *ptrSignal, sint32p *ptrValue);
+#ifdef KERNEL_X86_SIMD
+static void LogDecoder_vidChecksumSse2(const uint32p *ptrPayload, const uint8 *ptrChecksum, uint8 *ptrChecksumOK,
+                                       uint32 u32FramesNb);
+static void LogDecoder_vidSignalSse2(const uint32p *ptrPayload, uint32 u32FramesNb,
+                                     const LogDecoder_strSignalDefType *ptrSignal, sint32p *ptrValue);
+static void LogDecoder_vidChecksumAvx2(const uint32p *ptrPayload, const uint8 *ptrChecksum, uint8 *ptrChecksumOK,
+                                       uint32 u32FramesNb);
+static void LogDecoder_vidSignalAvx2(const uint32p *ptrPayload, uint32 u32FramesNb,
+                                     const LogDecoder_strSignalDefType *ptrSignal, sint32p *ptrValue);
+#endif
+static uint8 LogDecoder_u8KernelResolve(uint8 u8Level);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidChecksumScalar                                                                        */
+/* !Description : Checksum status of N frames, one frame at a time. The checksum is OK when the sum of the four       */
+/*                payload bytes plus the checksum byte is 0 (modulo 256).                                             */
+/*                                                                                                                    */
+/* !Inputs      : ptrPayload                    !Comment : Payloads of the frames                                     */
+/*                ptrChecksum                   !Comment : Checksums of the frames                                    */
+/*                u32FramesNb                   !Comment : Number of frames                                           */
+/* !Outputs     : ptrChecksumOK                 !Comment : Checksum status of each frame (TRUE / FALSE)               */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidChecksumScalar(const uint32p *ptrPayload, const uint8 *ptrChecksum, uint8 *ptrChecksumOK,
+                                         uint32 u32FramesNb)
+{
+    uint32 u32LocIndex = FALSE;
+    uint32p u32LocSum = FALSE;
+
+    for(u32LocIndex = 0U; u32LocIndex < u32FramesNb; u32LocIndex++)
+    {
+        /* Add the bytes two by two in the 16 bits halves, then add the two halves                */
+        u32LocSum = (ptrPayload[u32LocIndex] & MASK_ODD_BYTES)
+                  + ((ptrPayload[u32LocIndex] >> SHIFT_8BITS) & MASK_ODD_BYTES);
+        u32LocSum = u32LocSum + (u32LocSum >> SHIFT_16BITS) + ptrChecksum[u32LocIndex];
+        ptrChecksumOK[u32LocIndex] = (uint8)((u32LocSum & MASK_1BYTE) == 0U);
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSignalScalar                                                                          */
+/* !Description : Decode one signal of N payloads of the same frame ID, one payload at a time                         */
+/*                                                                                                                    */
+/* !Inputs      : ptrPayload                    !Comment : Payloads of the frames                                     */
+/*                u32FramesNb                   !Comment : Number of frames                                           */
+/*                ptrSignal                     !Comment : Compiled signal definition                                 */
+/* !Outputs     : ptrValue                      !Comment : Fixed-point value of the signal for each frame             */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidSignalScalar(const uint32p *ptrPayload, uint32 u32FramesNb,
+                                       const LogDecoder_strSignalDefType *ptrSignal, sint32p *ptrValue)
+{
+    uint32 u32LocIndex = FALSE;
+    uint32p u32LocRaw = FALSE;
+
+    /* 32 bits wrap-around arithmetic, the loaded schemas guarantee that the result fits          */
+    for(u32LocIndex = 0U; u32LocIndex < u32FramesNb; u32LocIndex++)
+    {
+        u32LocRaw = (ptrPayload[u32LocIndex] >> ptrSignal->u8BitOffset) & (uint32p)ptrSignal->u32Mask;
+        u32LocRaw = (u32LocRaw ^ (uint32p)ptrSignal->u32SignBit) - (uint32p)ptrSignal->u32SignBit;
+        u32LocRaw = (u32LocRaw + (uint32p)ptrSignal->s32Offset) * (uint32p)ptrSignal->s32Scale;
+        ptrValue[u32LocIndex] = (sint32p)u32LocRaw;
+    }
+}
+
+#ifdef KERNEL_X86_SIMD
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidChecksumSse2                                                                          */
+/* !Description : Checksum status of N frames, four frames per SSE2 register                                          */
+/*                                                                                                                    */
+/* !Inputs      : ptrPayload                    !Comment : Payloads of the frames                                     */
+/*                ptrChecksum                   !Comment : Checksums of the frames                                    */
+/*                u32FramesNb                   !Comment : Number of frames                                           */
+/* !Outputs     : ptrChecksumOK                 !Comment : Checksum status of each frame (TRUE / FALSE)               */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+__attribute__((target("sse2")))
+static void LogDecoder_vidChecksumSse2(const uint32p *ptrPayload, const uint8 *ptrChecksum, uint8 *ptrChecksumOK,
+                                       uint32 u32FramesNb)
+{
+    const __m128i vLocOddBytes = _mm_set1_epi32((int)MASK_ODD_BYTES);
+    const __m128i vLocByte = _mm_set1_epi32((int)MASK_1BYTE);
+    const __m128i vLocZero = _mm_setzero_si128();
+    __m128i vLocSum;
+    __m128i vLocChecksum;
+    uint32 u32LocIndex = FALSE;
+    uint32 u32LocLane = FALSE;
+    int s32LocBytes = 0;
+    int s32LocBits = 0;
+
+    for(u32LocIndex = 0U; (u32LocIndex + SSE2_LANES_NUMBER) <= u32FramesNb; u32LocIndex += SSE2_LANES_NUMBER)
+    {
+        vLocSum = _mm_loadu_si128((const __m128i *)&ptrPayload[u32LocIndex]);
+        vLocSum = _mm_add_epi32(_mm_and_si128(vLocSum, vLocOddBytes),
+                                _mm_and_si128(_mm_srli_epi32(vLocSum, SHIFT_8BITS), vLocOddBytes));
+        vLocSum = _mm_add_epi32(vLocSum, _mm_srli_epi32(vLocSum, SHIFT_16BITS));
+
+        /* Widen the four checksum bytes to the four 32 bits lanes                                */
+        memcpy(&s32LocBytes, &ptrChecksum[u32LocIndex], sizeof(s32LocBytes));
+        vLocChecksum = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(s32LocBytes), vLocZero), vLocZero);
+        vLocSum = _mm_and_si128(_mm_add_epi32(vLocSum, vLocChecksum), vLocByte);
+
+        s32LocBits = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(vLocSum, vLocZero)));
+        for(u32LocLane = 0U; u32LocLane < SSE2_LANES_NUMBER; u32LocLane++)
+        {
+            ptrChecksumOK[u32LocIndex + u32LocLane] = (uint8)((s32LocBits >> u32LocLane) & 1);
+        }
+    }
+    LogDecoder_vidChecksumScalar(&ptrPayload[u32LocIndex], &ptrChecksum[u32LocIndex], &ptrChecksumOK[u32LocIndex],
+                                 u32FramesNb - u32LocIndex);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSignalSse2                                                                            */
+/* !Description : Decode one signal of N payloads, four payloads per SSE2 register. SSE2 has no 32 bits low           */
+/*                multiplication, it is built from two 32x32->64 bits multiplications of the even and odd lanes.      */
+/*                                                                                                                    */
+/* !Inputs      : ptrPayload                    !Comment : Payloads of the frames                                     */
+/*                u32FramesNb                   !Comment : Number of frames                                           */
+/*                ptrSignal                     !Comment : Compiled signal definition                                 */
+/* !Outputs     : ptrValue                      !Comment : Fixed-point value of the signal for each frame             */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+__attribute__((target("sse2")))
+static void LogDecoder_vidSignalSse2(const uint32p *ptrPayload, uint32 u32FramesNb,
+                                     const LogDecoder_strSignalDefType *ptrSignal, sint32p *ptrValue)
+{
+    const __m128i vLocShift = _mm_cvtsi32_si128((int)ptrSignal->u8BitOffset);
+    const __m128i vLocMask = _mm_set1_epi32((int)(uint32p)ptrSignal->u32Mask);
+    const __m128i vLocSignBit = _mm_set1_epi32((int)(uint32p)ptrSignal->u32SignBit);
+    const __m128i vLocOffset = _mm_set1_epi32((int)ptrSignal->s32Offset);
+    const __m128i vLocScale = _mm_set1_epi32((int)ptrSignal->s32Scale);
+    __m128i vLocValue;
+    __m128i vLocEven;
+    __m128i vLocOdd;
+    uint32 u32LocIndex = FALSE;
+
+    for(u32LocIndex = 0U; (u32LocIndex + SSE2_LANES_NUMBER) <= u32FramesNb; u32LocIndex += SSE2_LANES_NUMBER)
+    {
+        vLocValue = _mm_loadu_si128((const __m128i *)&ptrPayload[u32LocIndex]);
+        vLocValue = _mm_and_si128(_mm_srl_epi32(vLocValue, vLocShift), vLocMask);
+        vLocValue = _mm_sub_epi32(_mm_xor_si128(vLocValue, vLocSignBit), vLocSignBit);
+        vLocValue = _mm_add_epi32(vLocValue, vLocOffset);
+
+        vLocEven  = _mm_mul_epu32(vLocValue, vLocScale);
+        vLocOdd   = _mm_mul_epu32(_mm_srli_si128(vLocValue, 4), _mm_srli_si128(vLocScale, 4));
+        vLocValue = _mm_unpacklo_epi32(_mm_shuffle_epi32(vLocEven, _MM_SHUFFLE(0, 0, 2, 0)),
+                                       _mm_shuffle_epi32(vLocOdd, _MM_SHUFFLE(0, 0, 2, 0)));
+        _mm_storeu_si128((__m128i *)&ptrValue[u32LocIndex], vLocValue);
+    }
+    LogDecoder_vidSignalScalar(&ptrPayload[u32LocIndex], u32FramesNb - u32LocIndex, ptrSignal, &ptrValue[u32LocIndex]);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidChecksumAvx2                                                                          */
+/* !Description : Checksum status of N frames, eight frames per AVX2 register                                         */
+/*                                                                                                                    */
+/* !Inputs      : ptrPayload                    !Comment : Payloads of the frames                                     */
+/*                ptrChecksum                   !Comment : Checksums of the frames                                    */
+/*                u32FramesNb                   !Comment : Number of frames                                           */
+/* !Outputs     : ptrChecksumOK                 !Comment : Checksum status of each frame (TRUE / FALSE)               */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+__attribute__((target("avx2")))
+static void LogDecoder_vidChecksumAvx2(const uint32p *ptrPayload, const uint8 *ptrChecksum, uint8 *ptrChecksumOK,
+                                       uint32 u32FramesNb)
+{
+    const __m256i vLocOddBytes = _mm256_set1_epi32((int)MASK_ODD_BYTES);
+    const __m256i vLocByte = _mm256_set1_epi32((int)MASK_1BYTE);
+    const __m256i vLocZero = _mm256_setzero_si256();
+    __m256i vLocSum;
+    __m256i vLocChecksum;
+    uint32 u32LocIndex = FALSE;
+    uint32 u32LocLane = FALSE;
+    int s32LocBits = 0;
+
+    for(u32LocIndex = 0U; (u32LocIndex + AVX2_LANES_NUMBER) <= u32FramesNb; u32LocIndex += AVX2_LANES_NUMBER)
+    {
+        vLocSum = _mm256_loadu_si256((const __m256i *)&ptrPayload[u32LocIndex]);
+        vLocSum = _mm256_add_epi32(_mm256_and_si256(vLocSum, vLocOddBytes),
+                                   _mm256_and_si256(_mm256_srli_epi32(vLocSum, SHIFT_8BITS), vLocOddBytes));
+        vLocSum = _mm256_add_epi32(vLocSum, _mm256_srli_epi32(vLocSum, SHIFT_16BITS));
+
+        vLocChecksum = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *)&ptrChecksum[u32LocIndex]));
+        vLocSum = _mm256_and_si256(_mm256_add_epi32(vLocSum, vLocChecksum), vLocByte);
+
+        s32LocBits = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(vLocSum, vLocZero)));
+        for(u32LocLane = 0U; u32LocLane < AVX2_LANES_NUMBER; u32LocLane++)
+        {
+            ptrChecksumOK[u32LocIndex + u32LocLane] = (uint8)((s32LocBits >> u32LocLane) & 1);
+        }
+    }
+    LogDecoder_vidChecksumScalar(&ptrPayload[u32LocIndex], &ptrChecksum[u32LocIndex], &ptrChecksumOK[u32LocIndex],
+                                 u32FramesNb - u32LocIndex);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSignalAvx2                                                                            */
+/* !Description : Decode one signal of N payloads, eight payloads per AVX2 register                                   */
+/*                                                                                                                    */
+/* !Inputs      : ptrPayload                    !Comment : Payloads of the frames                                     */
+/*                u32FramesNb                   !Comment : Number of frames                                           */
+/*                ptrSignal                     !Comment : Compiled signal definition                                 */
+/* !Outputs     : ptrValue                      !Comment : Fixed-point value of the signal for each frame             */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+__attribute__((target("avx2")))
+static void LogDecoder_vidSignalAvx2(const uint32p *ptrPayload, uint32 u32FramesNb,
+                                     const LogDecoder_strSignalDefType *ptrSignal, sint32p *ptrValue)
+{
+    const __m128i vLocShift = _mm_cvtsi32_si128((int)ptrSignal->u8BitOffset);
+    const __m256i vLocMask = _mm256_set1_epi32((int)(uint32p)ptrSignal->u32Mask);
+    const __m256i vLocSignBit = _mm256_set1_epi32((int)(uint32p)ptrSignal->u32SignBit);
+    const __m256i vLocOffset = _mm256_set1_epi32((int)ptrSignal->s32Offset);
+    const __m256i vLocScale = _mm256_set1_epi32((int)ptrSignal->s32Scale);
+    __m256i vLocValue;
+    uint32 u32LocIndex = FALSE;
+
+    for(u32LocIndex = 0U; (u32LocIndex + AVX2_LANES_NUMBER) <= u32FramesNb; u32LocIndex += AVX2_LANES_NUMBER)
+    {
+        vLocValue = _mm256_loadu_si256((const __m256i *)&ptrPayload[u32LocIndex]);
+        vLocValue = _mm256_and_si256(_mm256_srl_epi32(vLocValue, vLocShift), vLocMask);
+        vLocValue = _mm256_sub_epi32(_mm256_xor_si256(vLocValue, vLocSignBit), vLocSignBit);
+        vLocValue = _mm256_mullo_epi32(_mm256_add_epi32(vLocValue, vLocOffset), vLocScale);
+        _mm256_storeu_si256((__m256i *)&ptrValue[u32LocIndex], vLocValue);
+    }
+    LogDecoder_vidSignalScalar(&ptrPayload[u32LocIndex], u32FramesNb - u32LocIndex, ptrSignal, &ptrValue[u32LocIndex]);
+}
+#endif
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8KernelResolve                                                                          */
+/* !Description : Get the kernel level to be used for a requested level : the requested level if the CPU supports     */
+/*                it, else the best level supported by the CPU                                                        */
+/*                                                                                                                    */
+/* !Inputs      : u8Level                       !Comment : Highest kernel level requested                             */
+/*                                              !Range   : KERNEL_LEVEL_AUTO,                                         */
+/*                                                         KERNEL_LEVEL_SCALAR,                                       */
+/*                                                         KERNEL_LEVEL_SSE2,                                         */
+/*                                                         KERNEL_LEVEL_AVX2                                          */
+/* !Outputs     : u8LocLevel                    !Comment : Kernel level                                               */
+/*                                              !Range   : KERNEL_LEVEL_SCALAR,                                       */
+/*                                                         KERNEL_LEVEL_SSE2,                                         */
+/*                                                         KERNEL_LEVEL_AVX2                                          */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint8 LogDecoder_u8KernelResolve(uint8 u8Level)
+{
+    uint8 u8LocLevel = KERNEL_LEVEL_SCALAR;
+
+#ifdef KERNEL_X86_SIMD
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2"))
+    {
+        u8LocLevel = KERNEL_LEVEL_AVX2;
+    }
+    else if(__builtin_cpu_supports("sse2"))
+    {
+        u8LocLevel = KERNEL_LEVEL_SSE2;
+    }
+    else
+    {
+        /* 32 bits x86 without SSE2                                                               */
+    }
+#endif
+    if((u8Level != KERNEL_LEVEL_AUTO) && (u8Level < u8LocLevel))
+    {
+        u8LocLevel = u8Level;
+    }
+
+    return u8LocLevel;
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8KernelLevel                                                                            */
+/* !Description : Get the kernel level used by the batch functions, the best level of the CPU unless it was limited   */
+/*                by LogDecoder_vidKernelSetLevel. The CPU features are only read the first time.                     */
+/*                                                                                                                    */
+/* !Outputs     : LogDecoder_u8Level            !Comment : Kernel level                                               */
+/*                                              !Range   : KERNEL_LEVEL_SCALAR,                                       */
+/*                                                         KERNEL_LEVEL_SSE2,                                         */
+/*                                                         KERNEL_LEVEL_AVX2                                          */
+/* !Number      : 8                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8KernelLevel(void)
+{
+    if(LogDecoder_u8Level == KERNEL_LEVEL_AUTO)
+    {
+        LogDecoder_u8Level = LogDecoder_u8KernelResolve(KERNEL_LEVEL_AUTO);
+    }
+
+    return LogDecoder_u8Level;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidKernelSetLevel                                                                        */
+/* !Description : Limit the kernel level (e.g. to compare the kernels) and resolve it. To be called before any        */
+/*                decoding thread is started, the level is then only read.                                            */
+/*                                                                                                                    */
+/* !Inputs      : u8Level                       !Comment : Highest kernel level to be used                            */
+/*                                              !Range   : KERNEL_LEVEL_AUTO,                                         */
+/*                                                         KERNEL_LEVEL_SCALAR,                                       */
+/*                                                         KERNEL_LEVEL_SSE2,                                         */
+/*                                                         KERNEL_LEVEL_AVX2                                          */
+/* !Number      : 9                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidKernelSetLevel(uint8 u8Level)
+{
+    LogDecoder_u8Level = LogDecoder_u8KernelResolve(u8Level);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidKernelChecksum                                                                        */
+/* !Description : Checksum status of N frames given as separate payload and checksum arrays                           */
+/*                                                                                                                    */
+/* !Inputs      : ptrPayload                    !Comment : Payloads of the frames                                     */
+/*                ptrChecksum                   !Comment : Checksums of the frames                                    */
+/*                u32FramesNb                   !Comment : Number of frames                                           */
+/* !Outputs     : ptrChecksumOK                 !Comment : Checksum status of each frame (TRUE / FALSE)               */
+/* !Number      : 10                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidKernelChecksum(const uint32p *ptrPayload, const uint8 *ptrChecksum, uint8 *ptrChecksumOK,
+                                  uint32 u32FramesNb)
+{
+    switch(LogDecoder_u8KernelLevel())
+    {
+#ifdef KERNEL_X86_SIMD
+        case KERNEL_LEVEL_AVX2:
+            LogDecoder_vidChecksumAvx2(ptrPayload, ptrChecksum, ptrChecksumOK, u32FramesNb);
+            break;
+        case KERNEL_LEVEL_SSE2:
+            LogDecoder_vidChecksumSse2(ptrPayload, ptrChecksum, ptrChecksumOK, u32FramesNb);
+            break;
+#endif
+        default:
+            LogDecoder_vidChecksumScalar(ptrPayload, ptrChecksum, ptrChecksumOK, u32FramesNb);
+            break;
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidKernelSignal                                                                          */
+/* !Description : Decode one signal of N payloads of the same frame ID : shift, mask, sign extension, offset          */
+/*                and fixed-point scale, computed on 32 bits (the result of a valid schema always fits)               */
+/*                                                                                                                    */
+/* !Inputs      : ptrPayload                    !Comment : Payloads of the frames                                     */
+/*                u32FramesNb                   !Comment : Number of frames                                           */
+/*                ptrSignal                     !Comment : Compiled signal definition                                 */
+/* !Outputs     : ptrValue                      !Comment : Fixed-point value of the signal for each frame             */
+/* !Number      : 11                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidKernelSignal(const uint32p *ptrPayload, uint32 u32FramesNb,
+                                const LogDecoder_strSignalDefType *ptrSignal, sint32p *ptrValue)
+{
+    switch(LogDecoder_u8KernelLevel())
+    {
+#ifdef KERNEL_X86_SIMD
+        case KERNEL_LEVEL_AVX2:
+            LogDecoder_vidSignalAvx2(ptrPayload, u32FramesNb, ptrSignal, ptrValue);
+            break;
+        case KERNEL_LEVEL_SSE2:
+            LogDecoder_vidSignalSse2(ptrPayload, u32FramesNb, ptrSignal, ptrValue);
+            break;
+#endif
+        default:
+            LogDecoder_vidSignalScalar(ptrPayload, u32FramesNb, ptrSignal, ptrValue);
+            break;
+    }
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,44 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Batch kernels working on structure-of-arrays frames : checksum validation and signal decoding       */
+/*                of N payloads at once, with SSE2 / AVX2 versions selected at run time from the CPU features         */
+/*                and a scalar version for the other targets.                                                         */
+/*                                                                                                                    */
+/*  File        : log_decoder_Kernel.h                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_KERNEL_H
+#define LOG_DECODER_KERNEL_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/*------------------------------ Kernel levels -------------------------------*/
+#define KERNEL_LEVEL_AUTO               0U
+#define KERNEL_LEVEL_SCALAR             1U
+#define KERNEL_LEVEL_SSE2               2U
+#define KERNEL_LEVEL_AVX2               3U
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8KernelLevel(void);
+void LogDecoder_vidKernelSetLevel(uint8 u8Level);
+void LogDecoder_vidKernelChecksum(const uint32p *ptrPayload, const uint8 *ptrChecksum, uint8 *ptrChecksumOK,
+                                  uint32 u32FramesNb);
+void LogDecoder_vidKernelSignal(const uint32p *ptrPayload, uint32 u32FramesNb,
+                                const LogDecoder_strSignalDefType *ptrSignal, sint32p *ptrValue);
+
+#endif /* LOG_DECODER_KERNEL_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
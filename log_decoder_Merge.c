@@ -0,0 +1,416 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Streaming k-way merge of several logs by Timestamp. Each input is read one small batch ahead,       */
+/*                a binary min-heap of the inputs keyed by their next Timestamp hands out the rows in order.          */
+/*                                                                                                                    */
+/*  File        : log_decoder_Merge.c                                                                                 */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_bMergeNext                                                                                          */
+/* 2 / LogDecoder_bMergeBefore                                                                                        */
+/* 3 / LogDecoder_vidMergeSift                                                                                        */
+/* 4 / LogDecoder_u8MergeOpen                                                                                         */
+/* 5 / LogDecoder_u8MergeBatch                                                                                        */
+/* 6 / LogDecoder_vidMergeClose                                                                                       */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include <stdlib.h>
+#include "log_decoder_Merge.h"
+#include "log_decoder_Parser.h"
+#include "log_decoder_Record.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define MASK_16BITS                      0xFFFFUL
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bMergeNext(const LogDecoder_strMergeType *ptrMerge,
+                                     LogDecoder_strMergeSourceType *ptrSource);
+static boolean LogDecoder_bMergeBefore(const LogDecoder_strMergeType *ptrMerge, uint32 u32Source, uint32 u32Other);
+static void LogDecoder_vidMergeSift(LogDecoder_strMergeType *ptrMerge, uint32 u32Position);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bMergeNext                                                                               */
+/* !Description : Move an input to its next row, reading its next batch of rows once the current one is merged, and   */
+/*                compute the key of that row. With "--wrap16" the key extends the 16-bit counter of the input like   */
+/*                the validate stage does, so an input which wrapped still sorts after the rows before the wrap.      */
+/*                                                                                                                    */
+/* !Inputs      : ptrMerge                      !Comment : Merge of the input                                         */
+/*                ptrSource                     !Comment : Input to be moved                                          */
+/* !Outputs     : ptrSource                     !Comment : Next row and its key, or the status of the last read       */
+/*                bLocStatus                    !Comment : TRUE if the input has a next row                           */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bMergeNext(const LogDecoder_strMergeType *ptrMerge,
+                                     LogDecoder_strMergeSourceType *ptrSource)
+{
+    LogDecoder_strBatchType *ptrLocRows = &ptrSource->strRows;
+    uint64 u64LocTimestamp = FALSE;
+
+    ptrSource->u32Next++;
+    if(ptrSource->u32Next >= ptrLocRows->u32FramesNb)
+    {
+        ptrSource->u32Next = FALSE;
+        ptrLocRows->u32FramesNb = FALSE;
+        /* The rows parsed before an error are merged, the error is returned by the next read     */
+        while(  (ptrLocRows->u32FramesNb == 0U)
+             && (ptrSource->u8Status != PARSER_END_OF_DATA) && (ptrSource->u8Status != PARSER_ROW_ERROR) )
+        {
+            if(ptrSource->bRecords == TRUE)
+            {
+                ptrSource->u8Status = LogDecoder_u8RecordBatch(&ptrSource->ptrCursor, ptrSource->strInput.ptrEnd,
+                                                               ptrSource->strInput.bLastBlock, ptrLocRows);
+            }
+            else
+            {
+                ptrSource->u8Status = LogDecoder_u8ParseBatch(&ptrSource->ptrCursor, ptrSource->strInput.ptrEnd,
+                                                              ptrSource->strInput.bLastBlock, ptrMerge->ptrSelect,
+                                                              ptrLocRows);
+            }
+            ptrSource->u32RowNumber += ptrLocRows->u32FramesNb;
+            if(ptrSource->u8Status != PARSER_ROW_INCOMPLETE)
+            {
+                /* Full batch, end of the input or malformed row                                  */
+            }
+            else if(LogDecoder_bInputRefill(&ptrSource->strInput, ptrSource->ptrCursor) == TRUE)
+            {
+                /* The partial row is now at the start of the new data window                     */
+                ptrSource->ptrCursor = ptrSource->strInput.ptrBegin;
+            }
+            else
+            {
+                ptrSource->u8Status = PARSER_ROW_ERROR;
+            }
+        }
+    }
+    if(ptrSource->u32Next >= ptrLocRows->u32FramesNb)
+    {
+        return FALSE;
+    }
+
+    u64LocTimestamp = ptrLocRows->ptrTimestamp[ptrSource->u32Next];
+    if(ptrMerge->bWrap16 == FALSE)
+    {
+        ptrSource->u64Key = u64LocTimestamp;
+    }
+    else if(ptrSource->bFirstRow == TRUE)
+    {
+        ptrSource->u64Key = u64LocTimestamp & MASK_16BITS;
+    }
+    else
+    {
+        ptrSource->u64Key += (u64LocTimestamp - ptrSource->u64Key) & MASK_16BITS;
+    }
+    ptrSource->bFirstRow = FALSE;
+
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bMergeBefore                                                                             */
+/* !Description : Order of two inputs in the heap : smallest key first, the first input on the command line first on  */
+/*                equal keys, so that a merge gives the same rows in the same order every time                        */
+/*                                                                                                                    */
+/* !Inputs      : ptrMerge                      !Comment : Merge of the inputs                                        */
+/*                u32Source                     !Comment : Input to be compared                                       */
+/*                u32Other                      !Comment : Input it is compared to                                    */
+/* !Outputs     : bLocBefore                    !Comment : TRUE if u32Source comes before u32Other                    */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bMergeBefore(const LogDecoder_strMergeType *ptrMerge, uint32 u32Source, uint32 u32Other)
+{
+    uint64 u64LocKey = ptrMerge->ptrSources[u32Source].u64Key;
+    uint64 u64LocOtherKey = ptrMerge->ptrSources[u32Other].u64Key;
+
+    return (boolean)((u64LocKey < u64LocOtherKey) || ((u64LocKey == u64LocOtherKey) && (u32Source < u32Other)));
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidMergeSift                                                                             */
+/* !Description : Move an input of the heap down to its place, below the inputs which come before it                  */
+/*                                                                                                                    */
+/* !Inputs      : ptrMerge                      !Comment : Merge of the inputs                                        */
+/*                u32Position                   !Comment : Position in the heap of the input to be moved              */
+/* !Outputs     : ptrMerge                      !Comment : Heap of the inputs                                         */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidMergeSift(LogDecoder_strMergeType *ptrMerge, uint32 u32Position)
+{
+    uint32 *ptrLocHeap = ptrMerge->ptrHeap;
+    uint32 u32LocSource = ptrLocHeap[u32Position];
+    uint32 u32LocChild = FALSE;
+
+    while((u32LocChild = (2U * u32Position) + 1U) < ptrMerge->u32HeapSize)
+    {
+        if(  ((u32LocChild + 1U) < ptrMerge->u32HeapSize)
+          && (LogDecoder_bMergeBefore(ptrMerge, ptrLocHeap[u32LocChild + 1U], ptrLocHeap[u32LocChild]) == TRUE) )
+        {
+            u32LocChild++;
+        }
+        if(LogDecoder_bMergeBefore(ptrMerge, u32LocSource, ptrLocHeap[u32LocChild]) == TRUE)
+        {
+            break;
+        }
+        ptrLocHeap[u32Position] = ptrLocHeap[u32LocChild];
+        u32Position = u32LocChild;
+    }
+    ptrLocHeap[u32Position] = u32LocSource;
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8MergeOpen                                                                              */
+/* !Description : Open the inputs of a merge, check their header and read their first rows. Each input is a .csv log  */
+/*                or a record file and is read through its own data window, without a reader thread : only one        */
+/*                batch of MERGE_SOURCE_ROWS rows per input, and the read block of a streamed input, are in memory.   */
+/*                Nothing is left open on an error.                                                                   */
+/*                                                                                                                    */
+/* !Inputs      : aptrPath                      !Comment : Paths of the inputs, "-" for the standard input            */
+/*                u32SourcesNb                  !Comment : Number of inputs                                           */
+/*                                              !Range   : [1, MERGE_MAX_SOURCES]                                     */
+/*                ptrSelect                     !Comment : Rows to be selected, NULL for all of them                  */
+/*                bWrap16                       !Comment : TRUE if the timestamps are 16-bit counters which wrap      */
+/* !Outputs     : ptrMerge                      !Comment : Merge, u32ErrorSource is the input of an error             */
+/*                u8LocStatus                   !Comment : Open status                                                */
+/*                                              !Range   : MERGE_OPEN_OK,                                             */
+/*                                                         MERGE_OPEN_ERROR,                                          */
+/*                                                         MERGE_HEADER_ERROR,                                        */
+/*                                                         MERGE_VERSION_ERROR,                                       */
+/*                                                         MERGE_NO_MEMORY                                            */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8MergeOpen(LogDecoder_strMergeType *ptrMerge, const char * const *aptrPath, uint32 u32SourcesNb,
+                             const LogDecoder_strSelectType *ptrSelect, boolean bWrap16)
+{
+    LogDecoder_strMergeSourceType *ptrLocSource = NULL;
+    uint8 u8LocStatus = MERGE_OPEN_OK;
+    uint8 u8LocRecordStatus = RECORD_HEADER_INCOMPLETE;
+    uint8 u8LocParseStatus = PARSER_ROW_INCOMPLETE;
+    uint32 u32LocIndex = FALSE;
+
+    ptrMerge->ptrSources     = calloc(u32SourcesNb, sizeof(LogDecoder_strMergeSourceType));
+    ptrMerge->ptrHeap        = malloc(u32SourcesNb * sizeof(uint32));
+    ptrMerge->ptrSelect      = ptrSelect;
+    ptrMerge->u32SourcesNb   = FALSE;
+    ptrMerge->u32HeapSize    = FALSE;
+    ptrMerge->u32ErrorSource = FALSE;
+    ptrMerge->bWrap16        = bWrap16;
+    ptrMerge->bError         = FALSE;
+    if((ptrMerge->ptrSources == NULL) || (ptrMerge->ptrHeap == NULL))
+    {
+        u8LocStatus = MERGE_NO_MEMORY;
+    }
+
+    for(u32LocIndex = 0U; (u32LocIndex < u32SourcesNb) && (u8LocStatus == MERGE_OPEN_OK); u32LocIndex++)
+    {
+        ptrLocSource = &ptrMerge->ptrSources[u32LocIndex];
+        ptrMerge->u32ErrorSource = u32LocIndex;
+        if(LogDecoder_bInputOpen(&ptrLocSource->strInput, aptrPath[u32LocIndex], FALSE) == FALSE)
+        {
+            u8LocStatus = MERGE_OPEN_ERROR;
+            break;
+        }
+        ptrMerge->u32SourcesNb++;
+        if(LogDecoder_bBatchOpen(&ptrLocSource->strRows, MERGE_SOURCE_ROWS) == FALSE)
+        {
+            u8LocStatus = MERGE_NO_MEMORY;
+            break;
+        }
+
+        /* A record file first, else the first row of a .csv log                                  */
+        ptrLocSource->ptrCursor = ptrLocSource->strInput.ptrBegin;
+        while(  ((u8LocRecordStatus = LogDecoder_u8RecordHeader(&ptrLocSource->ptrCursor,
+                                                                ptrLocSource->strInput.ptrEnd,
+                                                                ptrLocSource->strInput.bLastBlock))
+                     == RECORD_HEADER_INCOMPLETE)
+             && (LogDecoder_bInputRefill(&ptrLocSource->strInput, ptrLocSource->ptrCursor) == TRUE) )
+        {
+            ptrLocSource->ptrCursor = ptrLocSource->strInput.ptrBegin;
+        }
+        ptrLocSource->bRecords = (boolean)(u8LocRecordStatus == RECORD_HEADER_OK);
+        if(u8LocRecordStatus == RECORD_HEADER_VERSION_ERROR)
+        {
+            u8LocStatus = MERGE_VERSION_ERROR;
+            break;
+        }
+        else if(ptrLocSource->bRecords == FALSE)
+        {
+            ptrLocSource->ptrCursor = ptrLocSource->strInput.ptrBegin;
+            while(  ((u8LocParseStatus = LogDecoder_u8ParseHeader(&ptrLocSource->ptrCursor,
+                                                                  ptrLocSource->strInput.ptrEnd,
+                                                                  ptrLocSource->strInput.bLastBlock))
+                         == PARSER_ROW_INCOMPLETE)
+                 && (LogDecoder_bInputRefill(&ptrLocSource->strInput, ptrLocSource->ptrCursor) == TRUE) )
+            {
+                ptrLocSource->ptrCursor = ptrLocSource->strInput.ptrBegin;
+            }
+            if(u8LocParseStatus != PARSER_ROW_OK)
+            {
+                u8LocStatus = MERGE_HEADER_ERROR;
+                break;
+            }
+        }
+        else
+        {
+            /* Records follow the header                                                          */
+        }
+
+        /* First row of the input, u32Next moves from the end of the empty batch to row 0         */
+        ptrLocSource->u8Status  = PARSER_ROW_OK;
+        ptrLocSource->bFirstRow = TRUE;
+        ptrLocSource->u32Next   = FALSE;
+        if(LogDecoder_bMergeNext(ptrMerge, ptrLocSource) == TRUE)
+        {
+            ptrMerge->ptrHeap[ptrMerge->u32HeapSize++] = u32LocIndex;
+        }
+        else if((ptrLocSource->u8Status == PARSER_ROW_ERROR) && (ptrMerge->bError == FALSE))
+        {
+            /* Returned by the first call of LogDecoder_u8MergeBatch                              */
+            ptrMerge->bError = TRUE;
+            ptrMerge->u32ErrorSource = u32LocIndex;
+        }
+        else
+        {
+            /* Empty input                                                                        */
+        }
+    }
+
+    if(u8LocStatus != MERGE_OPEN_OK)
+    {
+        u32LocIndex = ptrMerge->u32ErrorSource;
+        LogDecoder_vidMergeClose(ptrMerge);
+        ptrMerge->u32ErrorSource = u32LocIndex;
+        return u8LocStatus;
+    }
+    if(ptrMerge->bError == FALSE)
+    {
+        ptrMerge->u32ErrorSource = FALSE;
+    }
+    for(u32LocIndex = ptrMerge->u32HeapSize / 2U; u32LocIndex > 0U; u32LocIndex--)
+    {
+        LogDecoder_vidMergeSift(ptrMerge, u32LocIndex - 1U);
+    }
+
+    return MERGE_OPEN_OK;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8MergeBatch                                                                             */
+/* !Description : Fill the input columns of a batch with the next rows of the merge, in Timestamp order, and the      */
+/*                source column with the input of each row. The merge stops at the first row which cannot be read.    */
+/*                                                                                                                    */
+/* !Inputs      : ptrMerge                      !Comment : Merge of the inputs                                        */
+/*                ptrBatch                      !Comment : Batch, its rows are added after u32FramesNb                */
+/* !Outputs     : ptrBatch                      !Comment : Merged rows                                                */
+/*                ptrMerge                      !Comment : u32ErrorSource and its u32RowNumber on an error            */
+/*                u8LocStatus                   !Comment : PARSER_ROW_OK when the batch is full                       */
+/*                                              !Range   : PARSER_ROW_OK,                                             */
+/*                                                         PARSER_ROW_ERROR,                                          */
+/*                                                         PARSER_END_OF_DATA                                         */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8MergeBatch(LogDecoder_strMergeType *ptrMerge, LogDecoder_strBatchType *ptrBatch)
+{
+    LogDecoder_strMergeSourceType *ptrLocSource = NULL;
+    const LogDecoder_strBatchType *ptrLocRows = NULL;
+    uint32 u32LocIndex = ptrBatch->u32FramesNb;
+    uint32 u32LocSource = FALSE;
+    uint32 u32LocRow = FALSE;
+
+    while((u32LocIndex < ptrBatch->u32Capacity) && (ptrMerge->u32HeapSize != 0U) && (ptrMerge->bError == FALSE))
+    {
+        u32LocSource = ptrMerge->ptrHeap[0];
+        ptrLocSource = &ptrMerge->ptrSources[u32LocSource];
+        ptrLocRows   = &ptrLocSource->strRows;
+        u32LocRow    = ptrLocSource->u32Next;
+        ptrBatch->ptrId[u32LocIndex]        = ptrLocRows->ptrId[u32LocRow];
+        ptrBatch->ptrFrameNb[u32LocIndex]   = ptrLocRows->ptrFrameNb[u32LocRow];
+        ptrBatch->ptrTimestamp[u32LocIndex] = ptrLocRows->ptrTimestamp[u32LocRow];
+        ptrBatch->ptrPayload[u32LocIndex]   = ptrLocRows->ptrPayload[u32LocRow];
+        ptrBatch->ptrChecksum[u32LocIndex]  = ptrLocRows->ptrChecksum[u32LocRow];
+        ptrBatch->ptrSource[u32LocIndex]    = (uint16)u32LocSource;
+        u32LocIndex++;
+
+        if(LogDecoder_bMergeNext(ptrMerge, ptrLocSource) == FALSE)
+        {
+            if(ptrLocSource->u8Status == PARSER_ROW_ERROR)
+            {
+                ptrMerge->bError = TRUE;
+                ptrMerge->u32ErrorSource = u32LocSource;
+            }
+            /* The input is over, the last input of the heap takes its place                      */
+            ptrMerge->u32HeapSize--;
+            ptrMerge->ptrHeap[0] = ptrMerge->ptrHeap[ptrMerge->u32HeapSize];
+        }
+        if(ptrMerge->u32HeapSize > 1U)
+        {
+            LogDecoder_vidMergeSift(ptrMerge, 0U);
+        }
+    }
+    ptrBatch->u32FramesNb = u32LocIndex;
+
+    if(ptrMerge->bError == TRUE)
+    {
+        return PARSER_ROW_ERROR;
+    }
+    if(ptrMerge->u32HeapSize == 0U)
+    {
+        return PARSER_END_OF_DATA;
+    }
+
+    return PARSER_ROW_OK;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidMergeClose                                                                            */
+/* !Description : Close the inputs of a merge and release its memory                                                  */
+/*                                                                                                                    */
+/* !Inputs      : ptrMerge                      !Comment : Merge to be closed                                         */
+/* !Outputs     : ptrMerge                      !Comment : Closed merge                                               */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidMergeClose(LogDecoder_strMergeType *ptrMerge)
+{
+    uint32 u32LocIndex = FALSE;
+
+    for(u32LocIndex = 0U; u32LocIndex < ptrMerge->u32SourcesNb; u32LocIndex++)
+    {
+        LogDecoder_vidInputClose(&ptrMerge->ptrSources[u32LocIndex].strInput);
+        LogDecoder_vidBatchClose(&ptrMerge->ptrSources[u32LocIndex].strRows);
+    }
+    free(ptrMerge->ptrSources);
+    free(ptrMerge->ptrHeap);
+    memset(ptrMerge, 0, sizeof(*ptrMerge));
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,76 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Streaming k-way merge of several time-ordered logs (one per bus channel) into a single stream       */
+/*                ordered by Timestamp. Every input is read ahead by one small batch, a min-heap of the inputs gives  */
+/*                the next row, so the memory in use depends on the number of inputs and not on their size.           */
+/*                                                                                                                    */
+/*  File        : log_decoder_Merge.h                                                                                 */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_MERGE_H
+#define LOG_DECODER_MERGE_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+#include "log_decoder_Batch.h"
+#include "log_decoder_Input.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/* Inputs of a merge, numbered by the 16-bit source column of the batches                                             */
+#define MERGE_MAX_SOURCES               (UINT16_MAX + 1UL)
+/* Rows read ahead from every input                                                                                   */
+#define MERGE_SOURCE_ROWS               4096U
+/*-------------------------------- Open status -------------------------------*/
+#define MERGE_OPEN_OK                   0U
+#define MERGE_OPEN_ERROR                1U
+#define MERGE_HEADER_ERROR              2U
+#define MERGE_VERSION_ERROR             3U
+#define MERGE_NO_MEMORY                 4U
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+typedef struct
+{
+    LogDecoder_strInputType  strInput;
+    LogDecoder_strBatchType  strRows;       /* Rows read ahead, input columns only                        */
+    const char              *ptrCursor;     /* Next byte of the input to be read                          */
+    uint64                   u64Key;        /* Timestamp of the next row, extended to 64 bits with wrap16 */
+    uint32                   u32Next;       /* Next row of strRows to be merged                           */
+    uint32                   u32RowNumber;  /* Rows read from the input so far, header excluded           */
+    uint8                    u8Status;      /* Status of the last read of the input                       */
+    boolean                  bRecords;      /* Records of a "csv2bin" file, FALSE for .csv rows           */
+    boolean                  bFirstRow;     /* TRUE until the key of the first row is known               */
+}LogDecoder_strMergeSourceType;
+typedef struct
+{
+    LogDecoder_strMergeSourceType  *ptrSources;
+    uint32                         *ptrHeap;        /* Inputs with rows left, smallest next Timestamp first */
+    const LogDecoder_strSelectType *ptrSelect;      /* Rows to be selected, NULL for all of them            */
+    uint32                          u32SourcesNb;
+    uint32                          u32HeapSize;
+    uint32                          u32ErrorSource; /* Input of the error, see the open and batch status     */
+    boolean                         bWrap16;        /* Timestamps are 16-bit counters which wrap             */
+    boolean                         bError;         /* A row could not be read, the merge is over            */
+}LogDecoder_strMergeType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8MergeOpen(LogDecoder_strMergeType *ptrMerge, const char * const *aptrPath, uint32 u32SourcesNb,
+                             const LogDecoder_strSelectType *ptrSelect, boolean bWrap16);
+uint8 LogDecoder_u8MergeBatch(LogDecoder_strMergeType *ptrMerge, LogDecoder_strBatchType *ptrBatch);
+void LogDecoder_vidMergeClose(LogDecoder_strMergeType *ptrMerge);
+
+#endif /* LOG_DECODER_MERGE_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
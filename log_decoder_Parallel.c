@@ -0,0 +1,536 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Multi-threaded chunked decoding. The mapped input is split at line boundaries into chunks that      */
+/*                are decoded concurrently with chunk-local tracking state, then a sequential stitch pass fixes       */
+/*                the TimeoutOK flag at the chunk edges and offsets the cumulative FrameDropCnt, so that the          */
+/*                output is identical to the serial decoding.                                                         */
+/*                                                                                                                    */
+/*  File        : log_decoder_Parallel.c                                                                              */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_s32ParallelDecodeChunk                                                                              */
+/* 2 / LogDecoder_s32ParallelFormatChunk                                                                              */
+/* 3 / LogDecoder_vidParallelRun                                                                                      */
+/* 4 / LogDecoder_vidParallelStitchChunk                                                                              */
+/* 5 / LogDecoder_u8ParallelDecode                                                                                    */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include <stdlib.h>
+#include "log_decoder_Batch.h"
+#include "log_decoder_Parallel.h"
+#include "log_decoder_Parser.h"
+#include "log_decoder_Record.h"
+
+#ifndef __STDC_NO_THREADS__
+#include <threads.h>
+#endif
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define MIN_CHAR_NUM_PER_ROW             10U
+
+/**********************************************************************************************************************/
+/* LOCAL TYPEDEF                                                                                                      */
+/**********************************************************************************************************************/
+/* First frame of an ID inside a chunk, the only frame whose flags depend on the previous chunks                      */
+typedef struct
+{
+    uint32                      u32FirstRow;
+    boolean                     bPresent;
+}LogDecoder_strChunkEdgeType;
+
+typedef struct
+{
+    const char                     *ptrBegin;
+    const char                     *ptrEnd;
+    const LogDecoder_strRegistryType *ptrRegistry;
+    const LogDecoder_strSelectType *ptrSelect;      /* Rows to be written, NULL for all of them               */
+    LogDecoder_strBatchType         strRows;
+    LogDecoder_strWriterType        strText;
+    LogDecoder_strContextType       strContext;
+    LogDecoder_strChunkEdgeType     astrEdge[FRAME_IDS_NUMBER];
+    LogDecoder_strStatsType         strStats;       /* Stage timings of the chunk, when bStats is TRUE        */
+    LogDecoder_strSummaryType       strSummary;     /* Totals of the chunk rows, when bSummary is TRUE        */
+    boolean                         bStats;
+    boolean                         bWrap16;
+    boolean                         bRecords;       /* Records of a "csv2bin" file, FALSE for .csv rows       */
+    boolean                         bFormat;        /* Rows formatted as .csv text, FALSE for binary output   */
+    boolean                         bSummary;       /* Rows accumulated in strSummary instead of written      */
+    boolean                         bParseError;
+    boolean                         bNoMemory;
+}LogDecoder_strChunkType;
+
+typedef int (*LogDecoder_ptrChunkFunctionType)(void *ptrChunk);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static int LogDecoder_s32ParallelDecodeChunk(void *ptrArg);
+static int LogDecoder_s32ParallelFormatChunk(void *ptrArg);
+static void LogDecoder_vidParallelRun(LogDecoder_ptrChunkFunctionType ptrFunction, LogDecoder_strChunkType *ptrChunks,
+                                      uint32 u32ChunksNb, LogDecoder_strPoolType *ptrPool);
+static void LogDecoder_vidParallelStitchChunk(LogDecoder_strContextType *ptrGlobalContext,
+                                              LogDecoder_strChunkType *ptrChunk);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32ParallelDecodeChunk                                                                   */
+/* !Description : Parse and validate all the rows of one chunk with a chunk-local tracking state (worker thread).     */
+/*                The rows are decoded once stitched and selected, by LogDecoder_s32ParallelFormatChunk.              */
+/*                                                                                                                    */
+/* !Inputs      : ptrArg                        !Comment : Chunk to be decoded (LogDecoder_strChunkType)              */
+/* !Outputs     : s32LocStatus                  !Comment : Thread exit code, always 0                                 */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32ParallelDecodeChunk(void *ptrArg)
+{
+    LogDecoder_strChunkType *ptrChunk = (LogDecoder_strChunkType *)ptrArg;
+    LogDecoder_strStatsType *ptrLocStats = (ptrChunk->bStats == TRUE) ? &ptrChunk->strStats : NULL;
+    const char *ptrLocCursor = ptrChunk->ptrBegin;
+    uint8 u8LocParseStatus = PARSER_ROW_OK;
+    uint32 u32LocRow = FALSE;
+    size_t u32LocCapacity = ((size_t)(ptrChunk->ptrEnd - ptrChunk->ptrBegin)
+                             / ((ptrChunk->bRecords == TRUE) ? RECORD_SIZE : MIN_CHAR_NUM_PER_ROW)) + 1U;
+
+    LogDecoder_vidInit(&ptrChunk->strContext);
+    LogDecoder_vidSetRegistry(&ptrChunk->strContext, ptrChunk->ptrRegistry);
+    LogDecoder_vidSetWrap16(&ptrChunk->strContext, ptrChunk->bWrap16);
+    if(LogDecoder_bBatchOpen(&ptrChunk->strRows, (uint32)u32LocCapacity) == FALSE)
+    {
+        ptrChunk->bNoMemory = TRUE;
+        return 0;
+    }
+
+    /* The whole chunk is one batch, it always ends on a line break (or a record) so it is parsed */
+    /* as a last block                                                                            */
+    LogDecoder_vidStatsStart(ptrLocStats);
+    if(ptrChunk->bRecords == TRUE)
+    {
+        u8LocParseStatus = LogDecoder_u8RecordBatch(&ptrLocCursor, ptrChunk->ptrEnd, TRUE, &ptrChunk->strRows);
+    }
+    else
+    {
+        u8LocParseStatus = LogDecoder_u8ParseBatch(&ptrLocCursor, ptrChunk->ptrEnd, TRUE, ptrChunk->ptrSelect,
+                                                   &ptrChunk->strRows);
+    }
+
+    /* Keep the first frame of every tracked ID for the stitch pass                               */
+    for(u32LocRow = 0U; u32LocRow < ptrChunk->strRows.u32FramesNb; u32LocRow++)
+    {
+        if(  (ptrChunk->astrEdge[ptrChunk->strRows.ptrId[u32LocRow]].bPresent == FALSE)
+          && (LogDecoder_ptrFrameState(&ptrChunk->strContext, ptrChunk->strRows.ptrId[u32LocRow]) != NULL) )
+        {
+            ptrChunk->astrEdge[ptrChunk->strRows.ptrId[u32LocRow]].u32FirstRow = u32LocRow;
+            ptrChunk->astrEdge[ptrChunk->strRows.ptrId[u32LocRow]].bPresent    = TRUE;
+        }
+    }
+    LogDecoder_vidStatsLap(ptrLocStats, STATS_STAGE_PARSE);
+    LogDecoder_vidBatchValidate(&ptrChunk->strContext, &ptrChunk->strRows);
+    LogDecoder_vidStatsLap(ptrLocStats, STATS_STAGE_VALIDATE);
+    ptrChunk->bParseError = (boolean)(u8LocParseStatus == PARSER_ROW_ERROR);
+
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32ParallelFormatChunk                                                                   */
+/* !Description : Decode the stitched and selected rows of one chunk, then format them into its output text for the   */
+/*                .csv output or accumulate them into its summary (worker thread)                                     */
+/*                                                                                                                    */
+/* !Inputs      : ptrArg                        !Comment : Chunk to be formatted (LogDecoder_strChunkType)            */
+/* !Outputs     : s32LocStatus                  !Comment : Thread exit code, always 0                                 */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32ParallelFormatChunk(void *ptrArg)
+{
+    LogDecoder_strChunkType *ptrChunk = (LogDecoder_strChunkType *)ptrArg;
+    LogDecoder_strStatsType *ptrLocStats = (ptrChunk->bStats == TRUE) ? &ptrChunk->strStats : NULL;
+
+    LogDecoder_vidStatsStart(ptrLocStats);
+    LogDecoder_vidBatchDecode(&ptrChunk->strContext, &ptrChunk->strRows);
+    LogDecoder_vidStatsLap(ptrLocStats, STATS_STAGE_DECODE);
+    if(ptrChunk->bSummary == TRUE)
+    {
+        LogDecoder_vidSummaryBatch(&ptrChunk->strSummary, ptrChunk->ptrRegistry, &ptrChunk->strRows);
+        LogDecoder_vidStatsLap(ptrLocStats, STATS_STAGE_OUTPUT);
+        return 0;
+    }
+    if(ptrChunk->bFormat == FALSE)
+    {
+        return 0;
+    }
+    /* Memory mode writer, large enough for the longest rows so it never needs to be flushed      */
+    if(LogDecoder_bWriterOpen(&ptrChunk->strText, NULL,
+                              ((size_t)ptrChunk->strRows.u32FramesNb * OUTPUT_ROW_MAX_LENGTH) + 1U) == FALSE)
+    {
+        ptrChunk->bNoMemory = TRUE;
+        return 0;
+    }
+
+    LogDecoder_vidWriterBatch(&ptrChunk->strText, &ptrChunk->strRows);
+    LogDecoder_vidStatsLap(ptrLocStats, STATS_STAGE_OUTPUT);
+
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidParallelRun                                                                           */
+/* !Description : Run the given function on every chunk, one thread per chunk, and wait for all of them. The          */
+/*                first chunk is processed by the calling thread. In the batch mode the other chunks are tasks of     */
+/*                the pool instead of threads. Without C11 threads support the chunks are processed one after the     */
+/*                other.                                                                                              */
+/*                                                                                                                    */
+/* !Inputs      : ptrFunction                   !Comment : Function to run on each chunk                              */
+/*                ptrChunks                     !Comment : Chunks of the current round                                */
+/*                u32ChunksNb                   !Comment : Number of chunks                                           */
+/*                                              !Range   : [1, PARALLEL_MAX_THREADS]                                  */
+/*                ptrPool                       !Comment : Pool running the calling job, NULL to start threads        */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidParallelRun(LogDecoder_ptrChunkFunctionType ptrFunction, LogDecoder_strChunkType *ptrChunks,
+                                      uint32 u32ChunksNb, LogDecoder_strPoolType *ptrPool)
+{
+    uint32 u32LocIndex = FALSE;
+    LogDecoder_strTaskType astrLocTasks[PARALLEL_MAX_THREADS];
+    PIPELINE_ATOMIC size_t u32LocPendingNb = u32ChunksNb - 1U;
+#ifndef __STDC_NO_THREADS__
+    thrd_t astrLocThreads[PARALLEL_MAX_THREADS];
+    boolean abLocStarted[PARALLEL_MAX_THREADS] = {FALSE};
+#endif
+
+    if(ptrPool != NULL)
+    {
+        for(u32LocIndex = 1U; u32LocIndex < u32ChunksNb; u32LocIndex++)
+        {
+            astrLocTasks[u32LocIndex].ptrFunction = ptrFunction;
+            astrLocTasks[u32LocIndex].ptrArgument = &ptrChunks[u32LocIndex];
+            astrLocTasks[u32LocIndex].ptrPending  = &u32LocPendingNb;
+            LogDecoder_vidPoolSubmit(ptrPool, &astrLocTasks[u32LocIndex]);
+        }
+        (void)ptrFunction(&ptrChunks[0]);
+        LogDecoder_vidPoolWait(ptrPool, &u32LocPendingNb);
+        return;
+    }
+#ifndef __STDC_NO_THREADS__
+    for(u32LocIndex = 1U; u32LocIndex < u32ChunksNb; u32LocIndex++)
+    {
+        abLocStarted[u32LocIndex] = (boolean)(thrd_create(&astrLocThreads[u32LocIndex], ptrFunction,
+                                                          &ptrChunks[u32LocIndex]) == thrd_success);
+    }
+    (void)ptrFunction(&ptrChunks[0]);
+    for(u32LocIndex = 1U; u32LocIndex < u32ChunksNb; u32LocIndex++)
+    {
+        if(abLocStarted[u32LocIndex] == TRUE)
+        {
+            (void)thrd_join(astrLocThreads[u32LocIndex], NULL);
+        }
+        else
+        {
+            /* No thread could be created for this chunk, process it here                         */
+            (void)ptrFunction(&ptrChunks[u32LocIndex]);
+        }
+    }
+#else
+    for(u32LocIndex = 0U; u32LocIndex < u32ChunksNb; u32LocIndex++)
+    {
+        (void)ptrFunction(&ptrChunks[u32LocIndex]);
+    }
+#endif
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidParallelStitchChunk                                                                   */
+/* !Description : Fix the chunk rows that depend on the previous chunks and carry the tracking state forward.         */
+/*                The first frame of every ID is decoded again with the global state, which gives its                 */
+/*                TimeoutOK flag and the drop count offset to be added to the next frames of the same ID. With        */
+/*                16-bit source counters, the wraps of the previous chunks are added to FrameNb and Timestamp the     */
+/*                same way. When the first frame of an ID is not after the previous chunks (late or repeated frame),  */
+/*                the drops of the chunk do not start from the same frame, the frames of the ID are tracked again.    */
+/*                                                                                                                    */
+/* !Inputs      : ptrGlobalContext                !Comment : Tracking state at the end of the previous chunk          */
+/*                ptrChunk                      !Comment : Decoded chunk                                              */
+/* !Outputs     : ptrGlobalContext                !Comment : Tracking state at the end of this chunk                  */
+/*                ptrChunk                      !Comment : Chunk rows as they are in the serial decoding              */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidParallelStitchChunk(LogDecoder_strContextType *ptrGlobalContext,
+                                              LogDecoder_strChunkType *ptrChunk)
+{
+    uint64 au64LocDropOffset[FRAME_IDS_NUMBER] = {FALSE};
+    uint64 au64LocFrameNbOffset[FRAME_IDS_NUMBER] = {FALSE};
+    uint64 au64LocTimestampOffset[FRAME_IDS_NUMBER] = {FALSE};
+    boolean abLocRetrack[FRAME_IDS_NUMBER] = {FALSE};
+    boolean bLocOffsetNeeded = FALSE;
+    LogDecoder_strFrameStateType *ptrLocGlobal = NULL;
+    LogDecoder_strBatchType *ptrLocRows = &ptrChunk->strRows;
+    LogDecoder_strInputDataType strLocInputData = {FALSE};
+    LogDecoder_strOutputDataType strLocOutputData = {0};
+    uint64 u64LocPrevious = FALSE;
+    uint32 u32LocRow = FALSE;
+    uint32 u32LocIndex = FALSE;
+    uint8 u8LocId = FALSE;
+
+    for(u32LocIndex = 0U; u32LocIndex < FRAME_IDS_NUMBER; u32LocIndex++)
+    {
+        if(ptrChunk->astrEdge[u32LocIndex].bPresent == TRUE)
+        {
+            ptrLocGlobal = LogDecoder_ptrFrameState(ptrGlobalContext, (uint8)u32LocIndex);
+            if(ptrLocGlobal->bFirstReading == FALSE)
+            {
+                /* Decode the first frame again, now with the state of the previous chunks        */
+                u32LocRow = ptrChunk->astrEdge[u32LocIndex].u32FirstRow;
+                u64LocPrevious = ptrLocGlobal->u64FrameNbNm1;
+                LogDecoder_vidBatchInput(ptrLocRows, u32LocRow, &strLocInputData);
+                strLocOutputData = LogDecoder_strDecodeFrameContent(ptrGlobalContext, strLocInputData);
+                /* The chunk extended its 16-bit counters from the first frame, without the wraps */
+                /* of the previous chunks                                                         */
+                au64LocFrameNbOffset[u32LocIndex]   = strLocOutputData.u64FrameNb - strLocInputData.u64FrameNb;
+                au64LocTimestampOffset[u32LocIndex] = strLocOutputData.u64Timestamp - strLocInputData.u64Timestamp;
+                ptrLocRows->ptrFrameNb[u32LocRow]      = strLocOutputData.u64FrameNb;
+                ptrLocRows->ptrTimestamp[u32LocRow]    = strLocOutputData.u64Timestamp;
+                ptrLocRows->ptrFrameDropCnt[u32LocRow] = strLocOutputData.u64FrameDropCnt;
+                ptrLocRows->ptrTimeoutOK[u32LocRow]    = strLocOutputData.bTimeoutOK;
+                au64LocDropOffset[u32LocIndex] = strLocOutputData.u64FrameDropCnt;
+                bLocOffsetNeeded |= (boolean)(  (au64LocDropOffset[u32LocIndex] != 0U)
+                                              || (au64LocFrameNbOffset[u32LocIndex] != 0U)
+                                              || (au64LocTimestampOffset[u32LocIndex] != 0U) );
+                abLocRetrack[u32LocIndex] = (boolean)(strLocOutputData.u64FrameNb <= u64LocPrevious);
+            }
+            if(abLocRetrack[u32LocIndex] == TRUE)
+            {
+                /* Late or repeated first frame : the chunk counted the drops from it and not from */
+                /* the previous chunks, the next frames of the ID are tracked again one by one    */
+                for(u32LocRow = u32LocRow + 1U; u32LocRow < ptrLocRows->u32FramesNb; u32LocRow++)
+                {
+                    if(ptrLocRows->ptrId[u32LocRow] == (uint8)u32LocIndex)
+                    {
+                        LogDecoder_vidBatchInput(ptrLocRows, u32LocRow, &strLocInputData);
+                        strLocOutputData = LogDecoder_strDecodeFrameContent(ptrGlobalContext, strLocInputData);
+                        ptrLocRows->ptrFrameNb[u32LocRow]      = strLocOutputData.u64FrameNb;
+                        ptrLocRows->ptrTimestamp[u32LocRow]    = strLocOutputData.u64Timestamp;
+                        ptrLocRows->ptrFrameDropCnt[u32LocRow] = strLocOutputData.u64FrameDropCnt;
+                        ptrLocRows->ptrTimeoutOK[u32LocRow]    = strLocOutputData.bTimeoutOK;
+                    }
+                }
+            }
+            else
+            {
+                /* The end state of the chunk becomes the global state of this ID                 */
+                *ptrLocGlobal = *LogDecoder_ptrFrameState(&ptrChunk->strContext, (uint8)u32LocIndex);
+                ptrLocGlobal->u64FrameDropCnt = ptrLocGlobal->u64FrameDropCnt + au64LocDropOffset[u32LocIndex];
+                ptrLocGlobal->u64FrameNbNm1   = ptrLocGlobal->u64FrameNbNm1 + au64LocFrameNbOffset[u32LocIndex];
+                ptrLocGlobal->u64TimestampNm1 = ptrLocGlobal->u64TimestampNm1
+                                              + au64LocTimestampOffset[u32LocIndex];
+            }
+        }
+    }
+    ptrGlobalContext->u32InvalidFramesNb += ptrChunk->strContext.u32InvalidFramesNb;
+
+    if(bLocOffsetNeeded == TRUE)
+    {
+        /* The first frame of each ID already holds its global values, offset the next ones only  */
+        for(u32LocRow = 0U; u32LocRow < ptrLocRows->u32FramesNb; u32LocRow++)
+        {
+            u8LocId = ptrLocRows->ptrId[u32LocRow];
+            if((u32LocRow != ptrChunk->astrEdge[u8LocId].u32FirstRow) && (abLocRetrack[u8LocId] == FALSE))
+            {
+                ptrLocRows->ptrFrameDropCnt[u32LocRow] = ptrLocRows->ptrFrameDropCnt[u32LocRow]
+                                                       + au64LocDropOffset[u8LocId];
+                ptrLocRows->ptrFrameNb[u32LocRow]      = ptrLocRows->ptrFrameNb[u32LocRow]
+                                                       + au64LocFrameNbOffset[u8LocId];
+                ptrLocRows->ptrTimestamp[u32LocRow]    = ptrLocRows->ptrTimestamp[u32LocRow]
+                                                       + au64LocTimestampOffset[u8LocId];
+            }
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8ParallelDecode                                                                         */
+/* !Description : Decode the rows in [ptrBegin, ptrEnd) on several threads and write them in the input order.         */
+/*                The input is processed in rounds of one chunk per thread to keep the memory use bounded.            */
+/*                                                                                                                    */
+/* !Inputs      : ptrContext                    !Comment : Initialized decoder context, its frame definitions are     */
+/*                                                         shared by all the threads                                  */
+/*                ptrBegin                      !Comment : First row of the input (after the header)                  */
+/*                ptrEnd                        !Comment : End of the input                                           */
+/*                bRecords                      !Comment : TRUE for the records of a "csv2bin" file, FALSE for .csv   */
+/*                                                         rows                                                       */
+/*                ptrWriter                     !Comment : Output .csv writer, header already written                 */
+/*                ptrBinary                     !Comment : Binary writer for the binary output, NULL for .csv         */
+/*                ptrSelect                     !Comment : Rows to be written, NULL for all of them                   */
+/*                ptrSummary                    !Comment : Summary of the rows before ptrBegin, NULL to write the     */
+/*                                                         rows instead of accumulating them                          */
+/*                ptrStats                      !Comment : Run statistics, NULL without "--stats". The stage times    */
+/*                                                         of the worker threads are summed.                          */
+/*                u32ThreadsNb                  !Comment : Number of worker threads, or of chunks per round for a     */
+/*                                                         pool                                                       */
+/*                                              !Range   : [1, PARALLEL_MAX_THREADS]                                  */
+/*                ptrPool                       !Comment : Pool running the calling job (batch mode), its workers     */
+/*                                                         take the chunks, NULL to start one thread per chunk        */
+/* !Outputs     : ptrContext                    !Comment : Tracking state at the end of the decoded rows              */
+/*                ptrSummary                    !Comment : Summary including the decoded rows                         */
+/*                ptrStats                      !Comment : Timings and counters of the decoded rows                   */
+/*                ptrRowNumber                  !Comment : Rows before ptrBegin on input, plus the rows decoded on    */
+/*                                                         output (written or not by ptrSelect)                       */
+/*                u8LocStatus                   !Comment : Decoding status                                            */
+/*                                              !Range   : PARALLEL_DONE,                                             */
+/*                                                         PARALLEL_ROW_ERROR,                                        */
+/*                                                         PARALLEL_NO_MEMORY                                         */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8ParallelDecode(LogDecoder_strContextType *ptrContext, const char *ptrBegin, const char *ptrEnd,
+                                  boolean bRecords, LogDecoder_strWriterType *ptrWriter,
+                                  LogDecoder_strBinaryWriterType *ptrBinary,
+                                  const LogDecoder_strSelectType *ptrSelect, LogDecoder_strSummaryType *ptrSummary,
+                                  LogDecoder_strStatsType *ptrStats, uint32 u32ThreadsNb,
+                                  LogDecoder_strPoolType *ptrPool, uint32 *ptrRowNumber)
+{
+    LogDecoder_strChunkType *ptrLocChunks = NULL;
+    const char *ptrLocCursor = ptrBegin;
+    const char *ptrLocSplit = NULL;
+    uint32 u32LocChunksNb = FALSE;
+    uint32 u32LocIndex = FALSE;
+    uint8 u8LocStatus = PARALLEL_DONE;
+
+    if(u32ThreadsNb > PARALLEL_MAX_THREADS)
+    {
+        u32ThreadsNb = PARALLEL_MAX_THREADS;
+    }
+    ptrLocChunks = malloc(u32ThreadsNb * sizeof(LogDecoder_strChunkType));
+    if(ptrLocChunks == NULL)
+    {
+        return PARALLEL_NO_MEMORY;
+    }
+
+    while((ptrLocCursor < ptrEnd) && (u8LocStatus == PARALLEL_DONE))
+    {
+        /* Split the next part of the input into one chunk per thread, on line (or record)        */
+        /* boundaries                                                                             */
+        memset(ptrLocChunks, 0, u32ThreadsNb * sizeof(LogDecoder_strChunkType));
+        for(u32LocChunksNb = 0U; (u32LocChunksNb < u32ThreadsNb) && (ptrLocCursor < ptrEnd); u32LocChunksNb++)
+        {
+            ptrLocSplit = ptrLocCursor + PARALLEL_CHUNK_SIZE;
+            if((ptrLocSplit >= ptrEnd) || (ptrLocSplit < ptrLocCursor))
+            {
+                ptrLocSplit = ptrEnd;
+            }
+            else if(bRecords == TRUE)
+            {
+                ptrLocSplit = ptrLocCursor + ((PARALLEL_CHUNK_SIZE / RECORD_SIZE) * RECORD_SIZE);
+            }
+            else
+            {
+                ptrLocSplit = memchr(ptrLocSplit, '\n', (size_t)(ptrEnd - ptrLocSplit));
+                ptrLocSplit = (ptrLocSplit == NULL) ? ptrEnd : (ptrLocSplit + 1);
+            }
+            ptrLocChunks[u32LocChunksNb].ptrBegin = ptrLocCursor;
+            ptrLocChunks[u32LocChunksNb].ptrEnd   = ptrLocSplit;
+            ptrLocChunks[u32LocChunksNb].ptrRegistry = ptrContext->ptrRegistry;
+            ptrLocChunks[u32LocChunksNb].ptrSelect   = ptrSelect;
+            ptrLocChunks[u32LocChunksNb].bWrap16     = ptrContext->bWrap16;
+            ptrLocChunks[u32LocChunksNb].bRecords    = bRecords;
+            ptrLocChunks[u32LocChunksNb].bFormat     = (boolean)(ptrBinary == NULL);
+            ptrLocChunks[u32LocChunksNb].bSummary    = (boolean)(ptrSummary != NULL);
+            ptrLocChunks[u32LocChunksNb].bStats      = (boolean)(ptrStats != NULL);
+            ptrLocCursor = ptrLocSplit;
+        }
+
+        LogDecoder_vidParallelRun(LogDecoder_s32ParallelDecodeChunk, ptrLocChunks, u32LocChunksNb, ptrPool);
+
+        /* Stitch the chunks in order, nothing after the first malformed row is written           */
+        for(u32LocIndex = 0U; u32LocIndex < u32LocChunksNb; u32LocIndex++)
+        {
+            if(ptrLocChunks[u32LocIndex].bNoMemory == TRUE)
+            {
+                u8LocStatus = PARALLEL_NO_MEMORY;
+                break;
+            }
+            LogDecoder_vidStatsStart(ptrStats);
+            LogDecoder_vidParallelStitchChunk(ptrContext, &ptrLocChunks[u32LocIndex]);
+            /* The rows are counted before the selection, the row numbers stay those of the input */
+            *ptrRowNumber += ptrLocChunks[u32LocIndex].strRows.u32FramesNb;
+            LogDecoder_vidBatchSelect(ptrSelect, &ptrLocChunks[u32LocIndex].strRows);
+            LogDecoder_vidStatsLap(ptrStats, STATS_STAGE_VALIDATE);
+            LogDecoder_vidStatsBatch(ptrStats, ptrContext, &ptrLocChunks[u32LocIndex].strRows);
+            if(ptrLocChunks[u32LocIndex].bParseError == TRUE)
+            {
+                u8LocStatus = PARALLEL_ROW_ERROR;
+                u32LocIndex++;
+                break;
+            }
+        }
+        u32LocChunksNb = u32LocIndex;
+
+        /* The binary output takes the decoded chunk columns as they are, only the .csv rows are  */
+        /* formatted                                                                              */
+        if(u32LocChunksNb > 0U)
+        {
+            LogDecoder_vidParallelRun(LogDecoder_s32ParallelFormatChunk, ptrLocChunks, u32LocChunksNb, ptrPool);
+        }
+        LogDecoder_vidStatsStart(ptrStats);
+        for(u32LocIndex = 0U; u32LocIndex < u32LocChunksNb; u32LocIndex++)
+        {
+            if(ptrLocChunks[u32LocIndex].bNoMemory == TRUE)
+            {
+                u8LocStatus = PARALLEL_NO_MEMORY;
+                break;
+            }
+            if(ptrSummary != NULL)
+            {
+                /* The chunks follow each other, the periods and drops between them are counted   */
+                LogDecoder_vidSummaryMerge(ptrSummary, &ptrLocChunks[u32LocIndex].strSummary,
+                                           ptrContext->ptrRegistry, TRUE);
+            }
+            else if(ptrBinary != NULL)
+            {
+                LogDecoder_vidBinaryBatch(ptrBinary, &ptrLocChunks[u32LocIndex].strRows);
+            }
+            else
+            {
+                LogDecoder_vidWriterText(ptrWriter, ptrLocChunks[u32LocIndex].strText.ptrBuffer,
+                                         ptrLocChunks[u32LocIndex].strText.u32Used);
+            }
+        }
+        LogDecoder_vidStatsLap(ptrStats, STATS_STAGE_OUTPUT);
+
+        for(u32LocIndex = 0U; u32LocIndex < u32ThreadsNb; u32LocIndex++)
+        {
+            LogDecoder_vidStatsMerge(ptrStats, &ptrLocChunks[u32LocIndex].strStats);
+            LogDecoder_vidBatchClose(&ptrLocChunks[u32LocIndex].strRows);
+            (void)LogDecoder_bWriterClose(&ptrLocChunks[u32LocIndex].strText);
+        }
+    }
+
+    free(ptrLocChunks);
+
+    return u8LocStatus;
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,51 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Multi-threaded chunked decoding. The mapped input is split at line boundaries into chunks that      */
+/*                are decoded concurrently with chunk-local tracking state, then a sequential stitch pass fixes       */
+/*                the TimeoutOK flag at the chunk edges and offsets the cumulative FrameDropCnt, so that the          */
+/*                output is identical to the serial decoding.                                                         */
+/*                                                                                                                    */
+/*  File        : log_decoder_Parallel.h                                                                              */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_PARALLEL_H
+#define LOG_DECODER_PARALLEL_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+#include "log_decoder_Binary.h"
+#include "log_decoder_Pool.h"
+#include "log_decoder_Stats.h"
+#include "log_decoder_Summary.h"
+#include "log_decoder_Writer.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+#define PARALLEL_CHUNK_SIZE             (8U * 1024U * 1024U)
+#define PARALLEL_MAX_THREADS            64U
+/*----------------------------- Decoding status ------------------------------*/
+#define PARALLEL_DONE                   0U
+#define PARALLEL_ROW_ERROR              1U
+#define PARALLEL_NO_MEMORY              2U
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8ParallelDecode(LogDecoder_strContextType *ptrContext, const char *ptrBegin, const char *ptrEnd,
+                                  boolean bRecords, LogDecoder_strWriterType *ptrWriter,
+                                  LogDecoder_strBinaryWriterType *ptrBinary,
+                                  const LogDecoder_strSelectType *ptrSelect, LogDecoder_strSummaryType *ptrSummary,
+                                  LogDecoder_strStatsType *ptrStats, uint32 u32ThreadsNb,
+                                  LogDecoder_strPoolType *ptrPool, uint32 *ptrRowNumber);
+
+#endif /* LOG_DECODER_PARALLEL_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
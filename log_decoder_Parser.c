@@ -0,0 +1,406 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Zero-copy CSV tokenizer. Splits the input rows on ',' and '\n' by pointer and converts the          */
+/*                decimal and hex fields straight into LogDecoder_strInputDataType, without going through             */
+/*                the format string interpretation and locale handling of fscanf.                                     */
+/*                                                                                                                    */
+/*  File        : log_decoder_Parser.c                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_bIsSpace                                                                                            */
+/* 2 / LogDecoder_bParseDecimal                                                                                       */
+/* 3 / LogDecoder_bParseHex                                                                                           */
+/* 4 / LogDecoder_bSkipHex                                                                                            */
+/* 5 / LogDecoder_u8ParseHeader                                                                                       */
+/* 6 / LogDecoder_u8ParseRow                                                                                          */
+/* 7 / LogDecoder_u8ParseBatch                                                                                        */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder_Parser.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define DECIMAL_BASE                     10U
+#define HEX_SHIFT                        4U
+#define HEX_INVALID_DIGIT                0U
+#define FIELD_SEPARATOR                  ','
+#define ROW_SEPARATOR                    '\n'
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+/* Hex digit lookup table, every valid digit is stored as (value + 1) so that zero marks an invalid character         */
+static const uint8 LogDecoder_au8HexDigitTable[256] =
+{
+    ['0'] = 1U,  ['1'] = 2U,  ['2'] = 3U,  ['3'] = 4U,  ['4'] = 5U,  ['5'] = 6U,  ['6'] = 7U,  ['7'] = 8U,
+    ['8'] = 9U,  ['9'] = 10U, ['a'] = 11U, ['b'] = 12U, ['c'] = 13U, ['d'] = 14U, ['e'] = 15U, ['f'] = 16U,
+    ['A'] = 11U, ['B'] = 12U, ['C'] = 13U, ['D'] = 14U, ['E'] = 15U, ['F'] = 16U
+};
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bIsSpace(char cCharacter);
+static boolean LogDecoder_bParseDecimal(const char **ptrCursor, const char *ptrEnd, uint64 *ptrValue);
+static boolean LogDecoder_bParseHex(const char **ptrCursor, const char *ptrEnd, uint32 *ptrValue);
+static boolean LogDecoder_bSkipHex(const char **ptrCursor, const char *ptrEnd);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bIsSpace                                                                                 */
+/* !Description : Check if the given character is a white space (same set as the fscanf white space directive)        */
+/*                                                                                                                    */
+/* !Inputs      : cCharacter                    !Comment : Character to be checked                                    */
+/*                                              !Range   : [0x00, 0xFF]                                               */
+/* !Outputs     : bLocIsSpace                   !Comment : TRUE if the character is a white space                     */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bIsSpace(char cCharacter)
+{
+    boolean bLocIsSpace = FALSE;
+
+    if(  (cCharacter == ' ')  || (cCharacter == '\n') || (cCharacter == '\r')
+      || (cCharacter == '\t') || (cCharacter == '\v') || (cCharacter == '\f') )
+    {
+        bLocIsSpace = TRUE;
+    }
+
+    return bLocIsSpace;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bParseDecimal                                                                            */
+/* !Description : Convert the unsigned decimal field at the cursor and move the cursor after its last digit           */
+/*                                                                                                                    */
+/* !Inputs      : ptrCursor                     !Comment : Current position inside the row                            */
+/*                ptrEnd                        !Comment : End of the current row                                     */
+/* !Outputs     : ptrValue                      !Comment : Converted value                                            */
+/*                                              !Range   : [0, 2^64 - 1]                                              */
+/*                bLocStatus                    !Comment : TRUE if at least one digit was found                       */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bParseDecimal(const char **ptrCursor, const char *ptrEnd, uint64 *ptrValue)
+{
+    const char *ptrLocCursor = *ptrCursor;
+    const char *ptrLocFirstDigit = NULL;
+    uint64 u64LocValue = FALSE;
+    uint8 u8LocDigit = FALSE;
+
+    /* Leading blanks are accepted before a number, as fscanf("%u") does                          */
+    while((ptrLocCursor < ptrEnd) && ((*ptrLocCursor == ' ') || (*ptrLocCursor == '\t')))
+    {
+        ptrLocCursor++;
+    }
+    ptrLocFirstDigit = ptrLocCursor;
+
+    /* A single unsigned compare covers both the '0' and the '9' bounds                           */
+    while((ptrLocCursor < ptrEnd) && ((u8LocDigit = (uint8)(*ptrLocCursor - '0')) < DECIMAL_BASE))
+    {
+        u64LocValue = (u64LocValue * DECIMAL_BASE) + u8LocDigit;
+        ptrLocCursor++;
+    }
+
+    *ptrValue  = u64LocValue;
+    *ptrCursor = ptrLocCursor;
+
+    return (boolean)(ptrLocCursor != ptrLocFirstDigit);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bParseHex                                                                                */
+/* !Description : Convert the hex field at the cursor (optional 0x prefix) and move the cursor after its last digit   */
+/*                                                                                                                    */
+/* !Inputs      : ptrCursor                     !Comment : Current position inside the row                            */
+/*                ptrEnd                        !Comment : End of the current row                                     */
+/* !Outputs     : ptrValue                      !Comment : Converted value                                            */
+/*                                              !Range   : [0x00000000, 0xFFFFFFFF]                                   */
+/*                bLocStatus                    !Comment : TRUE if at least one digit was found                       */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bParseHex(const char **ptrCursor, const char *ptrEnd, uint32 *ptrValue)
+{
+    const char *ptrLocCursor = *ptrCursor;
+    const char *ptrLocFirstDigit = NULL;
+    uint32 u32LocValue = FALSE;
+    uint8 u8LocDigit = FALSE;
+
+    while((ptrLocCursor < ptrEnd) && ((*ptrLocCursor == ' ') || (*ptrLocCursor == '\t')))
+    {
+        ptrLocCursor++;
+    }
+    /* Skip the "0x" prefix only if it is followed by a hex digit, else the '0' is the value      */
+    if(  ((ptrEnd - ptrLocCursor) > 2) && (ptrLocCursor[0] == '0')
+      && ((ptrLocCursor[1] == 'x') || (ptrLocCursor[1] == 'X'))
+      && (LogDecoder_au8HexDigitTable[(uint8)ptrLocCursor[2]] != HEX_INVALID_DIGIT) )
+    {
+        ptrLocCursor += 2;
+    }
+    ptrLocFirstDigit = ptrLocCursor;
+
+    while((ptrLocCursor < ptrEnd)
+       && ((u8LocDigit = LogDecoder_au8HexDigitTable[(uint8)*ptrLocCursor]) != HEX_INVALID_DIGIT))
+    {
+        u32LocValue = (u32LocValue << HEX_SHIFT) | (uint32)(u8LocDigit - 1U);
+        ptrLocCursor++;
+    }
+
+    *ptrValue  = u32LocValue;
+    *ptrCursor = ptrLocCursor;
+
+    return (boolean)(ptrLocCursor != ptrLocFirstDigit);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bSkipHex                                                                                 */
+/* !Description : Move the cursor over the hex field at the cursor without converting it, the field is accepted and   */
+/*                the cursor moved exactly as with LogDecoder_bParseHex                                               */
+/*                                                                                                                    */
+/* !Inputs      : ptrCursor                     !Comment : Current position inside the row                            */
+/*                ptrEnd                        !Comment : End of the current row                                     */
+/* !Outputs     : ptrCursor                     !Comment : Character after the last digit                             */
+/*                bLocStatus                    !Comment : TRUE if at least one digit was found                       */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bSkipHex(const char **ptrCursor, const char *ptrEnd)
+{
+    const char *ptrLocCursor = *ptrCursor;
+    const char *ptrLocFirstDigit = NULL;
+
+    while((ptrLocCursor < ptrEnd) && ((*ptrLocCursor == ' ') || (*ptrLocCursor == '\t')))
+    {
+        ptrLocCursor++;
+    }
+    if(  ((ptrEnd - ptrLocCursor) > 2) && (ptrLocCursor[0] == '0')
+      && ((ptrLocCursor[1] == 'x') || (ptrLocCursor[1] == 'X'))
+      && (LogDecoder_au8HexDigitTable[(uint8)ptrLocCursor[2]] != HEX_INVALID_DIGIT) )
+    {
+        ptrLocCursor += 2;
+    }
+    ptrLocFirstDigit = ptrLocCursor;
+
+    while((ptrLocCursor < ptrEnd) && (LogDecoder_au8HexDigitTable[(uint8)*ptrLocCursor] != HEX_INVALID_DIGIT))
+    {
+        ptrLocCursor++;
+    }
+    *ptrCursor = ptrLocCursor;
+
+    return (boolean)(ptrLocCursor != ptrLocFirstDigit);
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8ParseHeader                                                                            */
+/* !Description : Check that the first token of the input is the expected header HEADER_FOR_INPUT_FILE                */
+/*                                                                                                                    */
+/* !Inputs      : ptrCursor                     !Comment : Start of the input data, moved after the header            */
+/*                ptrEnd                        !Comment : End of the available input data                            */
+/*                bLastBlock                    !Comment : TRUE if no more data follows ptrEnd                        */
+/* !Outputs     : u8LocStatus                   !Comment : Header check status                                        */
+/*                                              !Range   : PARSER_ROW_OK,                                             */
+/*                                                         PARSER_ROW_ERROR,                                          */
+/*                                                         PARSER_ROW_INCOMPLETE                                      */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8ParseHeader(const char **ptrCursor, const char *ptrEnd, boolean bLastBlock)
+{
+    const char *ptrLocCursor = *ptrCursor;
+    const char *ptrLocToken = NULL;
+    uint8 u8LocStatus = PARSER_ROW_ERROR;
+
+    while((ptrLocCursor < ptrEnd) && (LogDecoder_bIsSpace(*ptrLocCursor) == TRUE))
+    {
+        ptrLocCursor++;
+    }
+    ptrLocToken = ptrLocCursor;
+    while((ptrLocCursor < ptrEnd) && (LogDecoder_bIsSpace(*ptrLocCursor) == FALSE))
+    {
+        ptrLocCursor++;
+    }
+
+    /* The header is a single token, compare it with its full length                              */
+    if((ptrLocCursor == ptrEnd) && (bLastBlock == FALSE))
+    {
+        /* The token may continue in the data that is not read yet                                */
+        u8LocStatus = PARSER_ROW_INCOMPLETE;
+    }
+    else if(  ((size_t)(ptrLocCursor - ptrLocToken) == (sizeof(HEADER_FOR_INPUT_FILE) - 1U))
+      && (memcmp(ptrLocToken, HEADER_FOR_INPUT_FILE, sizeof(HEADER_FOR_INPUT_FILE) - 1U) == 0) )
+    {
+        u8LocStatus = PARSER_ROW_OK;
+        *ptrCursor = ptrLocCursor;
+    }
+
+    return u8LocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8ParseRow                                                                               */
+/* !Description : Tokenize one "ID,FrameNb,Timestamp,Payload,Checksum" row and move the cursor after it. A row which  */
+/*                cannot be selected is only converted up to its Timestamp, still needed by the tracking : its        */
+/*                Payload and Checksum are checked like those of any row, but not converted and set to 0.             */
+/*                                                                                                                    */
+/* !Inputs      : ptrCursor                     !Comment : Current position in the input data                         */
+/*                ptrEnd                        !Comment : End of the available input data                            */
+/*                bLastBlock                    !Comment : TRUE if no more data follows ptrEnd                        */
+/*                ptrSelect                     !Comment : Rows to be selected, NULL for all of them                  */
+/* !Outputs     : ptrInputData                  !Comment : Converted row content                                      */
+/*                u8LocStatus                   !Comment : Row parsing status                                         */
+/*                                              !Range   : PARSER_ROW_OK,                                             */
+/*                                                         PARSER_ROW_ERROR,                                          */
+/*                                                         PARSER_ROW_INCOMPLETE,                                     */
+/*                                                         PARSER_END_OF_DATA                                         */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8ParseRow(const char **ptrCursor, const char *ptrEnd, boolean bLastBlock,
+                            const LogDecoder_strSelectType *ptrSelect, LogDecoder_strInputDataType *ptrInputData)
+{
+    const char *ptrLocCursor = *ptrCursor;
+    const char *ptrLocRowEnd = NULL;
+    uint64 u64LocId = FALSE;
+    uint64 u64LocFrameNb = FALSE;
+    uint64 u64LocTimestamp = FALSE;
+    uint32 u32LocPayload = FALSE;
+    uint32 u32LocChecksum = FALSE;
+    boolean bLocStatus = FALSE;
+
+    /* Skip the line breaks and blanks between the rows                                           */
+    while((ptrLocCursor < ptrEnd) && (LogDecoder_bIsSpace(*ptrLocCursor) == TRUE))
+    {
+        ptrLocCursor++;
+    }
+    *ptrCursor = ptrLocCursor;
+    if(ptrLocCursor == ptrEnd)
+    {
+        return (bLastBlock == TRUE) ? PARSER_END_OF_DATA : PARSER_ROW_INCOMPLETE;
+    }
+
+    /* A row is only parsed once its line break is available, unless it is the last one           */
+    ptrLocRowEnd = memchr(ptrLocCursor, ROW_SEPARATOR, (size_t)(ptrEnd - ptrLocCursor));
+    if(ptrLocRowEnd == NULL)
+    {
+        if(bLastBlock == FALSE)
+        {
+            return PARSER_ROW_INCOMPLETE;
+        }
+        ptrLocRowEnd = ptrEnd;
+    }
+
+    /* Every field must hold at least one digit and be followed by its separator                  */
+    bLocStatus =  LogDecoder_bParseDecimal(&ptrLocCursor, ptrLocRowEnd, &u64LocId)
+              && (ptrLocCursor < ptrLocRowEnd) && (*ptrLocCursor++ == FIELD_SEPARATOR)
+              && LogDecoder_bParseDecimal(&ptrLocCursor, ptrLocRowEnd, &u64LocFrameNb)
+              && (ptrLocCursor < ptrLocRowEnd) && (*ptrLocCursor++ == FIELD_SEPARATOR)
+              && LogDecoder_bParseDecimal(&ptrLocCursor, ptrLocRowEnd, &u64LocTimestamp)
+              && (ptrLocCursor < ptrLocRowEnd) && (*ptrLocCursor++ == FIELD_SEPARATOR);
+    if(  (bLocStatus == TRUE) && (ptrSelect != NULL)
+      && (  (ptrSelect->abId[(uint8)u64LocId] == FALSE)
+         || (  (ptrSelect->bParseTimestamp == TRUE)
+            && ((u64LocTimestamp < ptrSelect->u64FromTimestamp) || (u64LocTimestamp > ptrSelect->u64ToTimestamp)) ) ) )
+    {
+        /* Not selected : no hex conversion, the tracking only needs FrameNb and Timestamp, but a */
+        /* malformed row still ends the decoding where the full decoding would stop               */
+        bLocStatus =  LogDecoder_bSkipHex(&ptrLocCursor, ptrLocRowEnd)
+                  && (ptrLocCursor < ptrLocRowEnd) && (*ptrLocCursor++ == FIELD_SEPARATOR)
+                  && LogDecoder_bSkipHex(&ptrLocCursor, ptrLocRowEnd);
+    }
+    else
+    {
+        bLocStatus =  bLocStatus
+                  && LogDecoder_bParseHex(&ptrLocCursor, ptrLocRowEnd, &u32LocPayload)
+                  && (ptrLocCursor < ptrLocRowEnd) && (*ptrLocCursor++ == FIELD_SEPARATOR)
+                  && LogDecoder_bParseHex(&ptrLocCursor, ptrLocRowEnd, &u32LocChecksum);
+    }
+    if(bLocStatus == FALSE)
+    {
+        return PARSER_ROW_ERROR;
+    }
+
+    ptrInputData->u8Id         = (uint8)u64LocId;
+    ptrInputData->u64FrameNb   = u64LocFrameNb;
+    ptrInputData->u64Timestamp = u64LocTimestamp;
+    ptrInputData->u32Payload   = u32LocPayload;
+    ptrInputData->u8Checksum   = (uint8)u32LocChecksum;
+
+    /* Anything left after the checksum is reported with the next row, like fscanf would do       */
+    *ptrCursor = ptrLocCursor;
+
+    return PARSER_ROW_OK;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8ParseBatch                                                                             */
+/* !Description : Parse the rows at the cursor into the input columns of a batch, until the batch is full or a        */
+/*                row cannot be parsed. The rows parsed before that row stay in the batch.                            */
+/*                                                                                                                    */
+/* !Inputs      : ptrCursor                     !Comment : First character to be parsed                               */
+/*                ptrEnd                        !Comment : End of the available data                                  */
+/*                bLastBlock                    !Comment : TRUE if no data follows ptrEnd                             */
+/*                ptrSelect                     !Comment : Rows to be selected, NULL for all of them                  */
+/*                ptrBatch                      !Comment : Batch to be filled, possibly not empty                     */
+/* !Outputs     : ptrCursor                     !Comment : Start of the first row not parsed                          */
+/*                ptrBatch                      !Comment : Batch with the parsed rows appended                        */
+/*                u8LocStatus                   !Comment : Status of the last row, PARSER_ROW_OK when the batch       */
+/*                                                         is full                                                    */
+/*                                              !Range   : PARSER_ROW_OK,                                             */
+/*                                                         PARSER_ROW_ERROR,                                          */
+/*                                                         PARSER_ROW_INCOMPLETE,                                     */
+/*                                                         PARSER_END_OF_DATA                                         */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8ParseBatch(const char **ptrCursor, const char *ptrEnd, boolean bLastBlock,
+                              const LogDecoder_strSelectType *ptrSelect, LogDecoder_strBatchType *ptrBatch)
+{
+    LogDecoder_strInputDataType strLocInputData = {FALSE};
+    uint8 u8LocStatus = PARSER_ROW_OK;
+    uint32 u32LocIndex = ptrBatch->u32FramesNb;
+
+    while(  (u32LocIndex < ptrBatch->u32Capacity)
+         && ((u8LocStatus = LogDecoder_u8ParseRow(ptrCursor, ptrEnd, bLastBlock, ptrSelect,
+                                                  &strLocInputData)) == PARSER_ROW_OK) )
+    {
+        ptrBatch->ptrId[u32LocIndex]        = strLocInputData.u8Id;
+        ptrBatch->ptrFrameNb[u32LocIndex]   = strLocInputData.u64FrameNb;
+        ptrBatch->ptrTimestamp[u32LocIndex] = strLocInputData.u64Timestamp;
+        ptrBatch->ptrPayload[u32LocIndex]   = (uint32p)strLocInputData.u32Payload;
+        ptrBatch->ptrChecksum[u32LocIndex]  = strLocInputData.u8Checksum;
+        u32LocIndex++;
+    }
+    ptrBatch->u32FramesNb = u32LocIndex;
+
+    return u8LocStatus;
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
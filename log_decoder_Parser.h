@@ -0,0 +1,44 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Zero-copy CSV tokenizer. Splits the input rows on ',' and '\n' by pointer and converts the          */
+/*                decimal and hex fields straight into LogDecoder_strInputDataType, without going through             */
+/*                the format string interpretation and locale handling of fscanf.                                     */
+/*                                                                                                                    */
+/*  File        : log_decoder_Parser.h                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_PARSER_H
+#define LOG_DECODER_PARSER_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+#include "log_decoder_Batch.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/*------------------------------ Parse row status ----------------------------*/
+#define PARSER_ROW_OK                   0U
+#define PARSER_ROW_ERROR                1U
+#define PARSER_ROW_INCOMPLETE           2U
+#define PARSER_END_OF_DATA              3U
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8ParseHeader(const char **ptrCursor, const char *ptrEnd, boolean bLastBlock);
+uint8 LogDecoder_u8ParseRow(const char **ptrCursor, const char *ptrEnd, boolean bLastBlock,
+                            const LogDecoder_strSelectType *ptrSelect, LogDecoder_strInputDataType *ptrInputData);
+uint8 LogDecoder_u8ParseBatch(const char **ptrCursor, const char *ptrEnd, boolean bLastBlock,
+                              const LogDecoder_strSelectType *ptrSelect, LogDecoder_strBatchType *ptrBatch);
+
+#endif /* LOG_DECODER_PARSER_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,341 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Pipeline stages. A stage is one thread connected to the decoding thread by two bounded lock-free    */
+/*                single-producer single-consumer queues of blocks : the filled blocks go one way, the emptied        */
+/*                blocks come back the other way, so that reading, decoding and writing overlap in time.              */
+/*                                                                                                                    */
+/*  File        : log_decoder_Pipeline.c                                                                              */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_vidQueueWait                                                                                        */
+/* 2 / LogDecoder_vidQueueWake                                                                                        */
+/* 3 / LogDecoder_bQueuePush                                                                                          */
+/* 4 / LogDecoder_ptrQueuePop                                                                                         */
+/* 5 / LogDecoder_vidQueuePut                                                                                         */
+/* 6 / LogDecoder_ptrQueueGet                                                                                         */
+/* 7 / LogDecoder_bStageStart                                                                                         */
+/* 8 / LogDecoder_vidStageJoin                                                                                        */
+/* 9 / LogDecoder_vidStageRelease                                                                                     */
+/* 10 / LogDecoder_vidStageStop                                                                                       */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder_Pipeline.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static void LogDecoder_vidQueueWait(LogDecoder_strQueueType *ptrQueue, boolean bFull, uint32 *ptrSpinsNb);
+static void LogDecoder_vidQueueWake(LogDecoder_strQueueType *ptrQueue);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidQueueWait                                                                             */
+/* !Description : Wait for the other thread to pop a block from a full queue or to push one to an empty queue. The    */
+/*                processor is given away for a short wait, then the thread sleeps, so that a stage waiting for a     */
+/*                slow disk or a slow reader of the output does not keep a core busy. The waiting flag is set before  */
+/*                the queue is checked again, the other thread checks it after its push or pop : one of them sees the */
+/*                change of the other, no wake-up is lost.                                                            */
+/*                                                                                                                    */
+/* !Inputs      : ptrQueue                      !Comment : Queue                                                      */
+/*                bFull                         !Comment : TRUE to wait for a free slot, FALSE for a block            */
+/*                ptrSpinsNb                    !Comment : Number of checks of the queue so far, 0 for the first wait */
+/* !Outputs     : ptrSpinsNb                    !Comment : Incremented                                                */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidQueueWait(LogDecoder_strQueueType *ptrQueue, boolean bFull, uint32 *ptrSpinsNb)
+{
+#ifdef PIPELINE_THREADS
+    if(*ptrSpinsNb < PIPELINE_SPINS_NUMBER)
+    {
+        thrd_yield();
+    }
+    else
+    {
+        (void)mtx_lock(&ptrQueue->strMutex);
+        ptrQueue->bWaiting = TRUE;
+        while(  ((bFull == TRUE) && ((ptrQueue->u32Tail - ptrQueue->u32Head) >= PIPELINE_QUEUE_DEPTH))
+             || ((bFull == FALSE) && (ptrQueue->u32Tail == ptrQueue->u32Head)) )
+        {
+            (void)cnd_wait(&ptrQueue->strCondition, &ptrQueue->strMutex);
+        }
+        ptrQueue->bWaiting = FALSE;
+        (void)mtx_unlock(&ptrQueue->strMutex);
+    }
+#else
+    (void)ptrQueue;
+    (void)bFull;
+#endif
+    (*ptrSpinsNb)++;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidQueueWake                                                                             */
+/* !Description : Wake the thread sleeping on a queue up after a push or a pop, nothing is locked when none sleeps    */
+/*                                                                                                                    */
+/* !Inputs      : ptrQueue                      !Comment : Queue just pushed or popped                                */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidQueueWake(LogDecoder_strQueueType *ptrQueue)
+{
+#ifdef PIPELINE_THREADS
+    if(ptrQueue->bWaiting == TRUE)
+    {
+        (void)mtx_lock(&ptrQueue->strMutex);
+        (void)cnd_signal(&ptrQueue->strCondition);
+        (void)mtx_unlock(&ptrQueue->strMutex);
+    }
+#else
+    (void)ptrQueue;
+#endif
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bQueuePush                                                                               */
+/* !Description : Append a block to the queue if it has a free slot, called by the producer thread only. The slot     */
+/*                is filled before the new tail is published, the consumer never sees a slot being written.           */
+/*                                                                                                                    */
+/* !Inputs      : ptrQueue                      !Comment : Queue                                                      */
+/*                ptrBlock                      !Comment : Block handed to the consumer                               */
+/* !Outputs     : bLocStatus                    !Comment : FALSE if the queue is full                                 */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bQueuePush(LogDecoder_strQueueType *ptrQueue, LogDecoder_strBlockType *ptrBlock)
+{
+    boolean bLocStatus = FALSE;
+    size_t u32LocTail = ptrQueue->u32Tail;
+
+    if((u32LocTail - ptrQueue->u32Head) < PIPELINE_QUEUE_DEPTH)
+    {
+        ptrQueue->aptrSlot[u32LocTail % PIPELINE_QUEUE_DEPTH] = ptrBlock;
+        ptrQueue->u32Tail = u32LocTail + 1U;
+        LogDecoder_vidQueueWake(ptrQueue);
+        bLocStatus = TRUE;
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrQueuePop                                                                              */
+/* !Description : Take the oldest block of the queue if there is one, called by the consumer thread only              */
+/*                                                                                                                    */
+/* !Inputs      : ptrQueue                      !Comment : Queue                                                      */
+/* !Outputs     : ptrLocBlock                   !Comment : Oldest block, NULL if the queue is empty                   */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+LogDecoder_strBlockType *LogDecoder_ptrQueuePop(LogDecoder_strQueueType *ptrQueue)
+{
+    LogDecoder_strBlockType *ptrLocBlock = NULL;
+    size_t u32LocHead = ptrQueue->u32Head;
+
+    if(u32LocHead != ptrQueue->u32Tail)
+    {
+        ptrLocBlock = ptrQueue->aptrSlot[u32LocHead % PIPELINE_QUEUE_DEPTH];
+        ptrQueue->u32Head = u32LocHead + 1U;
+        LogDecoder_vidQueueWake(ptrQueue);
+    }
+
+    return ptrLocBlock;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidQueuePut                                                                              */
+/* !Description : Append a block to the queue, waiting for a free slot                                                */
+/*                                                                                                                    */
+/* !Inputs      : ptrQueue                      !Comment : Queue                                                      */
+/*                ptrBlock                      !Comment : Block handed to the consumer                               */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidQueuePut(LogDecoder_strQueueType *ptrQueue, LogDecoder_strBlockType *ptrBlock)
+{
+    uint32 u32LocSpinsNb = FALSE;
+
+    while(LogDecoder_bQueuePush(ptrQueue, ptrBlock) == FALSE)
+    {
+        LogDecoder_vidQueueWait(ptrQueue, TRUE, &u32LocSpinsNb);
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrQueueGet                                                                              */
+/* !Description : Take the oldest block of the queue, waiting for one                                                 */
+/*                                                                                                                    */
+/* !Inputs      : ptrQueue                      !Comment : Queue                                                      */
+/* !Outputs     : ptrLocBlock                   !Comment : Oldest block                                               */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+LogDecoder_strBlockType *LogDecoder_ptrQueueGet(LogDecoder_strQueueType *ptrQueue)
+{
+    LogDecoder_strBlockType *ptrLocBlock = NULL;
+    uint32 u32LocSpinsNb = FALSE;
+
+    while((ptrLocBlock = LogDecoder_ptrQueuePop(ptrQueue)) == NULL)
+    {
+        LogDecoder_vidQueueWait(ptrQueue, FALSE, &u32LocSpinsNb);
+    }
+
+    return ptrLocBlock;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bStageStart                                                                              */
+/* !Description : Empty both queues, give the blocks to the producer through the free queue and start the thread      */
+/*                of the stage                                                                                        */
+/*                                                                                                                    */
+/* !Inputs      : ptrFunction                   !Comment : Function run by the stage thread                           */
+/*                ptrArgument                   !Comment : Argument of ptrFunction                                    */
+/*                ptrBlocks                     !Comment : Blocks to be filled by the producer                        */
+/*                u32BlocksNb                   !Comment : Number of blocks                                           */
+/*                                              !Range   : [0, PIPELINE_QUEUE_DEPTH]                                  */
+/* !Outputs     : ptrStage                      !Comment : Stage, bStarted TRUE if its thread is running              */
+/*                bLocStatus                    !Comment : FALSE if no thread could be started                        */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bStageStart(LogDecoder_strStageType *ptrStage, LogDecoder_ptrStageFunctionType ptrFunction,
+                               void *ptrArgument, LogDecoder_strBlockType *ptrBlocks, uint32 u32BlocksNb)
+{
+    uint32 u32LocIndex = FALSE;
+
+    ptrStage->strFull.u32Head  = FALSE;
+    ptrStage->strFull.u32Tail  = FALSE;
+    ptrStage->strFull.bWaiting = FALSE;
+    ptrStage->strFree.u32Head  = FALSE;
+    ptrStage->strFree.u32Tail  = FALSE;
+    ptrStage->strFree.bWaiting = FALSE;
+    ptrStage->bStop    = FALSE;
+    ptrStage->bError   = FALSE;
+    ptrStage->bStarted = FALSE;
+    for(u32LocIndex = 0U; u32LocIndex < u32BlocksNb; u32LocIndex++)
+    {
+        (void)LogDecoder_bQueuePush(&ptrStage->strFree, &ptrBlocks[u32LocIndex]);
+    }
+#ifdef PIPELINE_THREADS
+    if(  (mtx_init(&ptrStage->strFull.strMutex, mtx_plain) == thrd_success)
+      && (cnd_init(&ptrStage->strFull.strCondition) == thrd_success)
+      && (mtx_init(&ptrStage->strFree.strMutex, mtx_plain) == thrd_success)
+      && (cnd_init(&ptrStage->strFree.strCondition) == thrd_success) )
+    {
+        ptrStage->bStarted = (boolean)(thrd_create(&ptrStage->strThread, ptrFunction, ptrArgument) == thrd_success);
+    }
+#else
+    (void)ptrFunction;
+    (void)ptrArgument;
+#endif
+
+    return ptrStage->bStarted;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStageJoin                                                                             */
+/* !Description : Wait for the stage function to return, after it was given its last block                            */
+/*                                                                                                                    */
+/* !Inputs      : ptrStage                      !Comment : Started stage                                              */
+/* !Number      : 8                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStageJoin(LogDecoder_strStageType *ptrStage)
+{
+#ifdef PIPELINE_THREADS
+    if(ptrStage->bStarted == TRUE)
+    {
+        (void)thrd_join(ptrStage->strThread, NULL);
+        LogDecoder_vidStageRelease(ptrStage);
+    }
+#endif
+    ptrStage->bStarted = FALSE;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStageRelease                                                                          */
+/* !Description : Release the synchronization objects of the queues, once no thread uses them any more : after the    */
+/*                join, or at the end of a detached stage function                                                    */
+/*                                                                                                                    */
+/* !Inputs      : ptrStage                      !Comment : Stage started and ended                                    */
+/* !Number      : 9                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStageRelease(LogDecoder_strStageType *ptrStage)
+{
+#ifdef PIPELINE_THREADS
+    mtx_destroy(&ptrStage->strFull.strMutex);
+    cnd_destroy(&ptrStage->strFull.strCondition);
+    mtx_destroy(&ptrStage->strFree.strMutex);
+    cnd_destroy(&ptrStage->strFree.strCondition);
+#else
+    (void)ptrStage;
+#endif
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStageStop                                                                             */
+/* !Description : End a stage before the end of its stream. The filled blocks are given back unread, so that a        */
+/*                producer waiting for a free block sees the stop request and returns. A stage function which may     */
+/*                stay blocked in a system call (a read on a pipe which is never closed) is not waited for but        */
+/*                detached : the stage must then live outside the caller, and be released by the last of the two      */
+/*                threads to let it go.                                                                               */
+/*                                                                                                                    */
+/* !Inputs      : ptrStage                      !Comment : Started stage, the decoding thread is its consumer         */
+/*                bWait                         !Comment : TRUE to wait for the stage function to return              */
+/* !Number      : 10                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStageStop(LogDecoder_strStageType *ptrStage, boolean bWait)
+{
+    LogDecoder_strBlockType *ptrLocBlock = NULL;
+
+    ptrStage->bStop = TRUE;
+    while((ptrLocBlock = LogDecoder_ptrQueuePop(&ptrStage->strFull)) != NULL)
+    {
+        LogDecoder_vidQueuePut(&ptrStage->strFree, ptrLocBlock);
+    }
+#ifdef PIPELINE_THREADS
+    if((bWait == FALSE) && (ptrStage->bStarted == TRUE))
+    {
+        (void)thrd_detach(ptrStage->strThread);
+        ptrStage->bStarted = FALSE;
+    }
+#else
+    (void)bWait;
+#endif
+    LogDecoder_vidStageJoin(ptrStage);
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,90 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Pipeline stages. A stage is one thread connected to the decoding thread by two bounded lock-free    */
+/*                single-producer single-consumer queues of blocks : the filled blocks go one way, the emptied        */
+/*                blocks come back the other way, so that reading, decoding and writing overlap in time.              */
+/*                                                                                                                    */
+/*  File        : log_decoder_Pipeline.h                                                                              */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_PIPELINE_H
+#define LOG_DECODER_PIPELINE_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder_Types.h"
+
+/* Without C11 threads or atomics no stage is started, the caller does the work itself                                */
+#if !defined(__STDC_NO_THREADS__) && !defined(__STDC_NO_ATOMICS__)
+#define PIPELINE_THREADS
+#include <threads.h>
+#endif
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/* Blocks of a stage, each queue can hold all of them                                                                 */
+#define PIPELINE_QUEUE_DEPTH            4U
+/* A waiting thread yields this many times, then sleeps until the other thread has pushed or popped a block           */
+#define PIPELINE_SPINS_NUMBER           64U
+
+#ifdef PIPELINE_THREADS
+#define PIPELINE_ATOMIC                 _Atomic
+#else
+#define PIPELINE_ATOMIC
+#endif
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+typedef int (*LogDecoder_ptrStageFunctionType)(void *ptrArgument);
+typedef struct
+{
+    char       *ptrData;
+    size_t      u32Size;            /* Number of bytes of data, 0 for the block which ends the stream         */
+}LogDecoder_strBlockType;
+typedef struct
+{
+    LogDecoder_strBlockType *aptrSlot[PIPELINE_QUEUE_DEPTH];
+    PIPELINE_ATOMIC size_t   u32Head;           /* Next slot to be taken, written by the consumer only        */
+    PIPELINE_ATOMIC size_t   u32Tail;           /* Next slot to be filled, written by the producer only       */
+    PIPELINE_ATOMIC boolean  bWaiting;          /* A thread sleeps until the queue is no longer full or empty */
+#ifdef PIPELINE_THREADS
+    mtx_t                    strMutex;          /* Only taken to sleep and to wake the sleeping thread up     */
+    cnd_t                    strCondition;
+#endif
+}LogDecoder_strQueueType;
+typedef struct
+{
+    LogDecoder_strQueueType  strFull;           /* Filled blocks, from the producer to the consumer           */
+    LogDecoder_strQueueType  strFree;           /* Emptied blocks, given back to the producer                 */
+    PIPELINE_ATOMIC boolean  bStop;             /* Set by the decoding thread to end the stage early          */
+    PIPELINE_ATOMIC boolean  bError;            /* Set by the stage function, e.g. after a failed write       */
+#ifdef PIPELINE_THREADS
+    thrd_t                   strThread;
+#endif
+    boolean                  bStarted;          /* FALSE when the decoding thread does the work of the stage  */
+}LogDecoder_strStageType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+boolean LogDecoder_bQueuePush(LogDecoder_strQueueType *ptrQueue, LogDecoder_strBlockType *ptrBlock);
+LogDecoder_strBlockType *LogDecoder_ptrQueuePop(LogDecoder_strQueueType *ptrQueue);
+void LogDecoder_vidQueuePut(LogDecoder_strQueueType *ptrQueue, LogDecoder_strBlockType *ptrBlock);
+LogDecoder_strBlockType *LogDecoder_ptrQueueGet(LogDecoder_strQueueType *ptrQueue);
+boolean LogDecoder_bStageStart(LogDecoder_strStageType *ptrStage, LogDecoder_ptrStageFunctionType ptrFunction,
+                               void *ptrArgument, LogDecoder_strBlockType *ptrBlocks, uint32 u32BlocksNb);
+void LogDecoder_vidStageJoin(LogDecoder_strStageType *ptrStage);
+void LogDecoder_vidStageRelease(LogDecoder_strStageType *ptrStage);
+void LogDecoder_vidStageStop(LogDecoder_strStageType *ptrStage, boolean bWait);
+
+#endif /* LOG_DECODER_PIPELINE_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
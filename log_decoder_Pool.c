@@ -0,0 +1,488 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Work-stealing thread pool of the batch mode. The jobs (one per input file) are handed out in the    */
+/*                order of their list, the tasks submitted by a running job (the chunks of a large file) go to the    */
+/*                deque of its worker, and the idle workers steal them before they take the next job.                 */
+/*                                                                                                                    */
+/*  File        : log_decoder_Pool.c                                                                                  */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_bDequePush                                                                                          */
+/* 2 / LogDecoder_ptrDequeTake                                                                                        */
+/* 3 / LogDecoder_ptrPoolTake                                                                                         */
+/* 4 / LogDecoder_vidPoolWake                                                                                         */
+/* 5 / LogDecoder_vidPoolExecute                                                                                      */
+/* 6 / LogDecoder_vidPoolLoop                                                                                         */
+/* 7 / LogDecoder_s32PoolWorker                                                                                       */
+/* 8 / LogDecoder_u32PoolProcessors                                                                                   */
+/* 9 / LogDecoder_vidPoolRun                                                                                          */
+/* 10 / LogDecoder_vidPoolSubmit                                                                                      */
+/* 11 / LogDecoder_vidPoolWait                                                                                        */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#define POOL_POSIX_PROCESSORS
+#endif
+
+#include "log_decoder_Pool.h"
+
+#ifdef POOL_POSIX_PROCESSORS
+#include <unistd.h>
+#endif
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+/* A job waiting for its stolen tasks sleeps this long between two checks once it has yielded PIPELINE_SPINS_NUMBER   */
+/* times, the tasks are whole chunks of several milliseconds                                                          */
+#define POOL_WAIT_TIME_NS                50000L
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+#ifdef PIPELINE_THREADS
+/* Index of the worker run by this thread, the thread of LogDecoder_vidPoolRun is worker 0                            */
+static _Thread_local uint32 LogDecoder_u32PoolWorker = 0U;
+/* Workers started so far, each thread takes the next index                                                           */
+static PIPELINE_ATOMIC uint32 LogDecoder_u32PoolStartedNb = 0U;
+#endif
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+#ifdef PIPELINE_THREADS
+static boolean LogDecoder_bDequePush(LogDecoder_strDequeType *ptrDeque, LogDecoder_strTaskType *ptrTask);
+static LogDecoder_strTaskType *LogDecoder_ptrDequeTake(LogDecoder_strDequeType *ptrDeque, boolean bSteal);
+static LogDecoder_strTaskType *LogDecoder_ptrPoolTake(LogDecoder_strPoolType *ptrPool);
+static void LogDecoder_vidPoolWake(LogDecoder_strPoolType *ptrPool);
+#endif
+static void LogDecoder_vidPoolExecute(LogDecoder_strPoolType *ptrPool, LogDecoder_strTaskType *ptrTask);
+static void LogDecoder_vidPoolLoop(LogDecoder_strPoolType *ptrPool);
+#ifdef PIPELINE_THREADS
+static int LogDecoder_s32PoolWorker(void *ptrArgument);
+#endif
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+#ifdef PIPELINE_THREADS
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bDequePush                                                                               */
+/* !Description : Push a task at the bottom of a deque, called by its owner only                                      */
+/*                                                                                                                    */
+/* !Inputs      : ptrDeque                      !Comment : Deque of the calling worker                                */
+/*                ptrTask                       !Comment : Task to be run by the owner or by a thief                  */
+/* !Outputs     : bLocStatus                    !Comment : FALSE if the deque is full                                 */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bDequePush(LogDecoder_strDequeType *ptrDeque, LogDecoder_strTaskType *ptrTask)
+{
+    boolean bLocStatus = FALSE;
+
+    (void)mtx_lock(&ptrDeque->strMutex);
+    if((ptrDeque->u32Bottom - ptrDeque->u32Top) < POOL_DEQUE_SIZE)
+    {
+        ptrDeque->aptrTask[ptrDeque->u32Bottom % POOL_DEQUE_SIZE] = ptrTask;
+        ptrDeque->u32Bottom++;
+        bLocStatus = TRUE;
+    }
+    (void)mtx_unlock(&ptrDeque->strMutex);
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrDequeTake                                                                             */
+/* !Description : Take a task from a deque : the newest one for its owner, whose data is still in the cache, the      */
+/*                oldest one for a thief                                                                              */
+/*                                                                                                                    */
+/* !Inputs      : ptrDeque                      !Comment : Deque                                                      */
+/*                bSteal                        !Comment : TRUE when the caller is not the owner of the deque         */
+/* !Outputs     : ptrLocTask                    !Comment : Task taken, NULL if the deque is empty                     */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static LogDecoder_strTaskType *LogDecoder_ptrDequeTake(LogDecoder_strDequeType *ptrDeque, boolean bSteal)
+{
+    LogDecoder_strTaskType *ptrLocTask = NULL;
+
+    (void)mtx_lock(&ptrDeque->strMutex);
+    if((ptrDeque->u32Bottom != ptrDeque->u32Top) && (bSteal == TRUE))
+    {
+        ptrLocTask = ptrDeque->aptrTask[ptrDeque->u32Top % POOL_DEQUE_SIZE];
+        ptrDeque->u32Top++;
+    }
+    else if(ptrDeque->u32Bottom != ptrDeque->u32Top)
+    {
+        ptrDeque->u32Bottom--;
+        ptrLocTask = ptrDeque->aptrTask[ptrDeque->u32Bottom % POOL_DEQUE_SIZE];
+    }
+    else
+    {
+        /* Empty deque                                                                            */
+    }
+    (void)mtx_unlock(&ptrDeque->strMutex);
+
+    return ptrLocTask;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrPoolTake                                                                              */
+/* !Description : Take a queued task : from the deque of the calling worker first, then from the other deques in      */
+/*                turn starting with the next worker, so that the thieves do not all go to the same deque             */
+/*                                                                                                                    */
+/* !Inputs      : ptrPool                       !Comment : Running pool                                               */
+/* !Outputs     : ptrLocTask                    !Comment : Task taken, NULL if no task is queued                      */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static LogDecoder_strTaskType *LogDecoder_ptrPoolTake(LogDecoder_strPoolType *ptrPool)
+{
+    LogDecoder_strTaskType *ptrLocTask = NULL;
+    uint32 u32LocVictim = LogDecoder_u32PoolWorker;
+    uint32 u32LocIndex = FALSE;
+
+    if(ptrPool->u32QueuedTasks != 0U)
+    {
+        ptrLocTask = LogDecoder_ptrDequeTake(&ptrPool->astrDeque[u32LocVictim], FALSE);
+        for(u32LocIndex = 1U; (u32LocIndex < ptrPool->u32WorkersNb) && (ptrLocTask == NULL); u32LocIndex++)
+        {
+            u32LocVictim = (u32LocVictim + 1U) % ptrPool->u32WorkersNb;
+            ptrLocTask = LogDecoder_ptrDequeTake(&ptrPool->astrDeque[u32LocVictim], TRUE);
+        }
+        if(ptrLocTask != NULL)
+        {
+            ptrPool->u32QueuedTasks--;
+        }
+    }
+
+    return ptrLocTask;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidPoolWake                                                                              */
+/* !Description : Wake the sleeping workers up after a task was queued or the last job is done. The sleeping workers  */
+/*                are counted before they check the queued tasks and the jobs done again, this function checks the    */
+/*                count after their change : one of them sees the change of the other, no wake-up is lost.            */
+/*                                                                                                                    */
+/* !Inputs      : ptrPool                       !Comment : Running pool                                               */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidPoolWake(LogDecoder_strPoolType *ptrPool)
+{
+    if(ptrPool->u32IdleNb != 0U)
+    {
+        (void)mtx_lock(&ptrPool->strMutex);
+        (void)cnd_broadcast(&ptrPool->strCondition);
+        (void)mtx_unlock(&ptrPool->strMutex);
+    }
+}
+#endif
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidPoolExecute                                                                           */
+/* !Description : Run a task or a job, then count it done                                                             */
+/*                                                                                                                    */
+/* !Inputs      : ptrPool                       !Comment : Running pool                                               */
+/*                ptrTask                       !Comment : Task taken from a deque, or job taken from the list        */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidPoolExecute(LogDecoder_strPoolType *ptrPool, LogDecoder_strTaskType *ptrTask)
+{
+    (void)ptrTask->ptrFunction(ptrTask->ptrArgument);
+    if(ptrTask->ptrPending != NULL)
+    {
+        (*ptrTask->ptrPending)--;
+    }
+    else
+    {
+        ptrPool->u32JobsDone++;
+#ifdef PIPELINE_THREADS
+        if(ptrPool->u32JobsDone == ptrPool->u32JobsNb)
+        {
+            LogDecoder_vidPoolWake(ptrPool);
+        }
+#endif
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidPoolLoop                                                                              */
+/* !Description : Run the tasks and the jobs until all the jobs are done. The queued tasks come first, they are the   */
+/*                chunks of a file already started, so that a large file is shared by the idle workers instead of     */
+/*                being the last one to end. A worker with nothing to do sleeps, the last jobs may still queue tasks. */
+/*                                                                                                                    */
+/* !Inputs      : ptrPool                       !Comment : Running pool                                               */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidPoolLoop(LogDecoder_strPoolType *ptrPool)
+{
+    LogDecoder_strTaskType *ptrLocTask = NULL;
+    size_t u32LocJob = FALSE;
+
+    while(ptrPool->u32JobsDone < ptrPool->u32JobsNb)
+    {
+#ifdef PIPELINE_THREADS
+        ptrLocTask = LogDecoder_ptrPoolTake(ptrPool);
+#endif
+        if((ptrLocTask == NULL) && (ptrPool->u32NextJob < ptrPool->u32JobsNb))
+        {
+            u32LocJob = ptrPool->u32NextJob++;
+            if(u32LocJob < ptrPool->u32JobsNb)
+            {
+                ptrLocTask = &ptrPool->ptrJobs[u32LocJob];
+            }
+        }
+        if(ptrLocTask != NULL)
+        {
+            LogDecoder_vidPoolExecute(ptrPool, ptrLocTask);
+            ptrLocTask = NULL;
+        }
+        else
+        {
+#ifdef PIPELINE_THREADS
+            (void)mtx_lock(&ptrPool->strMutex);
+            ptrPool->u32IdleNb++;
+            while((ptrPool->u32QueuedTasks == 0U) && (ptrPool->u32JobsDone < ptrPool->u32JobsNb))
+            {
+                (void)cnd_wait(&ptrPool->strCondition, &ptrPool->strMutex);
+            }
+            ptrPool->u32IdleNb--;
+            (void)mtx_unlock(&ptrPool->strMutex);
+#endif
+        }
+    }
+}
+
+#ifdef PIPELINE_THREADS
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32PoolWorker                                                                            */
+/* !Description : Thread of a worker other than the first one                                                         */
+/*                                                                                                                    */
+/* !Inputs      : ptrArgument                   !Comment : Running pool (LogDecoder_strPoolType)                      */
+/* !Outputs     : s32LocStatus                  !Comment : Thread exit code, always 0                                 */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32PoolWorker(void *ptrArgument)
+{
+    LogDecoder_u32PoolWorker = ++LogDecoder_u32PoolStartedNb;
+    LogDecoder_vidPoolLoop((LogDecoder_strPoolType *)ptrArgument);
+
+    return 0;
+}
+#endif
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32PoolProcessors                                                                        */
+/* !Description : Number of processors online, 1 when it cannot be known                                              */
+/*                                                                                                                    */
+/* !Outputs     : u32LocProcessorsNb            !Comment : Number of workers sized to the machine                     */
+/*                                              !Range   : [1, POOL_MAX_WORKERS]                                      */
+/* !Number      : 8                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint32 LogDecoder_u32PoolProcessors(void)
+{
+    uint32 u32LocProcessorsNb = 1U;
+#if defined(POOL_POSIX_PROCESSORS) && defined(_SC_NPROCESSORS_ONLN)
+    long s32LocOnlineNb = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if(s32LocOnlineNb > (long)POOL_MAX_WORKERS)
+    {
+        u32LocProcessorsNb = POOL_MAX_WORKERS;
+    }
+    else if(s32LocOnlineNb > 1L)
+    {
+        u32LocProcessorsNb = (uint32)s32LocOnlineNb;
+    }
+    else
+    {
+        /* Unknown, or a single processor                                                         */
+    }
+#endif
+
+    return u32LocProcessorsNb;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidPoolRun                                                                               */
+/* !Description : Run all the jobs of the list on the given number of workers and return once they are all done.      */
+/*                The calling thread is the first worker. Without C11 threads, or when no thread can be created,      */
+/*                the jobs run one after the other on the calling thread.                                             */
+/*                                                                                                                    */
+/* !Inputs      : ptrJobs                       !Comment : Jobs, taken in the order of the list                       */
+/*                u32JobsNb                     !Comment : Number of jobs                                             */
+/*                u32WorkersNb                  !Comment : Number of workers                                          */
+/*                                              !Range   : [1, POOL_MAX_WORKERS]                                      */
+/* !Outputs     : ptrPool                       !Comment : Pool, its tasks are run by its workers while it runs       */
+/* !Number      : 9                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidPoolRun(LogDecoder_strPoolType *ptrPool, LogDecoder_strTaskType *ptrJobs, size_t u32JobsNb,
+                           uint32 u32WorkersNb)
+{
+#ifdef PIPELINE_THREADS
+    thrd_t astrLocThread[POOL_MAX_WORKERS];
+    uint32 u32LocStartedNb = FALSE;
+    uint32 u32LocIndex = FALSE;
+    boolean bLocReady = TRUE;
+#endif
+
+    ptrPool->ptrJobs        = ptrJobs;
+    ptrPool->u32JobsNb      = u32JobsNb;
+    ptrPool->u32NextJob     = FALSE;
+    ptrPool->u32JobsDone    = FALSE;
+    ptrPool->u32QueuedTasks = FALSE;
+    ptrPool->u32IdleNb      = FALSE;
+    ptrPool->u32WorkersNb   = 1U;
+#ifdef PIPELINE_THREADS
+    if(u32WorkersNb > POOL_MAX_WORKERS)
+    {
+        u32WorkersNb = POOL_MAX_WORKERS;
+    }
+    bLocReady = (boolean)(  (mtx_init(&ptrPool->strMutex, mtx_plain) == thrd_success)
+                         && (cnd_init(&ptrPool->strCondition) == thrd_success) );
+    for(u32LocIndex = 0U; (u32LocIndex < u32WorkersNb) && (bLocReady == TRUE); u32LocIndex++)
+    {
+        ptrPool->astrDeque[u32LocIndex].u32Top    = FALSE;
+        ptrPool->astrDeque[u32LocIndex].u32Bottom = FALSE;
+        bLocReady = (boolean)(mtx_init(&ptrPool->astrDeque[u32LocIndex].strMutex, mtx_plain) == thrd_success);
+    }
+    if(bLocReady == TRUE)
+    {
+        /* The thieves look at all the deques, also those of the workers which could not start    */
+        ptrPool->u32WorkersNb      = u32WorkersNb;
+        LogDecoder_u32PoolWorker    = 0U;
+        LogDecoder_u32PoolStartedNb = 0U;
+        for(u32LocStartedNb = 0U; (u32LocStartedNb + 1U) < u32WorkersNb; u32LocStartedNb++)
+        {
+            if(thrd_create(&astrLocThread[u32LocStartedNb], LogDecoder_s32PoolWorker, ptrPool) != thrd_success)
+            {
+                break;
+            }
+        }
+    }
+#else
+    (void)u32WorkersNb;
+#endif
+
+    LogDecoder_vidPoolLoop(ptrPool);
+
+#ifdef PIPELINE_THREADS
+    if(bLocReady == TRUE)
+    {
+        for(u32LocIndex = 0U; u32LocIndex < u32LocStartedNb; u32LocIndex++)
+        {
+            (void)thrd_join(astrLocThread[u32LocIndex], NULL);
+        }
+        for(u32LocIndex = 0U; u32LocIndex < u32WorkersNb; u32LocIndex++)
+        {
+            mtx_destroy(&ptrPool->astrDeque[u32LocIndex].strMutex);
+        }
+        mtx_destroy(&ptrPool->strMutex);
+        cnd_destroy(&ptrPool->strCondition);
+    }
+#endif
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidPoolSubmit                                                                            */
+/* !Description : Queue a task of the running job on the deque of its worker, the idle workers steal it. The task     */
+/*                is run at once when the pool has a single worker or the deque is full.                              */
+/*                                                                                                                    */
+/* !Inputs      : ptrPool                       !Comment : Running pool, called from one of its jobs                  */
+/*                ptrTask                       !Comment : Task, its pending counter already counts it                */
+/* !Number      : 10                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidPoolSubmit(LogDecoder_strPoolType *ptrPool, LogDecoder_strTaskType *ptrTask)
+{
+#ifdef PIPELINE_THREADS
+    if(  (ptrPool->u32WorkersNb > 1U)
+      && (LogDecoder_bDequePush(&ptrPool->astrDeque[LogDecoder_u32PoolWorker], ptrTask) == TRUE) )
+    {
+        ptrPool->u32QueuedTasks++;
+        LogDecoder_vidPoolWake(ptrPool);
+    }
+    else
+#endif
+    {
+        LogDecoder_vidPoolExecute(ptrPool, ptrTask);
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidPoolWait                                                                              */
+/* !Description : Wait for the tasks submitted by the running job. The waiting worker runs its own tasks which were   */
+/*                not stolen yet, then helps the other jobs with their queued tasks, and only then yields and         */
+/*                sleeps. A task never waits itself, a task run here cannot delay the job for long.                   */
+/*                                                                                                                    */
+/* !Inputs      : ptrPool                       !Comment : Running pool, called from one of its jobs                  */
+/*                ptrPending                    !Comment : Pending counter of the submitted tasks                     */
+/* !Number      : 11                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidPoolWait(LogDecoder_strPoolType *ptrPool, PIPELINE_ATOMIC size_t *ptrPending)
+{
+#ifdef PIPELINE_THREADS
+    LogDecoder_strTaskType *ptrLocTask = NULL;
+    struct timespec strLocDuration = {0, POOL_WAIT_TIME_NS};
+    uint32 u32LocSpinsNb = FALSE;
+
+    while(*ptrPending != 0U)
+    {
+        ptrLocTask = LogDecoder_ptrPoolTake(ptrPool);
+        if(ptrLocTask != NULL)
+        {
+            LogDecoder_vidPoolExecute(ptrPool, ptrLocTask);
+            u32LocSpinsNb = FALSE;
+        }
+        else if(u32LocSpinsNb < PIPELINE_SPINS_NUMBER)
+        {
+            thrd_yield();
+            u32LocSpinsNb++;
+        }
+        else
+        {
+            (void)thrd_sleep(&strLocDuration, NULL);
+        }
+    }
+#else
+    /* The tasks were run when they were submitted                                                */
+    (void)ptrPool;
+    (void)ptrPending;
+#endif
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
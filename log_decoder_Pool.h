@@ -0,0 +1,77 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Work-stealing thread pool of the batch mode. The jobs (one per input file) are handed out in the    */
+/*                order of their list, the tasks submitted by a running job (the chunks of a large file) go to the    */
+/*                deque of its worker, and the idle workers steal them before they take the next job.                 */
+/*                                                                                                                    */
+/*  File        : log_decoder_Pool.h                                                                                  */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_POOL_H
+#define LOG_DECODER_POOL_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder_Pipeline.h"
+#include "log_decoder_Types.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+#define POOL_MAX_WORKERS                64U
+/* Tasks waiting in the deque of a worker, a job submits at most one task per worker at a time                        */
+#define POOL_DEQUE_SIZE                 POOL_MAX_WORKERS
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+typedef int (*LogDecoder_ptrTaskFunctionType)(void *ptrArgument);
+typedef struct
+{
+    LogDecoder_ptrTaskFunctionType ptrFunction;
+    void                          *ptrArgument;
+    PIPELINE_ATOMIC size_t        *ptrPending;  /* Tasks of its group not yet done, NULL for a job        */
+}LogDecoder_strTaskType;
+typedef struct
+{
+    LogDecoder_strTaskType  *aptrTask[POOL_DEQUE_SIZE];
+    size_t                   u32Top;            /* Oldest task, taken by the thieves                          */
+    size_t                   u32Bottom;         /* Next free slot, the owner pushes and pops here             */
+#ifdef PIPELINE_THREADS
+    mtx_t                    strMutex;
+#endif
+}LogDecoder_strDequeType;
+typedef struct
+{
+    LogDecoder_strDequeType  astrDeque[POOL_MAX_WORKERS];
+    LogDecoder_strTaskType  *ptrJobs;
+    size_t                   u32JobsNb;
+    PIPELINE_ATOMIC size_t   u32NextJob;        /* Next job of the list to be taken                           */
+    PIPELINE_ATOMIC size_t   u32JobsDone;
+    PIPELINE_ATOMIC size_t   u32QueuedTasks;    /* Tasks waiting in the deques                                */
+    PIPELINE_ATOMIC uint32   u32IdleNb;         /* Workers sleeping until a task is queued or all jobs done   */
+#ifdef PIPELINE_THREADS
+    mtx_t                    strMutex;          /* Only taken to sleep and to wake the sleeping workers up    */
+    cnd_t                    strCondition;
+#endif
+    uint32                   u32WorkersNb;
+}LogDecoder_strPoolType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+uint32 LogDecoder_u32PoolProcessors(void);
+void LogDecoder_vidPoolRun(LogDecoder_strPoolType *ptrPool, LogDecoder_strTaskType *ptrJobs, size_t u32JobsNb,
+                           uint32 u32WorkersNb);
+void LogDecoder_vidPoolSubmit(LogDecoder_strPoolType *ptrPool, LogDecoder_strTaskType *ptrTask);
+void LogDecoder_vidPoolWait(LogDecoder_strPoolType *ptrPool, PIPELINE_ATOMIC size_t *ptrPending);
+
+#endif /* LOG_DECODER_POOL_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
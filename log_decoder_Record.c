@@ -0,0 +1,274 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Native binary input. Reads the header and the fixed-size little-endian records of a log converted   */
+/*                with "csv2bin" straight into the input columns of a batch, and writes such a log from the batches   */
+/*                parsed from a .csv log.                                                                             */
+/*                                                                                                                    */
+/*  File        : log_decoder_Record.c                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_u64RecordLoad                                                                                       */
+/* 2 / LogDecoder_vidRecordStore                                                                                      */
+/* 3 / LogDecoder_u8RecordHeader                                                                                      */
+/* 4 / LogDecoder_u8RecordBatch                                                                                       */
+/* 5 / LogDecoder_vidRecordOpen                                                                                       */
+/* 6 / LogDecoder_vidRecordBatch                                                                                      */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder_Parser.h"
+#include "log_decoder_Record.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define BITS_PER_BYTE                    8U
+/* Records formatted on the stack before they are handed to the writer                                                */
+#define RECORD_WRITE_ROWS                256U
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static uint64 LogDecoder_u64RecordLoad(const char *ptrData, uint8 u8Size);
+static void LogDecoder_vidRecordStore(char *ptrData, uint64 u64Value, uint8 u8Size);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u64RecordLoad                                                                            */
+/* !Description : Read a little-endian field of any alignment. With a constant size the compiler turns the loop into  */
+/*                a single load on a little-endian machine.                                                           */
+/*                                                                                                                    */
+/* !Inputs      : ptrData                       !Comment : First byte of the field                                    */
+/*                u8Size                        !Comment : Bytes of the field                                         */
+/*                                              !Range   : [1, 8]                                                     */
+/* !Outputs     : u64LocValue                   !Comment : Value of the field                                         */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint64 LogDecoder_u64RecordLoad(const char *ptrData, uint8 u8Size)
+{
+    const uint8 *ptrLocByte = (const uint8 *)ptrData;
+    uint64 u64LocValue = FALSE;
+    uint8 u8LocIndex = FALSE;
+
+    for(u8LocIndex = 0U; u8LocIndex < u8Size; u8LocIndex++)
+    {
+        u64LocValue |= (uint64)ptrLocByte[u8LocIndex] << (u8LocIndex * BITS_PER_BYTE);
+    }
+
+    return u64LocValue;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidRecordStore                                                                           */
+/* !Description : Write a little-endian field of any alignment                                                        */
+/*                                                                                                                    */
+/* !Inputs      : u64Value                      !Comment : Value of the field, its high bytes beyond u8Size dropped   */
+/*                u8Size                        !Comment : Bytes of the field                                         */
+/*                                              !Range   : [1, 8]                                                     */
+/* !Outputs     : ptrData                       !Comment : First byte of the field                                    */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidRecordStore(char *ptrData, uint64 u64Value, uint8 u8Size)
+{
+    uint8 *ptrLocByte = (uint8 *)ptrData;
+    uint8 u8LocIndex = FALSE;
+
+    for(u8LocIndex = 0U; u8LocIndex < u8Size; u8LocIndex++)
+    {
+        ptrLocByte[u8LocIndex] = (uint8)(u64Value >> (u8LocIndex * BITS_PER_BYTE));
+    }
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8RecordHeader                                                                           */
+/* !Description : Check whether the input starts with the header of a record file and move the cursor after it        */
+/*                                                                                                                    */
+/* !Inputs      : ptrCursor                     !Comment : Start of the input data                                    */
+/*                ptrEnd                        !Comment : End of the available input data                            */
+/*                bLastBlock                    !Comment : TRUE if no more data follows ptrEnd                        */
+/* !Outputs     : ptrCursor                     !Comment : First record, for RECORD_HEADER_OK only                    */
+/*                u8LocStatus                   !Comment : Header check status                                        */
+/*                                              !Range   : RECORD_HEADER_OK,                                          */
+/*                                                         RECORD_HEADER_NONE,                                        */
+/*                                                         RECORD_HEADER_VERSION_ERROR,                               */
+/*                                                         RECORD_HEADER_INCOMPLETE                                   */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8RecordHeader(const char **ptrCursor, const char *ptrEnd, boolean bLastBlock)
+{
+    const char *ptrLocHeader = *ptrCursor;
+    size_t u32LocSize = (size_t)(ptrEnd - ptrLocHeader);
+    uint8 u8LocStatus = RECORD_HEADER_NONE;
+
+    if(  (u32LocSize >= RECORD_MAGIC_LENGTH)
+      && (memcmp(ptrLocHeader, RECORD_MAGIC, RECORD_MAGIC_LENGTH) != 0) )
+    {
+        /* Not a record file, a .csv log never starts with the magic                              */
+    }
+    else if(u32LocSize < RECORD_HEADER_SIZE)
+    {
+        /* The header may continue in the data that is not read yet, else the file is truncated   */
+        u8LocStatus = (bLastBlock == TRUE) ? RECORD_HEADER_NONE : RECORD_HEADER_INCOMPLETE;
+    }
+    else if(  (LogDecoder_u64RecordLoad(&ptrLocHeader[RECORD_HEADER_VERSION], sizeof(uint16)) != RECORD_VERSION)
+           || (LogDecoder_u64RecordLoad(&ptrLocHeader[RECORD_HEADER_RECORD_SIZE], sizeof(uint16)) != RECORD_SIZE)
+           || (LogDecoder_u64RecordLoad(&ptrLocHeader[RECORD_HEADER_HEADER_SIZE], sizeof(uint32p))
+                   != RECORD_HEADER_SIZE) )
+    {
+        u8LocStatus = RECORD_HEADER_VERSION_ERROR;
+    }
+    else
+    {
+        u8LocStatus = RECORD_HEADER_OK;
+        *ptrCursor  = ptrLocHeader + RECORD_HEADER_SIZE;
+    }
+
+    return u8LocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u8RecordBatch                                                                            */
+/* !Description : Copy the records at the cursor into the input columns of a batch, until the batch is full or no     */
+/*                whole record is left. Nothing is tokenized nor converted, every row is copied whatever the          */
+/*                selection, the rows which are not selected being dropped after the validation.                      */
+/*                                                                                                                    */
+/* !Inputs      : ptrCursor                     !Comment : First record to be read                                    */
+/*                ptrEnd                        !Comment : End of the available data                                  */
+/*                bLastBlock                    !Comment : TRUE if no data follows ptrEnd                             */
+/*                ptrBatch                      !Comment : Batch to be filled, possibly not empty                     */
+/* !Outputs     : ptrCursor                     !Comment : First record not read                                      */
+/*                ptrBatch                      !Comment : Batch with the records appended                            */
+/*                u8LocStatus                   !Comment : PARSER_ROW_OK when the batch is full, PARSER_ROW_ERROR     */
+/*                                                         for a truncated last record                                */
+/*                                              !Range   : PARSER_ROW_OK,                                             */
+/*                                                         PARSER_ROW_ERROR,                                          */
+/*                                                         PARSER_ROW_INCOMPLETE,                                     */
+/*                                                         PARSER_END_OF_DATA                                         */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8RecordBatch(const char **ptrCursor, const char *ptrEnd, boolean bLastBlock,
+                               LogDecoder_strBatchType *ptrBatch)
+{
+    const char *ptrLocRecord = *ptrCursor;
+    size_t u32LocRecordsNb = (size_t)(ptrEnd - ptrLocRecord) / RECORD_SIZE;
+    uint32 u32LocIndex = ptrBatch->u32FramesNb;
+    uint32 u32LocLast = FALSE;
+    uint8 u8LocStatus = PARSER_ROW_OK;
+
+    if(u32LocRecordsNb >= (size_t)(ptrBatch->u32Capacity - u32LocIndex))
+    {
+        u32LocLast = ptrBatch->u32Capacity;
+    }
+    else
+    {
+        u32LocLast = u32LocIndex + (uint32)u32LocRecordsNb;
+        if((size_t)(ptrEnd - ptrLocRecord) != (u32LocRecordsNb * RECORD_SIZE))
+        {
+            u8LocStatus = (bLastBlock == TRUE) ? PARSER_ROW_ERROR : PARSER_ROW_INCOMPLETE;
+        }
+        else
+        {
+            u8LocStatus = (bLastBlock == TRUE) ? PARSER_END_OF_DATA : PARSER_ROW_INCOMPLETE;
+        }
+    }
+
+    for(; u32LocIndex < u32LocLast; u32LocIndex++)
+    {
+        ptrBatch->ptrFrameNb[u32LocIndex]   = LogDecoder_u64RecordLoad(&ptrLocRecord[RECORD_FRAME_NB],
+                                                                       sizeof(uint64));
+        ptrBatch->ptrTimestamp[u32LocIndex] = LogDecoder_u64RecordLoad(&ptrLocRecord[RECORD_TIMESTAMP],
+                                                                       sizeof(uint64));
+        ptrBatch->ptrPayload[u32LocIndex]   = (uint32p)LogDecoder_u64RecordLoad(&ptrLocRecord[RECORD_PAYLOAD],
+                                                                                sizeof(uint32p));
+        ptrBatch->ptrId[u32LocIndex]        = (uint8)ptrLocRecord[RECORD_ID];
+        ptrBatch->ptrChecksum[u32LocIndex]  = (uint8)ptrLocRecord[RECORD_CHECKSUM];
+        ptrLocRecord += RECORD_SIZE;
+    }
+    ptrBatch->u32FramesNb = u32LocIndex;
+    *ptrCursor = ptrLocRecord;
+
+    return u8LocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidRecordOpen                                                                            */
+/* !Description : Write the header of a record file                                                                   */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer of the record file                           */
+/* !Outputs     : ptrWriter                     !Comment : Writer with the header                                     */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidRecordOpen(LogDecoder_strWriterType *ptrWriter)
+{
+    char acLocHeader[RECORD_HEADER_SIZE] = {FALSE};
+
+    memcpy(acLocHeader, RECORD_MAGIC, RECORD_MAGIC_LENGTH);
+    LogDecoder_vidRecordStore(&acLocHeader[RECORD_HEADER_VERSION], RECORD_VERSION, sizeof(uint16));
+    LogDecoder_vidRecordStore(&acLocHeader[RECORD_HEADER_RECORD_SIZE], RECORD_SIZE, sizeof(uint16));
+    LogDecoder_vidRecordStore(&acLocHeader[RECORD_HEADER_HEADER_SIZE], RECORD_HEADER_SIZE, sizeof(uint32p));
+    LogDecoder_vidWriterText(ptrWriter, acLocHeader, sizeof(acLocHeader));
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidRecordBatch                                                                           */
+/* !Description : Write the input columns of a parsed batch as records                                                */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Writer of the record file, header already written          */
+/*                ptrBatch                      !Comment : Batch filled by the .csv parser                            */
+/* !Outputs     : ptrWriter                     !Comment : Writer with one record per row of the batch                */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidRecordBatch(LogDecoder_strWriterType *ptrWriter, const LogDecoder_strBatchType *ptrBatch)
+{
+    char    acLocRecords[RECORD_WRITE_ROWS * RECORD_SIZE];
+    char   *ptrLocRecord = acLocRecords;
+    uint32  u32LocIndex = FALSE;
+
+    for(u32LocIndex = 0U; u32LocIndex < ptrBatch->u32FramesNb; u32LocIndex++)
+    {
+        LogDecoder_vidRecordStore(&ptrLocRecord[RECORD_FRAME_NB], ptrBatch->ptrFrameNb[u32LocIndex], sizeof(uint64));
+        LogDecoder_vidRecordStore(&ptrLocRecord[RECORD_TIMESTAMP], ptrBatch->ptrTimestamp[u32LocIndex],
+                                  sizeof(uint64));
+        LogDecoder_vidRecordStore(&ptrLocRecord[RECORD_PAYLOAD], ptrBatch->ptrPayload[u32LocIndex], sizeof(uint32p));
+        ptrLocRecord[RECORD_ID]       = (char)ptrBatch->ptrId[u32LocIndex];
+        ptrLocRecord[RECORD_CHECKSUM] = (char)ptrBatch->ptrChecksum[u32LocIndex];
+        /* Reserved bytes                                                                         */
+        ptrLocRecord[RECORD_CHECKSUM + 1U] = '\0';
+        ptrLocRecord[RECORD_CHECKSUM + 2U] = '\0';
+        ptrLocRecord += RECORD_SIZE;
+        if(ptrLocRecord == &acLocRecords[sizeof(acLocRecords)])
+        {
+            LogDecoder_vidWriterText(ptrWriter, acLocRecords, sizeof(acLocRecords));
+            ptrLocRecord = acLocRecords;
+        }
+    }
+    LogDecoder_vidWriterText(ptrWriter, acLocRecords, (size_t)(ptrLocRecord - acLocRecords));
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,61 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Native binary input. A log converted once with "csv2bin" is a header followed by fixed-size         */
+/*                little-endian records, one per .csv row, which the decoder maps and copies into the input columns   */
+/*                of its batches without tokenizing or converting any text.                                           */
+/*                                                                                                                    */
+/*  File        : log_decoder_Record.h                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_RECORD_H
+#define LOG_DECODER_RECORD_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+#include "log_decoder_Writer.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/*---------------------------------- Format ----------------------------------*/
+/* Every field is little-endian whatever the byte order of the machine which wrote the file                           */
+#define RECORD_MAGIC                    "LDCR"
+#define RECORD_MAGIC_LENGTH             4U
+#define RECORD_VERSION                  1U
+/* Header : magic, u16 version, u16 record size, u32 header size, u32 reserved                                        */
+#define RECORD_HEADER_SIZE              16U
+#define RECORD_HEADER_VERSION           4U
+#define RECORD_HEADER_RECORD_SIZE       6U
+#define RECORD_HEADER_HEADER_SIZE       8U
+/* Record : u64 FrameNb, u64 Timestamp, u32 Payload, u8 ID, u8 Checksum, u16 reserved, 8-byte aligned in the file     */
+#define RECORD_SIZE                     24U
+#define RECORD_FRAME_NB                 0U
+#define RECORD_TIMESTAMP                8U
+#define RECORD_PAYLOAD                  16U
+#define RECORD_ID                       20U
+#define RECORD_CHECKSUM                 21U
+/*------------------------------- Header status ------------------------------*/
+#define RECORD_HEADER_OK                0U
+#define RECORD_HEADER_NONE              1U      /* Not a record file, e.g. a .csv log                       */
+#define RECORD_HEADER_VERSION_ERROR     2U
+#define RECORD_HEADER_INCOMPLETE        3U
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+uint8 LogDecoder_u8RecordHeader(const char **ptrCursor, const char *ptrEnd, boolean bLastBlock);
+uint8 LogDecoder_u8RecordBatch(const char **ptrCursor, const char *ptrEnd, boolean bLastBlock,
+                               LogDecoder_strBatchType *ptrBatch);
+void LogDecoder_vidRecordOpen(LogDecoder_strWriterType *ptrWriter);
+void LogDecoder_vidRecordBatch(LogDecoder_strWriterType *ptrWriter, const LogDecoder_strBatchType *ptrBatch);
+
+#endif /* LOG_DECODER_RECORD_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,272 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Bounded reorder window. Each frame ID has a small min-heap of held frames keyed by FrameNb, a frame */
+/*                leaves it once a frame of its ID newer by the window has been received, or when the heap is full.   */
+/*                                                                                                                    */
+/*  File        : log_decoder_Reorder.c                                                                               */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_bReorderBefore                                                                                      */
+/* 2 / LogDecoder_vidReorderRelease                                                                                   */
+/* 3 / LogDecoder_bReorderOpen                                                                                        */
+/* 4 / LogDecoder_ptrReorderBatch                                                                                     */
+/* 5 / LogDecoder_vidReorderClose                                                                                     */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include <stdlib.h>
+#include "log_decoder_Reorder.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define MASK_16BITS                      0xFFFFUL
+/* Half period of a 16-bit counter : a forward distance beyond it is a backward one                                   */
+#define HALF_16BITS                      0x8000UL
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bReorderBefore(const LogDecoder_strReorderType *ptrReorder, uint64 u64Counter,
+                                         uint64 u64Other);
+static void LogDecoder_vidReorderRelease(const LogDecoder_strReorderType *ptrReorder, uint8 u8Id,
+                                         LogDecoder_strBatchType *ptrOutput);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bReorderBefore                                                                           */
+/* !Description : Order of two counters (FrameNb or Timestamp). With "--wrap16" the counters are compared by their    */
+/*                distance modulo 2^16, the held frames of an ID being much closer than half a period.                */
+/*                                                                                                                    */
+/* !Inputs      : ptrReorder                    !Comment : Reorder window                                             */
+/*                u64Counter                    !Comment : Counter to be compared                                     */
+/*                u64Other                      !Comment : Counter it is compared to                                  */
+/* !Outputs     : bLocBefore                    !Comment : TRUE if u64Counter comes before u64Other                   */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bReorderBefore(const LogDecoder_strReorderType *ptrReorder, uint64 u64Counter,
+                                         uint64 u64Other)
+{
+    if(ptrReorder->bWrap16 == TRUE)
+    {
+        return (boolean)(((u64Counter - u64Other) & MASK_16BITS) >= HALF_16BITS);
+    }
+
+    return (boolean)(u64Counter < u64Other);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidReorderRelease                                                                        */
+/* !Description : Release the held frame of the smallest FrameNb of an ID to the output batch                         */
+/*                                                                                                                    */
+/* !Inputs      : ptrReorder                    !Comment : Reorder window                                             */
+/*                u8Id                          !Comment : Frame ID, with at least one held frame                     */
+/* !Outputs     : ptrOutput                     !Comment : Batch, the frame is added after u32FramesNb                */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidReorderRelease(const LogDecoder_strReorderType *ptrReorder, uint8 u8Id,
+                                         LogDecoder_strBatchType *ptrOutput)
+{
+    LogDecoder_strReorderIdType *ptrLocId = &ptrReorder->ptrIds[u8Id];
+    LogDecoder_strReorderFrameType *ptrLocHeap = ptrLocId->astrFrame;
+    LogDecoder_strReorderFrameType strLocLast;
+    uint32 u32LocIndex = ptrOutput->u32FramesNb;
+    uint32 u32LocPosition = FALSE;
+    uint32 u32LocChild = FALSE;
+
+    ptrOutput->ptrId[u32LocIndex]        = u8Id;
+    ptrOutput->ptrFrameNb[u32LocIndex]   = ptrLocHeap[0].u64FrameNb;
+    ptrOutput->ptrTimestamp[u32LocIndex] = ptrLocHeap[0].u64Timestamp;
+    ptrOutput->ptrPayload[u32LocIndex]   = ptrLocHeap[0].u32Payload;
+    ptrOutput->ptrChecksum[u32LocIndex]  = ptrLocHeap[0].u8Checksum;
+    ptrOutput->ptrSource[u32LocIndex]    = ptrLocHeap[0].u16Source;
+    ptrOutput->u32FramesNb++;
+
+    /* The last frame of the heap moves down from the top to its place                            */
+    ptrLocId->u32FramesNb--;
+    strLocLast = ptrLocHeap[ptrLocId->u32FramesNb];
+    while((u32LocChild = (2U * u32LocPosition) + 1U) < ptrLocId->u32FramesNb)
+    {
+        if(  ((u32LocChild + 1U) < ptrLocId->u32FramesNb)
+          && (LogDecoder_bReorderBefore(ptrReorder, ptrLocHeap[u32LocChild + 1U].u64FrameNb,
+                                        ptrLocHeap[u32LocChild].u64FrameNb) == TRUE) )
+        {
+            u32LocChild++;
+        }
+        if(LogDecoder_bReorderBefore(ptrReorder, ptrLocHeap[u32LocChild].u64FrameNb, strLocLast.u64FrameNb) == FALSE)
+        {
+            break;
+        }
+        ptrLocHeap[u32LocPosition] = ptrLocHeap[u32LocChild];
+        u32LocPosition = u32LocChild;
+    }
+    ptrLocHeap[u32LocPosition] = strLocLast;
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bReorderOpen                                                                             */
+/* !Description : Allocate the held frames of every frame ID and the batch of the released frames                     */
+/*                                                                                                                    */
+/* !Inputs      : u32Capacity                   !Comment : Capacity of the input batches                              */
+/*                u32WindowMs                   !Comment : Time a frame is held at most, in Timestamp ms              */
+/*                                              !Range   : [0, REORDER_MAX_WINDOW_MS]                                 */
+/*                bWrap16                       !Comment : TRUE if the counters are 16-bit counters which wrap        */
+/* !Outputs     : ptrReorder                    !Comment : Empty reorder window                                       */
+/*                bLocStatus                    !Comment : FALSE without memory                                       */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bReorderOpen(LogDecoder_strReorderType *ptrReorder, uint32 u32Capacity, uint32 u32WindowMs,
+                                boolean bWrap16)
+{
+    ptrReorder->ptrIds      = calloc(FRAME_IDS_NUMBER, sizeof(LogDecoder_strReorderIdType));
+    ptrReorder->u32WindowMs = u32WindowMs;
+    ptrReorder->bWrap16     = bWrap16;
+    if(ptrReorder->ptrIds == NULL)
+    {
+        return FALSE;
+    }
+    if(LogDecoder_bBatchOpen(&ptrReorder->strOutput, u32Capacity + REORDER_PENDING_MAX) == FALSE)
+    {
+        free(ptrReorder->ptrIds);
+        ptrReorder->ptrIds = NULL;
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_ptrReorderBatch                                                                          */
+/* !Description : Reorder stage of a batch : every frame of the input batch is held with the frames of its ID, and    */
+/*                the held frames whose window has passed are released to the output batch in FrameNb order. A        */
+/*                frame is held for u32WindowMs of the Timestamps of its ID at most, and never behind more than       */
+/*                REORDER_FRAMES_NUMBER frames of its ID. A frame later than that is still released, after the        */
+/*                frames of greater FrameNb. With the last rows of the input all the held frames are released, ID     */
+/*                after ID.                                                                                           */
+/*                                                                                                                    */
+/* !Inputs      : ptrReorder                    !Comment : Reorder window                                             */
+/*                ptrInput                      !Comment : Batch with its input columns filled                        */
+/*                bLast                         !Comment : TRUE if no rows follow the batch                           */
+/* !Outputs     : ptrLocOutput                  !Comment : Batch of the released frames, input columns only           */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+LogDecoder_strBatchType *LogDecoder_ptrReorderBatch(LogDecoder_strReorderType *ptrReorder,
+                                                    const LogDecoder_strBatchType *ptrInput, boolean bLast)
+{
+    LogDecoder_strBatchType *ptrLocOutput = &ptrReorder->strOutput;
+    LogDecoder_strReorderIdType *ptrLocId = NULL;
+    LogDecoder_strReorderFrameType *ptrLocHeap = NULL;
+    LogDecoder_strReorderFrameType strLocFrame;
+    uint32 u32LocIndex = FALSE;
+    uint32 u32LocPosition = FALSE;
+    uint32 u32LocParent = FALSE;
+    uint64 u64LocElapsed = FALSE;
+    uint8  u8LocId = FALSE;
+
+    ptrLocOutput->u32FramesNb = FALSE;
+    for(u32LocIndex = 0U; u32LocIndex < ptrInput->u32FramesNb; u32LocIndex++)
+    {
+        u8LocId    = ptrInput->ptrId[u32LocIndex];
+        ptrLocId   = &ptrReorder->ptrIds[u8LocId];
+        ptrLocHeap = ptrLocId->astrFrame;
+        strLocFrame.u64FrameNb   = ptrInput->ptrFrameNb[u32LocIndex];
+        strLocFrame.u64Timestamp = ptrInput->ptrTimestamp[u32LocIndex];
+        strLocFrame.u32Payload   = ptrInput->ptrPayload[u32LocIndex];
+        strLocFrame.u8Checksum   = ptrInput->ptrChecksum[u32LocIndex];
+        strLocFrame.u16Source    = ptrInput->ptrSource[u32LocIndex];
+
+        if(ptrLocId->u32FramesNb == REORDER_FRAMES_NUMBER)
+        {
+            LogDecoder_vidReorderRelease(ptrReorder, u8LocId, ptrLocOutput);
+        }
+        if(  (ptrLocId->bStarted == FALSE)
+          || (LogDecoder_bReorderBefore(ptrReorder, ptrLocId->u64Newest, strLocFrame.u64Timestamp) == TRUE) )
+        {
+            ptrLocId->u64Newest = strLocFrame.u64Timestamp;
+            ptrLocId->bStarted  = TRUE;
+        }
+
+        /* The frame moves up from the bottom of the heap to its place                            */
+        u32LocPosition = ptrLocId->u32FramesNb;
+        while(u32LocPosition > 0U)
+        {
+            u32LocParent = (u32LocPosition - 1U) / 2U;
+            if(LogDecoder_bReorderBefore(ptrReorder, strLocFrame.u64FrameNb,
+                                         ptrLocHeap[u32LocParent].u64FrameNb) == FALSE)
+            {
+                break;
+            }
+            ptrLocHeap[u32LocPosition] = ptrLocHeap[u32LocParent];
+            u32LocPosition = u32LocParent;
+        }
+        ptrLocHeap[u32LocPosition] = strLocFrame;
+        ptrLocId->u32FramesNb++;
+
+        /* Release the frames of the ID sent long enough before the newest one                    */
+        while(ptrLocId->u32FramesNb != 0U)
+        {
+            u64LocElapsed = ptrLocId->u64Newest - ptrLocHeap[0].u64Timestamp;
+            if(ptrReorder->bWrap16 == TRUE)
+            {
+                u64LocElapsed &= MASK_16BITS;
+            }
+            if(u64LocElapsed < ptrReorder->u32WindowMs)
+            {
+                break;
+            }
+            LogDecoder_vidReorderRelease(ptrReorder, u8LocId, ptrLocOutput);
+        }
+    }
+
+    for(u32LocIndex = 0U; (bLast == TRUE) && (u32LocIndex < FRAME_IDS_NUMBER); u32LocIndex++)
+    {
+        while(ptrReorder->ptrIds[u32LocIndex].u32FramesNb != 0U)
+        {
+            LogDecoder_vidReorderRelease(ptrReorder, (uint8)u32LocIndex, ptrLocOutput);
+        }
+    }
+
+    return ptrLocOutput;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidReorderClose                                                                          */
+/* !Description : Release the memory of a reorder window, the frames still held are dropped                           */
+/*                                                                                                                    */
+/* !Inputs      : ptrReorder                    !Comment : Reorder window to be closed                                */
+/* !Outputs     : ptrReorder                    !Comment : Closed reorder window                                      */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidReorderClose(LogDecoder_strReorderType *ptrReorder)
+{
+    free(ptrReorder->ptrIds);
+    ptrReorder->ptrIds = NULL;
+    LogDecoder_vidBatchClose(&ptrReorder->strOutput);
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,71 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Bounded reorder window, between the parse and the validate stages. The frames of each ID are held   */
+/*                for a few milliseconds and released in FrameNb order, so that frames which reached the logger       */
+/*                slightly out of order are tracked in their sending order (drops and timeouts).                      */
+/*                                                                                                                    */
+/*  File        : log_decoder_Reorder.h                                                                               */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_REORDER_H
+#define LOG_DECODER_REORDER_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+#include "log_decoder_Batch.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/* Frames held per frame ID, the frame of the smallest FrameNb is released early when they are all in use             */
+#define REORDER_FRAMES_NUMBER           64U
+/* Frames held at most, the output batch takes that many frames more than an input batch                              */
+#define REORDER_PENDING_MAX             (FRAME_IDS_NUMBER * REORDER_FRAMES_NUMBER)
+/* Largest window (ms), well below the 16-bit counters period with "--wrap16"                                         */
+#define REORDER_MAX_WINDOW_MS           10000U
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+typedef struct
+{
+    uint64  u64FrameNb;
+    uint64  u64Timestamp;
+    uint32p u32Payload;
+    uint16  u16Source;
+    uint8   u8Checksum;
+}LogDecoder_strReorderFrameType;
+typedef struct
+{
+    LogDecoder_strReorderFrameType astrFrame[REORDER_FRAMES_NUMBER];    /* Min-heap by FrameNb            */
+    uint64  u64Newest;              /* Newest Timestamp received for the ID                                   */
+    uint32  u32FramesNb;
+    boolean bStarted;               /* FALSE until the first frame of the ID                                  */
+}LogDecoder_strReorderIdType;
+typedef struct
+{
+    LogDecoder_strReorderIdType *ptrIds;    /* FRAME_IDS_NUMBER entries                                       */
+    LogDecoder_strBatchType      strOutput; /* Released frames, handed to the validate stage                  */
+    uint32  u32WindowMs;            /* A frame is released once a frame this much newer of its ID is received */
+    boolean bWrap16;                /* FrameNb and Timestamp are 16-bit counters which wrap                   */
+}LogDecoder_strReorderType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+boolean LogDecoder_bReorderOpen(LogDecoder_strReorderType *ptrReorder, uint32 u32Capacity, uint32 u32WindowMs,
+                                boolean bWrap16);
+LogDecoder_strBatchType *LogDecoder_ptrReorderBatch(LogDecoder_strReorderType *ptrReorder,
+                                                    const LogDecoder_strBatchType *ptrInput, boolean bLast);
+void LogDecoder_vidReorderClose(LogDecoder_strReorderType *ptrReorder);
+
+#endif /* LOG_DECODER_REORDER_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,349 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Frame definitions schema. A small DBC-like text file describes the layout, scale, cycle time        */
+/*                and tolerance of every frame ID. It is loaded once at startup into a registry of decode ops,        */
+/*                or compiled into a C header holding the registry of a fixed production schema.                      */
+/*                                                                                                                    */
+/*                Schema syntax (one statement per line, '#' starts a comment) :                                      */
+/*                FRAME  <ID> <CycleTime ms> <CycleMargin ms>                                                         */
+/*                SIGNAL <Column> <BitOffset> <BitWidth> <signed|unsigned> <Offset> <Divisor>                         */
+/*                Every SIGNAL belongs to the last FRAME, its value is (raw + Offset) / Divisor. The Divisor must     */
+/*                divide DECODED_VALUE_SCALE so that the value is an exact fixed-point integer.                       */
+/*                                                                                                                    */
+/*  File        : log_decoder_Schema.c                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_bSchemaParseFrame                                                                                   */
+/* 2 / LogDecoder_bSchemaParseSignal                                                                                  */
+/* 3 / LogDecoder_bSchemaParseLine                                                                                    */
+/* 4 / LogDecoder_bSchemaLoad                                                                                         */
+/* 5 / LogDecoder_bSchemaEmit                                                                                         */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder_Schema.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define PAYLOAD_BITS_NUMBER              32U
+#define MAX_CYCLE_TIME                   65535UL
+#define SINT32_MIN_VALUE                 (-2147483647LL - 1LL)
+#define SINT32_MAX_VALUE                 2147483647LL
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+/* Column names of the schema, in the order of the DECODED_xxx indexes (same names as the output header)              */
+static const char * const LogDecoder_aptrColumnName[DECODED_COLUMNS_NUMBER] =
+{
+    [DECODED_POSITION_X] = "PositionX",
+    [DECODED_POSITION_Y] = "PositionY",
+    [DECODED_VELOCITY_X] = "VelocityX",
+    [DECODED_VELOCITY_Y] = "VelocityY"
+};
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bSchemaParseFrame(const char *ptrLine, LogDecoder_strRegistryType *ptrRegistry,
+                                            LogDecoder_strFrameDefType **ptrFrame);
+static boolean LogDecoder_bSchemaParseSignal(const char *ptrLine, LogDecoder_strFrameDefType *ptrFrame);
+static boolean LogDecoder_bSchemaParseLine(const char *ptrLine, LogDecoder_strRegistryType *ptrRegistry,
+                                           LogDecoder_strFrameDefType **ptrFrame);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bSchemaParseFrame                                                                        */
+/* !Description : Parse a FRAME statement and define the frame ID in the registry                                     */
+/*                                                                                                                    */
+/* !Inputs      : ptrLine                       !Comment : Schema line, starting with the FRAME keyword               */
+/*                ptrRegistry                   !Comment : Registry being loaded                                      */
+/* !Outputs     : ptrFrame                      !Comment : Frame receiving the next SIGNAL statements                 */
+/*                bLocStatus                    !Comment : FALSE if the statement is not valid                        */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bSchemaParseFrame(const char *ptrLine, LogDecoder_strRegistryType *ptrRegistry,
+                                            LogDecoder_strFrameDefType **ptrFrame)
+{
+    boolean bLocStatus = FALSE;
+    uint32 u32LocId = FALSE;
+    uint32 u32LocCycleTime = FALSE;
+    uint32 u32LocCycleMargin = FALSE;
+    int s32LocConsumed = FALSE;
+
+    if(  (sscanf(ptrLine, " " SCHEMA_KEYWORD_FRAME " %lu %lu %lu %n",
+                 &u32LocId, &u32LocCycleTime, &u32LocCycleMargin, &s32LocConsumed) == 3)
+      && (ptrLine[s32LocConsumed] == '\0')
+      && (u32LocId < FRAME_IDS_NUMBER) && (ptrRegistry->astrFrame[u32LocId].bDefined == FALSE)
+      && (u32LocCycleTime <= MAX_CYCLE_TIME) && (u32LocCycleMargin <= u32LocCycleTime) )
+    {
+        *ptrFrame = &ptrRegistry->astrFrame[u32LocId];
+        (*ptrFrame)->u16CycleTime   = (uint16)u32LocCycleTime;
+        (*ptrFrame)->u16CycleMargin = (uint16)u32LocCycleMargin;
+        (*ptrFrame)->bDefined       = TRUE;
+        bLocStatus = TRUE;
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bSchemaParseSignal                                                                       */
+/* !Description : Parse a SIGNAL statement, add the signal to the current frame and compile its decode op             */
+/*                                                                                                                    */
+/* !Inputs      : ptrLine                       !Comment : Schema line, starting with the SIGNAL keyword              */
+/*                ptrFrame                      !Comment : Current frame, NULL before the first FRAME                 */
+/* !Outputs     : bLocStatus                    !Comment : FALSE if the statement is not valid                        */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bSchemaParseSignal(const char *ptrLine, LogDecoder_strFrameDefType *ptrFrame)
+{
+    boolean bLocStatus = FALSE;
+    LogDecoder_strSignalDefType *ptrLocSignal = NULL;
+    char sLocColumn[SCHEMA_NAME_MAX_LENGTH] = {FALSE};
+    char sLocSign[SCHEMA_NAME_MAX_LENGTH] = {FALSE};
+    uint32 u32LocBitOffset = FALSE;
+    uint32 u32LocBitWidth = FALSE;
+    uint32 u32LocDivisor = FALSE;
+    uint32 u32LocColumn = FALSE;
+    sint32 s32LocOffset = FALSE;
+    sint64 s64LocMin = FALSE;
+    sint64 s64LocMax = FALSE;
+    int s32LocConsumed = FALSE;
+
+    /* The %31s width follows SCHEMA_NAME_MAX_LENGTH                                              */
+    if(  (ptrFrame != NULL) && (ptrFrame->u8SignalsNb < FRAME_SIGNALS_MAX_NUMBER)
+      && (sscanf(ptrLine, " " SCHEMA_KEYWORD_SIGNAL " %31s %lu %lu %31s %ld %lu %n", sLocColumn,
+                 &u32LocBitOffset, &u32LocBitWidth, sLocSign, &s32LocOffset, &u32LocDivisor, &s32LocConsumed) == 6)
+      && (ptrLine[s32LocConsumed] == '\0')
+      && (u32LocBitWidth > 0U) && (u32LocBitOffset < PAYLOAD_BITS_NUMBER)
+      && (u32LocBitWidth <= (PAYLOAD_BITS_NUMBER - u32LocBitOffset))
+      && (u32LocDivisor > 0U) && ((DECODED_VALUE_SCALE % (sint32)u32LocDivisor) == 0)
+      && ((strcmp(sLocSign, SCHEMA_KEYWORD_SIGNED) == 0) || (strcmp(sLocSign, SCHEMA_KEYWORD_UNSIGNED) == 0)) )
+    {
+        /* Look for the output column of the signal                                               */
+        for(u32LocColumn = 0U; u32LocColumn < DECODED_COLUMNS_NUMBER; u32LocColumn++)
+        {
+            if(strcmp(sLocColumn, LogDecoder_aptrColumnName[u32LocColumn]) == 0)
+            {
+                break;
+            }
+        }
+
+        if(u32LocColumn < DECODED_COLUMNS_NUMBER)
+        {
+            ptrLocSignal = &ptrFrame->astrSignal[ptrFrame->u8SignalsNb];
+            ptrLocSignal->u8BitOffset = (uint8)u32LocBitOffset;
+            ptrLocSignal->u8BitWidth  = (uint8)u32LocBitWidth;
+            ptrLocSignal->u8Column    = (uint8)u32LocColumn;
+            ptrLocSignal->bSigned     = (boolean)(strcmp(sLocSign, SCHEMA_KEYWORD_SIGNED) == 0);
+            ptrLocSignal->s32Offset   = s32LocOffset;
+            ptrLocSignal->u16Divisor  = (uint16)u32LocDivisor;
+            LogDecoder_vidSignalCompile(ptrLocSignal);
+
+            /* The fixed-point value of every raw value of the signal must fit the decoded value  */
+            s64LocMin = -(sint64)ptrLocSignal->u32SignBit;
+            s64LocMax = (sint64)(ptrLocSignal->u32Mask >> (uint8)ptrLocSignal->bSigned);
+            s64LocMin = (s64LocMin + s32LocOffset) * ptrLocSignal->s32Scale;
+            s64LocMax = (s64LocMax + s32LocOffset) * ptrLocSignal->s32Scale;
+            if((s64LocMin >= SINT32_MIN_VALUE) && (s64LocMax <= SINT32_MAX_VALUE))
+            {
+                ptrFrame->u8SignalsNb++;
+                bLocStatus = TRUE;
+            }
+        }
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bSchemaParseLine                                                                         */
+/* !Description : Parse one line of the schema file                                                                   */
+/*                                                                                                                    */
+/* !Inputs      : ptrLine                       !Comment : Schema line, without its line break                        */
+/*                ptrRegistry                   !Comment : Registry being loaded                                      */
+/*                ptrFrame                      !Comment : Current frame, NULL before the first FRAME                 */
+/* !Outputs     : ptrFrame                      !Comment : Current frame after this line                              */
+/*                bLocStatus                    !Comment : FALSE if the line is not valid                             */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bSchemaParseLine(const char *ptrLine, LogDecoder_strRegistryType *ptrRegistry,
+                                           LogDecoder_strFrameDefType **ptrFrame)
+{
+    boolean bLocStatus = FALSE;
+    char sLocKeyword[SCHEMA_NAME_MAX_LENGTH] = {FALSE};
+
+    if((sscanf(ptrLine, "%31s", sLocKeyword) != 1) || (sLocKeyword[0] == SCHEMA_COMMENT))
+    {
+        /* Empty line or comment                                                                  */
+        bLocStatus = TRUE;
+    }
+    else if(strcmp(sLocKeyword, SCHEMA_KEYWORD_FRAME) == 0)
+    {
+        bLocStatus = LogDecoder_bSchemaParseFrame(ptrLine, ptrRegistry, ptrFrame);
+    }
+    else if(strcmp(sLocKeyword, SCHEMA_KEYWORD_SIGNAL) == 0)
+    {
+        bLocStatus = LogDecoder_bSchemaParseSignal(ptrLine, *ptrFrame);
+    }
+    else
+    {
+        /* Unknown statement                                                                      */
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bSchemaLoad                                                                              */
+/* !Description : Load the frame definitions of a schema file into a registry, every frame ID which is not            */
+/*                described by the schema is an invalid frame ID                                                      */
+/*                                                                                                                    */
+/* !Inputs      : ptrPath                       !Comment : Path of the schema file                                    */
+/* !Outputs     : ptrRegistry                   !Comment : Loaded frame definitions                                   */
+/*                ptrErrorLine                  !Comment : Number of the first invalid line, 0 if the file            */
+/*                                                         cannot be read or if the schema is valid                   */
+/*                bLocStatus                    !Comment : TRUE if the whole schema is valid                          */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bSchemaLoad(const char *ptrPath, LogDecoder_strRegistryType *ptrRegistry, uint32 *ptrErrorLine)
+{
+    FILE *ptrLocFile = fopen(ptrPath, "r");
+    LogDecoder_strFrameDefType *ptrLocFrame = NULL;
+    char sLocLine[SCHEMA_LINE_MAX_LENGTH];
+    char *ptrLocLineEnd = NULL;
+    boolean bLocStatus = (boolean)(ptrLocFile != NULL);
+
+    memset(ptrRegistry, 0, sizeof(*ptrRegistry));
+    *ptrErrorLine = FALSE;
+
+    while((bLocStatus == TRUE) && (fgets(sLocLine, (int)sizeof(sLocLine), ptrLocFile) != NULL))
+    {
+        (*ptrErrorLine)++;
+        ptrLocLineEnd = strchr(sLocLine, '\n');
+        if(ptrLocLineEnd != NULL)
+        {
+            *ptrLocLineEnd = '\0';
+        }
+        else if(feof(ptrLocFile) == 0)
+        {
+            /* Line longer than SCHEMA_LINE_MAX_LENGTH                                            */
+            bLocStatus = FALSE;
+            break;
+        }
+        else
+        {
+            /* Last line without line break                                                       */
+        }
+        bLocStatus = LogDecoder_bSchemaParseLine(sLocLine, ptrRegistry, &ptrLocFrame);
+    }
+
+    if(ptrLocFile != NULL)
+    {
+        fclose(ptrLocFile);
+    }
+    if(bLocStatus == TRUE)
+    {
+        *ptrErrorLine = FALSE;
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bSchemaEmit                                                                              */
+/* !Description : Write the registry as a C header, a constant registry with its decode ops already computed. The     */
+/*                header is used by building the decoder with -DLOG_DECODER_SCHEMA_HEADER='"<header>"', the compiled */
+/*                schema becomes the default registry, decoded by the same batch kernels as a loaded schema.          */
+/*                                                                                                                    */
+/* !Inputs      : ptrRegistry                   !Comment : Frame definitions to be compiled                           */
+/*                ptrPath                       !Comment : Path of the generated header                               */
+/* !Outputs     : bLocStatus                    !Comment : TRUE if the header is written                              */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bSchemaEmit(const LogDecoder_strRegistryType *ptrRegistry, const char *ptrPath)
+{
+    FILE *ptrLocFile = fopen(ptrPath, "w");
+    const LogDecoder_strFrameDefType *ptrLocFrame = NULL;
+    const LogDecoder_strSignalDefType *ptrLocSignal = NULL;
+    uint32 u32LocId = FALSE;
+    uint32 u32LocIndex = FALSE;
+    boolean bLocStatus = FALSE;
+
+    if(ptrLocFile == NULL)
+    {
+        return FALSE;
+    }
+
+    fprintf(ptrLocFile,
+        "/* Generated by log_decoder --compile-schema, do not edit */\n"
+        "#ifndef LOG_DECODER_SCHEMA_GENERATED_H\n"
+        "#define LOG_DECODER_SCHEMA_GENERATED_H\n\n"
+        "static const LogDecoder_strRegistryType LogDecoder_strSchemaRegistry =\n{\n    .astrFrame =\n    {\n");
+    for(u32LocId = 0U; u32LocId < FRAME_IDS_NUMBER; u32LocId++)
+    {
+        ptrLocFrame = &ptrRegistry->astrFrame[u32LocId];
+        if(ptrLocFrame->bDefined == TRUE)
+        {
+            fprintf(ptrLocFile, "        [%luU] =\n        {\n            .astrSignal =\n            {\n", u32LocId);
+            for(u32LocIndex = 0U; u32LocIndex < ptrLocFrame->u8SignalsNb; u32LocIndex++)
+            {
+                ptrLocSignal = &ptrLocFrame->astrSignal[u32LocIndex];
+                fprintf(ptrLocFile,
+                    "                { .u8BitOffset = %uU, .u8BitWidth = %uU, .bSigned = %uU, .u8Column = %uU,\n"
+                    "                  .s32Offset = %ldL, .u16Divisor = %uU,\n"
+                    "                  .u32Mask = 0x%lXUL, .u32SignBit = 0x%lXUL, .s32Scale = %ldL },\n",
+                    ptrLocSignal->u8BitOffset, ptrLocSignal->u8BitWidth, ptrLocSignal->bSigned,
+                    ptrLocSignal->u8Column, ptrLocSignal->s32Offset, ptrLocSignal->u16Divisor,
+                    ptrLocSignal->u32Mask, ptrLocSignal->u32SignBit, ptrLocSignal->s32Scale);
+            }
+            fprintf(ptrLocFile,
+                "            },\n"
+                "            .u16CycleTime = %uU, .u16CycleMargin = %uU, .u8SignalsNb = %uU, .bDefined = 1U\n"
+                "        },\n",
+                ptrLocFrame->u16CycleTime, ptrLocFrame->u16CycleMargin, ptrLocFrame->u8SignalsNb);
+        }
+    }
+    fprintf(ptrLocFile, "    }\n};\n\n#endif /* LOG_DECODER_SCHEMA_GENERATED_H */\n");
+
+    bLocStatus = (boolean)(ferror(ptrLocFile) == 0);
+    if(fclose(ptrLocFile) != 0)
+    {
+        bLocStatus = FALSE;
+    }
+
+    return bLocStatus;
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
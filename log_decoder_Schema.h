@@ -0,0 +1,43 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Frame definitions schema. A small DBC-like text file describes the layout, scale, cycle time        */
+/*                and tolerance of every frame ID. It is loaded once at startup into a registry of decode ops,        */
+/*                or compiled into a C header holding the registry of a fixed production schema.                      */
+/*                                                                                                                    */
+/*  File        : log_decoder_Schema.h                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_SCHEMA_H
+#define LOG_DECODER_SCHEMA_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+#define SCHEMA_LINE_MAX_LENGTH          256U
+#define SCHEMA_NAME_MAX_LENGTH          32U
+/*-------------------------------- Keywords ----------------------------------*/
+#define SCHEMA_KEYWORD_FRAME            "FRAME"
+#define SCHEMA_KEYWORD_SIGNAL           "SIGNAL"
+#define SCHEMA_KEYWORD_SIGNED           "signed"
+#define SCHEMA_KEYWORD_UNSIGNED         "unsigned"
+#define SCHEMA_COMMENT                  '#'
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+boolean LogDecoder_bSchemaLoad(const char *ptrPath, LogDecoder_strRegistryType *ptrRegistry, uint32 *ptrErrorLine);
+boolean LogDecoder_bSchemaEmit(const LogDecoder_strRegistryType *ptrRegistry, const char *ptrPath);
+
+#endif /* LOG_DECODER_SCHEMA_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,330 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Run statistics printed with "--stats". Monotonic clock timings of the input, parse, validate,       */
+/*                decode and output stages, and counters of the decoded frames. Every function does nothing for a     */
+/*                NULL statistics pointer, so the decoder pays one call per batch when "--stats" is not given.        */
+/*                                                                                                                    */
+/*  File        : log_decoder_Stats.c                                                                                 */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_u64StatsClock                                                                                       */
+/* 2 / LogDecoder_vidStatsInit                                                                                        */
+/* 3 / LogDecoder_vidStatsStart                                                                                       */
+/* 4 / LogDecoder_vidStatsLap                                                                                         */
+/* 5 / LogDecoder_vidStatsBatch                                                                                       */
+/* 6 / LogDecoder_vidStatsReject                                                                                      */
+/* 7 / LogDecoder_vidStatsMerge                                                                                       */
+/* 8 / LogDecoder_vidStatsEnd                                                                                         */
+/* 9 / LogDecoder_vidStatsPrint                                                                                       */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#define STATS_POSIX_CLOCK
+#endif
+
+#include <time.h>
+#include "log_decoder_Stats.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define NANOSECONDS_PER_SECOND           1000000000ULL
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+static const char * const LogDecoder_aptrStageName[STATS_STAGES_NUMBER] =
+{
+    "input",
+    "parse",
+    "validate",
+    "decode",
+    "output"
+};
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u64StatsClock                                                                            */
+/* !Description : Current time of the monotonic clock, the calendar clock where no monotonic clock is available       */
+/*                                                                                                                    */
+/* !Outputs     : u64LocTime                    !Comment : Time in ns, from an unspecified origin                     */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint64 LogDecoder_u64StatsClock(void)
+{
+    struct timespec strLocTime = {0};
+    uint64 u64LocTime = FALSE;
+
+#ifdef STATS_POSIX_CLOCK
+    (void)clock_gettime(CLOCK_MONOTONIC, &strLocTime);
+#else
+    (void)timespec_get(&strLocTime, TIME_UTC);
+#endif
+    u64LocTime = ((uint64)strLocTime.tv_sec * NANOSECONDS_PER_SECOND) + (uint64)strLocTime.tv_nsec;
+
+    return u64LocTime;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStatsInit                                                                             */
+/* !Description : Clear the statistics and start the total time and the first stage                                   */
+/*                                                                                                                    */
+/* !Inputs      : u32ThreadsNb                  !Comment : Number of decoding threads, reported with the results      */
+/* !Outputs     : ptrStats                      !Comment : Statistics, or NULL                                        */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStatsInit(LogDecoder_strStatsType *ptrStats, uint32 u32ThreadsNb)
+{
+    if(ptrStats != NULL)
+    {
+        memset(ptrStats, 0, sizeof(*ptrStats));
+        ptrStats->u32ThreadsNb = u32ThreadsNb;
+        ptrStats->u64StartTime = LogDecoder_u64StatsClock();
+        ptrStats->u64LapTime   = ptrStats->u64StartTime;
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStatsStart                                                                            */
+/* !Description : Start a stage now, the time since the end of the last timed stage is not counted                    */
+/*                                                                                                                    */
+/* !Inputs      : ptrStats                      !Comment : Statistics, or NULL                                        */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStatsStart(LogDecoder_strStatsType *ptrStats)
+{
+    if(ptrStats != NULL)
+    {
+        ptrStats->u64LapTime = LogDecoder_u64StatsClock();
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStatsLap                                                                              */
+/* !Description : End the current stage : the time since the end of the last timed stage is added to u8Stage          */
+/*                                                                                                                    */
+/* !Inputs      : ptrStats                      !Comment : Statistics, or NULL                                        */
+/*                u8Stage                       !Comment : Stage which just ended                                     */
+/*                                              !Range   : [0, STATS_STAGES_NUMBER - 1]                               */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStatsLap(LogDecoder_strStatsType *ptrStats, uint8 u8Stage)
+{
+    uint64 u64LocNow = FALSE;
+
+    if(ptrStats != NULL)
+    {
+        u64LocNow = LogDecoder_u64StatsClock();
+        ptrStats->au64StageTime[u8Stage] += u64LocNow - ptrStats->u64LapTime;
+        ptrStats->u64LapTime = u64LocNow;
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStatsBatch                                                                            */
+/* !Description : Count the frames of a validated batch. The checks of an unknown frame ID are not counted, its rows  */
+/*                are counted as rejected by LogDecoder_vidStatsEnd.                                                  */
+/*                                                                                                                    */
+/* !Inputs      : ptrStats                      !Comment : Statistics, or NULL                                        */
+/*                ptrContext                    !Comment : Decoder context, for the frame definitions                 */
+/*                ptrBatch                      !Comment : Batch with its final flags                                 */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStatsBatch(LogDecoder_strStatsType *ptrStats, const LogDecoder_strContextType *ptrContext,
+                              const LogDecoder_strBatchType *ptrBatch)
+{
+    uint32 u32LocRow = FALSE;
+    uint8  u8LocId = FALSE;
+
+    if(ptrStats == NULL)
+    {
+        return;
+    }
+    ptrStats->u64RowsParsed += ptrBatch->u32FramesNb;
+    for(u32LocRow = 0U; u32LocRow < ptrBatch->u32FramesNb; u32LocRow++)
+    {
+        u8LocId = ptrBatch->ptrId[u32LocRow];
+        ptrStats->au64FramesPerId[u8LocId]++;
+        if(ptrContext->ptrRegistry->astrFrame[u8LocId].bDefined == TRUE)
+        {
+            ptrStats->u64ChecksumFailures  += (uint64)(ptrBatch->ptrChecksumOK[u32LocRow] == FALSE);
+            ptrStats->u64TimeoutViolations += (uint64)(ptrBatch->ptrTimeoutOK[u32LocRow] == FALSE);
+        }
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStatsReject                                                                           */
+/* !Description : Count a row rejected by the parser                                                                  */
+/*                                                                                                                    */
+/* !Inputs      : ptrStats                      !Comment : Statistics, or NULL                                        */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStatsReject(LogDecoder_strStatsType *ptrStats)
+{
+    if(ptrStats != NULL)
+    {
+        ptrStats->u64RowsRejected++;
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStatsMerge                                                                            */
+/* !Description : Add the timings and the counters of other statistics, for example those of a worker thread          */
+/*                                                                                                                    */
+/* !Inputs      : ptrStats                      !Comment : Statistics, or NULL                                        */
+/*                ptrOther                      !Comment : Statistics to be added                                     */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStatsMerge(LogDecoder_strStatsType *ptrStats, const LogDecoder_strStatsType *ptrOther)
+{
+    uint32 u32LocIndex = FALSE;
+
+    if(ptrStats == NULL)
+    {
+        return;
+    }
+    for(u32LocIndex = 0U; u32LocIndex < STATS_STAGES_NUMBER; u32LocIndex++)
+    {
+        ptrStats->au64StageTime[u32LocIndex] += ptrOther->au64StageTime[u32LocIndex];
+    }
+    for(u32LocIndex = 0U; u32LocIndex < FRAME_IDS_NUMBER; u32LocIndex++)
+    {
+        ptrStats->au64FramesPerId[u32LocIndex] += ptrOther->au64FramesPerId[u32LocIndex];
+    }
+    ptrStats->u64RowsParsed        += ptrOther->u64RowsParsed;
+    ptrStats->u64RowsRejected      += ptrOther->u64RowsRejected;
+    ptrStats->u64ChecksumFailures  += ptrOther->u64ChecksumFailures;
+    ptrStats->u64TimeoutViolations += ptrOther->u64TimeoutViolations;
+    ptrStats->u64FrameDrops        += ptrOther->u64FrameDrops;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStatsEnd                                                                              */
+/* !Description : Stop the total time and take the counters kept by the decoder context                               */
+/*                                                                                                                    */
+/* !Inputs      : ptrStats                      !Comment : Statistics, or NULL                                        */
+/*                ptrContext                    !Comment : Decoder context at the end of the input                    */
+/* !Number      : 8                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStatsEnd(LogDecoder_strStatsType *ptrStats, const LogDecoder_strContextType *ptrContext)
+{
+    uint32 u32LocId = FALSE;
+
+    if(ptrStats == NULL)
+    {
+        return;
+    }
+    for(u32LocId = 0U; u32LocId < FRAME_IDS_NUMBER; u32LocId++)
+    {
+        if(ptrContext->ptrRegistry->astrFrame[u32LocId].bDefined == TRUE)
+        {
+            ptrStats->u64FrameDrops += ptrContext->astrFrameState[u32LocId].u64FrameDropCnt;
+        }
+    }
+    ptrStats->u64RowsRejected += ptrContext->u32InvalidFramesNb;
+    ptrStats->u64TotalTime = LogDecoder_u64StatsClock() - ptrStats->u64StartTime;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidStatsPrint                                                                            */
+/* !Description : Print the statistics as aligned text, or as a single JSON object                                    */
+/*                                                                                                                    */
+/* !Inputs      : ptrStats                      !Comment : Statistics, or NULL                                        */
+/*                ptrFile                       !Comment : Destination of the report                                  */
+/*                bJson                         !Comment : TRUE for JSON, FALSE for text                              */
+/* !Number      : 9                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidStatsPrint(const LogDecoder_strStatsType *ptrStats, FILE *ptrFile, boolean bJson)
+{
+    uint32 u32LocIndex = FALSE;
+    const char *ptrLocSeparator = "";
+
+    if(ptrStats == NULL)
+    {
+        return;
+    }
+    if(bJson == TRUE)
+    {
+        fprintf(ptrFile, "{\"threads\":%lu,\"rows_parsed\":%llu,\"rows_rejected\":%llu,\"checksum_failures\":%llu,"
+                "\"timeout_violations\":%llu,\"frame_drops\":%llu,\"frames_per_id\":{",
+                ptrStats->u32ThreadsNb, ptrStats->u64RowsParsed, ptrStats->u64RowsRejected,
+                ptrStats->u64ChecksumFailures, ptrStats->u64TimeoutViolations, ptrStats->u64FrameDrops);
+        for(u32LocIndex = 0U; u32LocIndex < FRAME_IDS_NUMBER; u32LocIndex++)
+        {
+            if(ptrStats->au64FramesPerId[u32LocIndex] != 0U)
+            {
+                fprintf(ptrFile, "%s\"%lu\":%llu", ptrLocSeparator, u32LocIndex,
+                        ptrStats->au64FramesPerId[u32LocIndex]);
+                ptrLocSeparator = ",";
+            }
+        }
+        fprintf(ptrFile, "},\"stage_seconds\":{");
+        for(u32LocIndex = 0U; u32LocIndex < STATS_STAGES_NUMBER; u32LocIndex++)
+        {
+            fprintf(ptrFile, "%s\"%s\":%.6f", (u32LocIndex == 0U) ? "" : ",", LogDecoder_aptrStageName[u32LocIndex],
+                    (double)ptrStats->au64StageTime[u32LocIndex] / (double)NANOSECONDS_PER_SECOND);
+        }
+        fprintf(ptrFile, "},\"total_seconds\":%.6f}\n",
+                (double)ptrStats->u64TotalTime / (double)NANOSECONDS_PER_SECOND);
+    }
+    else
+    {
+        fprintf(ptrFile, "\nStatistics :\n"
+                "  rows parsed          %llu\n"
+                "  rows rejected        %llu\n"
+                "  checksum failures    %llu\n"
+                "  timeout violations   %llu\n"
+                "  frame drops          %llu\n",
+                ptrStats->u64RowsParsed, ptrStats->u64RowsRejected, ptrStats->u64ChecksumFailures,
+                ptrStats->u64TimeoutViolations, ptrStats->u64FrameDrops);
+        for(u32LocIndex = 0U; u32LocIndex < FRAME_IDS_NUMBER; u32LocIndex++)
+        {
+            if(ptrStats->au64FramesPerId[u32LocIndex] != 0U)
+            {
+                fprintf(ptrFile, "  frames of ID %-7lu %llu\n", u32LocIndex, ptrStats->au64FramesPerId[u32LocIndex]);
+            }
+        }
+        fprintf(ptrFile, "  stage times (s)%s\n", (ptrStats->u32ThreadsNb > 1U) ? ", summed over the threads" : "");
+        for(u32LocIndex = 0U; u32LocIndex < STATS_STAGES_NUMBER; u32LocIndex++)
+        {
+            fprintf(ptrFile, "    %-18s %.6f\n", LogDecoder_aptrStageName[u32LocIndex],
+                    (double)ptrStats->au64StageTime[u32LocIndex] / (double)NANOSECONDS_PER_SECOND);
+        }
+        fprintf(ptrFile, "  total time (s)       %.6f on %lu thread(s)\n",
+                (double)ptrStats->u64TotalTime / (double)NANOSECONDS_PER_SECOND, ptrStats->u32ThreadsNb);
+    }
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,68 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Run statistics printed with "--stats". Monotonic clock timings of the input, parse, validate,       */
+/*                decode and output stages, and counters of the decoded frames. Every function does nothing for a     */
+/*                NULL statistics pointer, so the decoder pays one call per batch when "--stats" is not given.        */
+/*                                                                                                                    */
+/*  File        : log_decoder_Stats.h                                                                                 */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_STATS_H
+#define LOG_DECODER_STATS_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/*------------------------------ Timed stages --------------------------------*/
+#define STATS_STAGE_INPUT               0U
+#define STATS_STAGE_PARSE               1U
+#define STATS_STAGE_VALIDATE            2U
+#define STATS_STAGE_DECODE              3U
+#define STATS_STAGE_OUTPUT              4U
+#define STATS_STAGES_NUMBER             5U
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+typedef struct
+{
+    uint64  au64StageTime[STATS_STAGES_NUMBER];     /* ns, summed over the threads of a parallel decoding     */
+    uint64  au64FramesPerId[FRAME_IDS_NUMBER];
+    uint64  u64RowsParsed;
+    uint64  u64RowsRejected;        /* Rows of an unknown frame ID and the malformed row                      */
+    uint64  u64ChecksumFailures;
+    uint64  u64TimeoutViolations;
+    uint64  u64FrameDrops;          /* Sum of the final drop counts of all the frame IDs                      */
+    uint64  u64StartTime;
+    uint64  u64LapTime;             /* End of the last timed stage                                            */
+    uint64  u64TotalTime;
+    uint32  u32ThreadsNb;
+}LogDecoder_strStatsType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+uint64 LogDecoder_u64StatsClock(void);
+void LogDecoder_vidStatsInit(LogDecoder_strStatsType *ptrStats, uint32 u32ThreadsNb);
+void LogDecoder_vidStatsStart(LogDecoder_strStatsType *ptrStats);
+void LogDecoder_vidStatsLap(LogDecoder_strStatsType *ptrStats, uint8 u8Stage);
+void LogDecoder_vidStatsBatch(LogDecoder_strStatsType *ptrStats, const LogDecoder_strContextType *ptrContext,
+                              const LogDecoder_strBatchType *ptrBatch);
+void LogDecoder_vidStatsReject(LogDecoder_strStatsType *ptrStats);
+void LogDecoder_vidStatsMerge(LogDecoder_strStatsType *ptrStats, const LogDecoder_strStatsType *ptrOther);
+void LogDecoder_vidStatsEnd(LogDecoder_strStatsType *ptrStats, const LogDecoder_strContextType *ptrContext);
+void LogDecoder_vidStatsPrint(const LogDecoder_strStatsType *ptrStats, FILE *ptrFile, boolean bJson);
+
+#endif /* LOG_DECODER_STATS_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,352 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Per frame ID totals written with "--summary" in place of the decoded rows. The validated and        */
+/*                decoded batches are accumulated in one pass, nothing is formatted per row. An accumulator keeps     */
+/*                its first and last frame of every ID, so that two consecutive parts of a log (parallel chunks) are  */
+/*                merged with the period and the drops between them, and two logs without.                            */
+/*                                                                                                                    */
+/*  File        : log_decoder_Summary.c                                                                               */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_vidSummaryPeriod                                                                                    */
+/* 2 / LogDecoder_vidSummaryInit                                                                                      */
+/* 3 / LogDecoder_vidSummaryBatch                                                                                     */
+/* 4 / LogDecoder_vidSummaryMerge                                                                                     */
+/* 5 / LogDecoder_vidSummaryRows                                                                                      */
+/* 6 / LogDecoder_vidSummaryWrite                                                                                     */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder_Summary.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static void LogDecoder_vidSummaryPeriod(LogDecoder_strSummaryIdType *ptrId, uint16 u16CycleTime, uint64 u64Previous,
+                                        uint64 u64Timestamp);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSummaryPeriod                                                                         */
+/* !Description : Count one inter-frame period of an ID, and its jitter in the bin of its power of two. A frame       */
+/*                received before the previous one (late frame) has no period.                                        */
+/*                                                                                                                    */
+/* !Inputs      : ptrId                         !Comment : Accumulator of the ID                                      */
+/*                u16CycleTime                  !Comment : Expected period of the ID (ms)                             */
+/*                u64Previous                   !Comment : Timestamp of the previous frame of the ID (ms)             */
+/*                u64Timestamp                  !Comment : Timestamp of the frame (ms)                                */
+/* !Outputs     : ptrId                         !Comment : Accumulator with the period                                */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogDecoder_vidSummaryPeriod(LogDecoder_strSummaryIdType *ptrId, uint16 u16CycleTime, uint64 u64Previous,
+                                        uint64 u64Timestamp)
+{
+    uint64 u64LocPeriod = u64Timestamp - u64Previous;
+    uint64 u64LocJitter = (u64LocPeriod > u16CycleTime) ? (u64LocPeriod - u16CycleTime) : (u16CycleTime - u64LocPeriod);
+    uint32 u32LocBin = FALSE;
+
+    if(u64Timestamp >= u64Previous)
+    {
+        if((ptrId->u64PeriodsNb == 0U) || (u64LocPeriod < ptrId->u64MinPeriod))
+        {
+            ptrId->u64MinPeriod = u64LocPeriod;
+        }
+        if((ptrId->u64PeriodsNb == 0U) || (u64LocPeriod > ptrId->u64MaxPeriod))
+        {
+            ptrId->u64MaxPeriod = u64LocPeriod;
+        }
+        ptrId->u64PeriodsNb++;
+        ptrId->u64PeriodSum += u64LocPeriod;
+
+        /* Bin 0 for no jitter, then bin N for [2^(N-1), 2^N - 1] ms, the last bin takes the rest */
+        while((u64LocJitter != 0U) && (u32LocBin < (SUMMARY_JITTER_BINS_NUMBER - 1U)))
+        {
+            u64LocJitter >>= 1U;
+            u32LocBin++;
+        }
+        ptrId->au64Jitter[u32LocBin]++;
+    }
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSummaryInit                                                                           */
+/* !Description : Empty the accumulators of all the frame IDs                                                         */
+/*                                                                                                                    */
+/* !Inputs      : ptrSummary                    !Comment : Summary to be initialized                                  */
+/* !Outputs     : ptrSummary                    !Comment : Summary without any frame                                  */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidSummaryInit(LogDecoder_strSummaryType *ptrSummary)
+{
+    memset(ptrSummary, 0, sizeof(*ptrSummary));
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSummaryBatch                                                                          */
+/* !Description : Accumulate the frames of a validated and decoded batch, in the order of the log. The frames of      */
+/*                an invalid frame ID are not part of the summary.                                                    */
+/*                                                                                                                    */
+/* !Inputs      : ptrSummary                    !Comment : Summary of the frames before the batch                     */
+/*                ptrRegistry                   !Comment : Frame definitions of the decoding                          */
+/*                ptrBatch                      !Comment : Validated and decoded batch                                */
+/* !Outputs     : ptrSummary                    !Comment : Summary including the batch                                */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidSummaryBatch(LogDecoder_strSummaryType *ptrSummary, const LogDecoder_strRegistryType *ptrRegistry,
+                                const LogDecoder_strBatchType *ptrBatch)
+{
+    LogDecoder_strSummaryIdType *ptrLocId = NULL;
+    sint32p s32LocValue = FALSE;
+    uint32 u32LocRow = FALSE;
+    uint32 u32LocColumn = FALSE;
+    uint8 u8LocId = FALSE;
+
+    for(u32LocRow = 0U; u32LocRow < ptrBatch->u32FramesNb; u32LocRow++)
+    {
+        u8LocId = ptrBatch->ptrId[u32LocRow];
+        if(ptrRegistry->astrFrame[u8LocId].bDefined == FALSE)
+        {
+            continue;
+        }
+        ptrLocId = &ptrSummary->astrId[u8LocId];
+        if(ptrLocId->u64FramesNb == 0U)
+        {
+            ptrLocId->u64FirstTimestamp = ptrBatch->ptrTimestamp[u32LocRow];
+            ptrLocId->u64FirstDropCnt   = ptrBatch->ptrFrameDropCnt[u32LocRow];
+            for(u32LocColumn = 0U; u32LocColumn < DECODED_COLUMNS_NUMBER; u32LocColumn++)
+            {
+                ptrLocId->as32MinValue[u32LocColumn] = ptrBatch->aptrValue[u32LocColumn][u32LocRow];
+                ptrLocId->as32MaxValue[u32LocColumn] = ptrBatch->aptrValue[u32LocColumn][u32LocRow];
+            }
+        }
+        else
+        {
+            LogDecoder_vidSummaryPeriod(ptrLocId, ptrRegistry->astrFrame[u8LocId].u16CycleTime,
+                                        ptrLocId->u64LastTimestamp, ptrBatch->ptrTimestamp[u32LocRow]);
+            ptrLocId->u64FrameDrops += ptrBatch->ptrFrameDropCnt[u32LocRow] - ptrLocId->u64LastDropCnt;
+            for(u32LocColumn = 0U; u32LocColumn < DECODED_COLUMNS_NUMBER; u32LocColumn++)
+            {
+                s32LocValue = ptrBatch->aptrValue[u32LocColumn][u32LocRow];
+                if(s32LocValue < ptrLocId->as32MinValue[u32LocColumn])
+                {
+                    ptrLocId->as32MinValue[u32LocColumn] = s32LocValue;
+                }
+                if(s32LocValue > ptrLocId->as32MaxValue[u32LocColumn])
+                {
+                    ptrLocId->as32MaxValue[u32LocColumn] = s32LocValue;
+                }
+            }
+        }
+        ptrLocId->u64LastTimestamp      = ptrBatch->ptrTimestamp[u32LocRow];
+        ptrLocId->u64LastDropCnt        = ptrBatch->ptrFrameDropCnt[u32LocRow];
+        ptrLocId->u64FramesNb++;
+        ptrLocId->u64ChecksumFailures  += (uint64)(ptrBatch->ptrChecksumOK[u32LocRow] == FALSE);
+        ptrLocId->u64TimeoutViolations += (uint64)(ptrBatch->ptrTimeoutOK[u32LocRow] == FALSE);
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSummaryMerge                                                                          */
+/* !Description : Add the summary of the frames which follow the ones of ptrSummary. For the next part of the same    */
+/*                log, the period and the drops between the last frame of ptrSummary and the first one of ptrOther    */
+/*                are counted too, so that merging the parts gives the summary of the whole log.                      */
+/*                                                                                                                    */
+/* !Inputs      : ptrSummary                    !Comment : Summary of the first frames                                */
+/*                ptrOther                      !Comment : Summary of the next frames                                 */
+/*                ptrRegistry                   !Comment : Frame definitions of the decoding                          */
+/*                bContiguous                   !Comment : TRUE if ptrOther is the next part of the same log          */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Outputs     : ptrSummary                    !Comment : Summary of all the frames                                  */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidSummaryMerge(LogDecoder_strSummaryType *ptrSummary, const LogDecoder_strSummaryType *ptrOther,
+                                const LogDecoder_strRegistryType *ptrRegistry, boolean bContiguous)
+{
+    LogDecoder_strSummaryIdType *ptrLocId = NULL;
+    const LogDecoder_strSummaryIdType *ptrLocOther = NULL;
+    uint32 u32LocId = FALSE;
+    uint32 u32LocIndex = FALSE;
+
+    for(u32LocId = 0U; u32LocId < FRAME_IDS_NUMBER; u32LocId++)
+    {
+        ptrLocId    = &ptrSummary->astrId[u32LocId];
+        ptrLocOther = &ptrOther->astrId[u32LocId];
+        if(ptrLocOther->u64FramesNb == 0U)
+        {
+            continue;
+        }
+        if(ptrLocId->u64FramesNb == 0U)
+        {
+            *ptrLocId = *ptrLocOther;
+            continue;
+        }
+
+        if(bContiguous == TRUE)
+        {
+            LogDecoder_vidSummaryPeriod(ptrLocId, ptrRegistry->astrFrame[u32LocId].u16CycleTime,
+                                        ptrLocId->u64LastTimestamp, ptrLocOther->u64FirstTimestamp);
+            ptrLocId->u64FrameDrops += ptrLocOther->u64FirstDropCnt - ptrLocId->u64LastDropCnt;
+        }
+        if(  (ptrLocOther->u64PeriodsNb != 0U)
+          && ((ptrLocId->u64PeriodsNb == 0U) || (ptrLocOther->u64MinPeriod < ptrLocId->u64MinPeriod)) )
+        {
+            ptrLocId->u64MinPeriod = ptrLocOther->u64MinPeriod;
+        }
+        if(  (ptrLocOther->u64PeriodsNb != 0U)
+          && ((ptrLocId->u64PeriodsNb == 0U) || (ptrLocOther->u64MaxPeriod > ptrLocId->u64MaxPeriod)) )
+        {
+            ptrLocId->u64MaxPeriod = ptrLocOther->u64MaxPeriod;
+        }
+        for(u32LocIndex = 0U; u32LocIndex < SUMMARY_JITTER_BINS_NUMBER; u32LocIndex++)
+        {
+            ptrLocId->au64Jitter[u32LocIndex] += ptrLocOther->au64Jitter[u32LocIndex];
+        }
+        for(u32LocIndex = 0U; u32LocIndex < DECODED_COLUMNS_NUMBER; u32LocIndex++)
+        {
+            if(ptrLocOther->as32MinValue[u32LocIndex] < ptrLocId->as32MinValue[u32LocIndex])
+            {
+                ptrLocId->as32MinValue[u32LocIndex] = ptrLocOther->as32MinValue[u32LocIndex];
+            }
+            if(ptrLocOther->as32MaxValue[u32LocIndex] > ptrLocId->as32MaxValue[u32LocIndex])
+            {
+                ptrLocId->as32MaxValue[u32LocIndex] = ptrLocOther->as32MaxValue[u32LocIndex];
+            }
+        }
+        ptrLocId->u64FramesNb          += ptrLocOther->u64FramesNb;
+        ptrLocId->u64ChecksumFailures  += ptrLocOther->u64ChecksumFailures;
+        ptrLocId->u64TimeoutViolations += ptrLocOther->u64TimeoutViolations;
+        ptrLocId->u64FrameDrops        += ptrLocOther->u64FrameDrops;
+        ptrLocId->u64PeriodsNb         += ptrLocOther->u64PeriodsNb;
+        ptrLocId->u64PeriodSum         += ptrLocOther->u64PeriodSum;
+        ptrLocId->u64LastTimestamp      = ptrLocOther->u64LastTimestamp;
+        ptrLocId->u64LastDropCnt        = ptrLocOther->u64LastDropCnt;
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSummaryRows                                                                           */
+/* !Description : Write the rows of the summary, one per frame ID with frames, without the header. The values of the  */
+/*                columns which the frame does not decode are left empty, as the period of a single frame.            */
+/*                                                                                                                    */
+/* !Inputs      : ptrSummary                    !Comment : Summary to be written                                      */
+/*                ptrRegistry                   !Comment : Frame definitions of the decoding                          */
+/*                ptrPrefix                     !Comment : Text put before every row (the file column of the batch    */
+/*                                                         mode), NULL for none                                       */
+/*                ptrWriter                     !Comment : Opened writer of the output file                           */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidSummaryRows(const LogDecoder_strSummaryType *ptrSummary,
+                               const LogDecoder_strRegistryType *ptrRegistry, const char *ptrPrefix,
+                               LogDecoder_strWriterType *ptrWriter)
+{
+    const LogDecoder_strSummaryIdType *ptrLocId = NULL;
+    const LogDecoder_strFrameDefType *ptrLocFrameDef = NULL;
+    boolean abLocColumn[DECODED_COLUMNS_NUMBER] = {FALSE};
+    char acLocRow[SUMMARY_ROW_MAX_LENGTH];
+    int s32LocLength = FALSE;
+    uint32 u32LocId = FALSE;
+    uint32 u32LocIndex = FALSE;
+
+    for(u32LocId = 0U; u32LocId < FRAME_IDS_NUMBER; u32LocId++)
+    {
+        ptrLocId       = &ptrSummary->astrId[u32LocId];
+        ptrLocFrameDef = &ptrRegistry->astrFrame[u32LocId];
+        if(ptrLocId->u64FramesNb == 0U)
+        {
+            continue;
+        }
+
+        s32LocLength = snprintf(acLocRow, sizeof(acLocRow), "%lu,%llu,%llu,%llu,%llu", u32LocId,
+                                ptrLocId->u64FramesNb, ptrLocId->u64ChecksumFailures,
+                                ptrLocId->u64TimeoutViolations, ptrLocId->u64FrameDrops);
+        if(ptrLocId->u64PeriodsNb != 0U)
+        {
+            s32LocLength += snprintf(&acLocRow[s32LocLength], sizeof(acLocRow) - (size_t)s32LocLength,
+                                     ",%llu,%llu,%.3f", ptrLocId->u64MinPeriod, ptrLocId->u64MaxPeriod,
+                                     (double)ptrLocId->u64PeriodSum / (double)ptrLocId->u64PeriodsNb);
+        }
+        else
+        {
+            s32LocLength += snprintf(&acLocRow[s32LocLength], sizeof(acLocRow) - (size_t)s32LocLength, ",,,");
+        }
+        for(u32LocIndex = 0U; u32LocIndex < SUMMARY_JITTER_BINS_NUMBER; u32LocIndex++)
+        {
+            s32LocLength += snprintf(&acLocRow[s32LocLength], sizeof(acLocRow) - (size_t)s32LocLength, ",%llu",
+                                     ptrLocId->au64Jitter[u32LocIndex]);
+        }
+
+        memset(abLocColumn, FALSE, sizeof(abLocColumn));
+        for(u32LocIndex = 0U; u32LocIndex < ptrLocFrameDef->u8SignalsNb; u32LocIndex++)
+        {
+            abLocColumn[ptrLocFrameDef->astrSignal[u32LocIndex].u8Column] = TRUE;
+        }
+        for(u32LocIndex = 0U; u32LocIndex < DECODED_COLUMNS_NUMBER; u32LocIndex++)
+        {
+            if(abLocColumn[u32LocIndex] == TRUE)
+            {
+                s32LocLength += snprintf(&acLocRow[s32LocLength], sizeof(acLocRow) - (size_t)s32LocLength,
+                                         ",%.3f,%.3f",
+                                         (double)ptrLocId->as32MinValue[u32LocIndex] / (double)DECODED_VALUE_SCALE,
+                                         (double)ptrLocId->as32MaxValue[u32LocIndex] / (double)DECODED_VALUE_SCALE);
+            }
+            else
+            {
+                s32LocLength += snprintf(&acLocRow[s32LocLength], sizeof(acLocRow) - (size_t)s32LocLength, ",,");
+            }
+        }
+        acLocRow[s32LocLength] = '\n';
+        if(ptrPrefix != NULL)
+        {
+            LogDecoder_vidWriterText(ptrWriter, ptrPrefix, strlen(ptrPrefix));
+        }
+        LogDecoder_vidWriterText(ptrWriter, acLocRow, (size_t)s32LocLength + 1U);
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidSummaryWrite                                                                          */
+/* !Description : Write the summary as a .csv file : the header, then one row per frame ID with frames                */
+/*                                                                                                                    */
+/* !Inputs      : ptrSummary                    !Comment : Summary to be written                                      */
+/*                ptrRegistry                   !Comment : Frame definitions of the decoding                          */
+/*                ptrWriter                     !Comment : Opened writer of the output file                           */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidSummaryWrite(const LogDecoder_strSummaryType *ptrSummary,
+                                const LogDecoder_strRegistryType *ptrRegistry, LogDecoder_strWriterType *ptrWriter)
+{
+    LogDecoder_vidWriterText(ptrWriter, HEADER_FOR_SUMMARY_FILE, sizeof(HEADER_FOR_SUMMARY_FILE) - 1U);
+    LogDecoder_vidSummaryRows(ptrSummary, ptrRegistry, NULL, ptrWriter);
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,78 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Per frame ID totals written with "--summary" in place of the decoded rows : frames, checksum        */
+/*                failures, timeout violations, drops, inter-frame period and its jitter, and the range of every      */
+/*                decoded value. The accumulators of consecutive parts of a log, or of several logs, can be merged.   */
+/*                                                                                                                    */
+/*  File        : log_decoder_Summary.h                                                                               */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_SUMMARY_H
+#define LOG_DECODER_SUMMARY_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+#include "log_decoder_Writer.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+/* Jitter (distance of the period to the cycle time) bins : 0, 1, 2-3, 4-7, 8-15, 16-31, 32-63, 64 ms and more        */
+#define SUMMARY_JITTER_BINS_NUMBER      8U
+#define SUMMARY_ROW_MAX_LENGTH          512U
+#define HEADER_FOR_SUMMARY_FILE         "ID,Frames,ChecksumFailures,TimeoutViolations,FrameDrops,"                 \
+                                        "MinPeriod,MaxPeriod,MeanPeriod,"                                          \
+                                        "Jitter0,Jitter1,Jitter2,Jitter4,Jitter8,Jitter16,Jitter32,Jitter64,"      \
+                                        "MinPositionX,MaxPositionX,MinPositionY,MaxPositionY,"                     \
+                                        "MinVelocityX,MaxVelocityX,MinVelocityY,MaxVelocityY\n"
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+typedef struct
+{
+    uint64  u64FramesNb;
+    uint64  u64ChecksumFailures;
+    uint64  u64TimeoutViolations;
+    uint64  u64FrameDrops;          /* Drops counted from the first frame to the last one                     */
+    uint64  u64PeriodsNb;           /* Periods between two frames, u64FramesNb - 1 in a single log           */
+    uint64  u64PeriodSum;
+    uint64  u64MinPeriod;
+    uint64  u64MaxPeriod;
+    uint64  au64Jitter[SUMMARY_JITTER_BINS_NUMBER];
+    uint64  u64FirstTimestamp;      /* First and last frame, to join the accumulator with the next one        */
+    uint64  u64LastTimestamp;
+    uint64  u64FirstDropCnt;
+    uint64  u64LastDropCnt;
+    sint32p as32MinValue[DECODED_COLUMNS_NUMBER];
+    sint32p as32MaxValue[DECODED_COLUMNS_NUMBER];
+}LogDecoder_strSummaryIdType;
+typedef struct
+{
+    LogDecoder_strSummaryIdType astrId[FRAME_IDS_NUMBER];
+}LogDecoder_strSummaryType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+void LogDecoder_vidSummaryInit(LogDecoder_strSummaryType *ptrSummary);
+void LogDecoder_vidSummaryBatch(LogDecoder_strSummaryType *ptrSummary, const LogDecoder_strRegistryType *ptrRegistry,
+                                const LogDecoder_strBatchType *ptrBatch);
+void LogDecoder_vidSummaryMerge(LogDecoder_strSummaryType *ptrSummary, const LogDecoder_strSummaryType *ptrOther,
+                                const LogDecoder_strRegistryType *ptrRegistry, boolean bContiguous);
+void LogDecoder_vidSummaryRows(const LogDecoder_strSummaryType *ptrSummary,
+                               const LogDecoder_strRegistryType *ptrRegistry, const char *ptrPrefix,
+                               LogDecoder_strWriterType *ptrWriter);
+void LogDecoder_vidSummaryWrite(const LogDecoder_strSummaryType *ptrSummary,
+                                const LogDecoder_strRegistryType *ptrRegistry, LogDecoder_strWriterType *ptrWriter);
+
+#endif /* LOG_DECODER_SUMMARY_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -19,6 +19,7 @@
 /**********************************************************************************************************************/
 /* INCLUDES                                                                                                           */
 /**********************************************************************************************************************/
+#include <stdint.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -32,7 +33,12 @@ typedef unsigned short      uint16;
 typedef signed short        sint16;
 typedef unsigned long       uint32;
 typedef signed long         sint32;
+typedef unsigned long long  uint64;
+typedef signed long long    sint64;
 typedef float               float32;
+/* Exactly 32 bits wide (uint32 is a long), elements of the arrays processed by the SIMD kernels                      */
+typedef uint32_t            uint32p;
+typedef int32_t             sint32p;
 
 #endif /* LOG_DECODER_TYPES_H */
 /*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,671 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Buffered output writer. Decoded rows are formatted without printf (integer-to-ASCII of the          */
+/*                integer and fixed-point decimal fields) into a large buffer owned by the writer, which is           */
+/*                flushed with large write() calls. One writer is used per thread, or per chunk in memory mode.       */
+/*                Once started, a writer thread writes each full buffer while the next one is being formatted.        */
+/*                With "--compress" the buffers are compressed in independent blocks on their way to the file.        */
+/*                                                                                                                    */
+/*  File        : log_decoder_Writer.c                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogDecoder_u32FormatUnsigned                                                                                   */
+/* 2 / LogDecoder_u32FormatFixed                                                                                      */
+/* 3 / LogDecoder_bWriterWrite                                                                                        */
+/* 4 / LogDecoder_bWriterOutput                                                                                       */
+/* 5 / LogDecoder_s32WriterThread                                                                                     */
+/* 6 / LogDecoder_bWriterOpen                                                                                         */
+/* 7 / LogDecoder_bWriterCompress                                                                                     */
+/* 8 / LogDecoder_u32WriterFormatRow                                                                                  */
+/* 9 / LogDecoder_vidWriterRow                                                                                        */
+/* 10 / LogDecoder_vidWriterBatch                                                                                     */
+/* 11 / LogDecoder_vidWriterSourceBatch                                                                               */
+/* 12 / LogDecoder_vidWriterText                                                                                      */
+/* 13 / LogDecoder_bWriterStart                                                                                       */
+/* 14 / LogDecoder_bWriterFlush                                                                                       */
+/* 15 / LogDecoder_bWriterClose                                                                                       */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#if defined(__unix__) || defined(__APPLE__)
+#define _POSIX_C_SOURCE 200809L
+#define WRITER_POSIX_IO
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include "log_decoder_Batch.h"
+#include "log_decoder_Writer.h"
+
+#ifdef WRITER_POSIX_IO
+#include <unistd.h>
+#endif
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define DECIMAL_BASE                     10U
+#define UINT64_MAX_DIGITS_NUMBER         20U
+#define POSITION_X_DECIMALS              2U
+#define DECODED_DECIMALS                 3U
+#define FIELD_SEPARATOR                  ", "
+#define FIELD_SEPARATOR_LENGTH           2U
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+static const uint32 LogDecoder_au32DecimalScale[DECODED_DECIMALS + 1U] = {1U, 10U, 100U, 1000U};
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static uint32 LogDecoder_u32FormatUnsigned(char *ptrBuffer, uint64 u64Value);
+static uint32 LogDecoder_u32FormatFixed(char *ptrBuffer, sint32 s32Value, uint32 u32Decimals);
+static boolean LogDecoder_bWriterWrite(LogDecoder_strWriterType *ptrWriter, const char *ptrData, size_t u32Size);
+static boolean LogDecoder_bWriterOutput(LogDecoder_strWriterType *ptrWriter, const char *ptrData, size_t u32Size);
+static int LogDecoder_s32WriterThread(void *ptrArgument);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32FormatUnsigned                                                                        */
+/* !Description : Write an unsigned integer in decimal, same text as printf "%d" / "%lu"                              */
+/*                                                                                                                    */
+/* !Inputs      : u64Value                      !Comment : Value to be written                                        */
+/* !Outputs     : ptrBuffer                     !Comment : Decimal digits, at most UINT64_MAX_DIGITS_NUMBER           */
+/*                u32LocLength                  !Comment : Number of written characters                               */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint32 LogDecoder_u32FormatUnsigned(char *ptrBuffer, uint64 u64Value)
+{
+    char sLocDigits[UINT64_MAX_DIGITS_NUMBER];
+    uint32 u32LocLength = FALSE;
+    uint32 u32LocIndex = FALSE;
+
+    /* Digits are produced from the least significant one, then copied in the reading order       */
+    do
+    {
+        sLocDigits[u32LocLength] = (char)('0' + (u64Value % DECIMAL_BASE));
+        u64Value /= DECIMAL_BASE;
+        u32LocLength++;
+    } while(u64Value != 0U);
+
+    for(u32LocIndex = 0U; u32LocIndex < u32LocLength; u32LocIndex++)
+    {
+        ptrBuffer[u32LocIndex] = sLocDigits[u32LocLength - 1U - u32LocIndex];
+    }
+
+    return u32LocLength;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32FormatFixed                                                                           */
+/* !Description : Write a fixed-point decoded value with the given number of decimals. The value is rounded           */
+/*                half away from zero when less decimals than DECODED_DECIMALS are printed, a negative value          */
+/*                keeps its sign even when it is rounded to zero (same as printf "%.Nf").                             */
+/*                                                                                                                    */
+/* !Inputs      : s32Value                      !Comment : Decoded value, in 1 / DECODED_VALUE_SCALE units            */
+/*                u32Decimals                   !Comment : Number of decimals                                         */
+/*                                              !Range   : [0, DECODED_DECIMALS]                                      */
+/* !Outputs     : ptrBuffer                     !Comment : Formatted value                                            */
+/*                u32LocLength                  !Comment : Number of written characters                               */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint32 LogDecoder_u32FormatFixed(char *ptrBuffer, sint32 s32Value, uint32 u32Decimals)
+{
+    uint32 u32LocLength = FALSE;
+    uint32 u32LocScale = LogDecoder_au32DecimalScale[u32Decimals];
+    uint32 u32LocDropped = LogDecoder_au32DecimalScale[DECODED_DECIMALS - u32Decimals];
+    uint64 u64LocFixed = FALSE;
+    uint32 u32LocFraction = FALSE;
+    uint32 u32LocIndex = FALSE;
+
+    if(s32Value < 0)
+    {
+        ptrBuffer[u32LocLength] = '-';
+        u32LocLength++;
+        u64LocFixed = (uint64)(-(sint64)s32Value);
+    }
+    else
+    {
+        u64LocFixed = (uint64)s32Value;
+    }
+    u64LocFixed = (u64LocFixed + (u32LocDropped / 2U)) / u32LocDropped;
+
+    u32LocLength += LogDecoder_u32FormatUnsigned(&ptrBuffer[u32LocLength], u64LocFixed / u32LocScale);
+    if(u32Decimals != 0U)
+    {
+        ptrBuffer[u32LocLength] = '.';
+        u32LocLength++;
+        u32LocFraction = (uint32)(u64LocFixed % u32LocScale);
+        for(u32LocIndex = u32Decimals; u32LocIndex > 0U; u32LocIndex--)
+        {
+            ptrBuffer[u32LocLength + u32LocIndex - 1U] = (char)('0' + (u32LocFraction % DECIMAL_BASE));
+            u32LocFraction /= DECIMAL_BASE;
+        }
+        u32LocLength += u32Decimals;
+    }
+
+    return u32LocLength;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bWriterWrite                                                                             */
+/* !Description : Write a block of bytes to the destination file, with as few system calls as possible                */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer with a destination file                      */
+/*                ptrData                       !Comment : Bytes to be written                                        */
+/*                u32Size                       !Comment : Number of bytes                                            */
+/* !Outputs     : bLocStatus                    !Comment : FALSE if the bytes could not all be written                */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bWriterWrite(LogDecoder_strWriterType *ptrWriter, const char *ptrData, size_t u32Size)
+{
+    boolean bLocStatus = TRUE;
+#ifdef WRITER_POSIX_IO
+    ssize_t s32LocResult = 0;
+
+    while((u32Size > 0U) && (bLocStatus == TRUE))
+    {
+        s32LocResult = write(fileno(ptrWriter->ptrFile), ptrData, u32Size);
+        if(s32LocResult > 0)
+        {
+            ptrData += s32LocResult;
+            u32Size -= (size_t)s32LocResult;
+        }
+        else if((s32LocResult < 0) && (errno == EINTR))
+        {
+            /* Interrupted before anything was written, try again                                 */
+        }
+        else
+        {
+            bLocStatus = FALSE;
+        }
+    }
+#else
+    bLocStatus = (boolean)(fwrite(ptrData, 1U, u32Size, ptrWriter->ptrFile) == u32Size);
+#endif
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bWriterOutput                                                                            */
+/* !Description : Write formatted bytes to the destination file, as they are or compressed in blocks of at most       */
+/*                COMPRESS_BLOCK_SIZE bytes. The compression runs on the thread which writes, the writer thread once  */
+/*                the writer is started.                                                                              */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer with a destination file                      */
+/*                ptrData                       !Comment : Bytes to be written                                        */
+/*                u32Size                       !Comment : Number of bytes                                            */
+/* !Outputs     : bLocStatus                    !Comment : FALSE if the bytes could not all be written                */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogDecoder_bWriterOutput(LogDecoder_strWriterType *ptrWriter, const char *ptrData, size_t u32Size)
+{
+    boolean bLocStatus = TRUE;
+    size_t u32LocPartSize = FALSE;
+
+    if(ptrWriter->strCompress.ptrTable == NULL)
+    {
+        bLocStatus = LogDecoder_bWriterWrite(ptrWriter, ptrData, u32Size);
+    }
+    else
+    {
+        while((u32Size > 0U) && (bLocStatus == TRUE))
+        {
+            u32LocPartSize = (u32Size < COMPRESS_BLOCK_SIZE) ? u32Size : COMPRESS_BLOCK_SIZE;
+            bLocStatus = LogDecoder_bWriterWrite(ptrWriter, ptrWriter->strCompress.ptrBlock,
+                                                 LogDecoder_u32CompressBlock(&ptrWriter->strCompress, ptrData,
+                                                                             u32LocPartSize));
+            ptrData += u32LocPartSize;
+            u32Size -= u32LocPartSize;
+        }
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_s32WriterThread                                                                          */
+/* !Description : Writer thread. Every full buffer is written to the destination file and given back to be filled     */
+/*                again, until the empty block which ends the output. After a failed write the buffers are still      */
+/*                given back, but no longer written.                                                                  */
+/*                                                                                                                    */
+/* !Inputs      : ptrArgument                   !Comment : Started writer (LogDecoder_strWriterType)                  */
+/* !Outputs     : s32LocResult                  !Comment : Always 0                                                   */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static int LogDecoder_s32WriterThread(void *ptrArgument)
+{
+    LogDecoder_strWriterType *ptrLocWriter = (LogDecoder_strWriterType *)ptrArgument;
+    LogDecoder_strBlockType *ptrLocBlock = NULL;
+
+    while((ptrLocBlock = LogDecoder_ptrQueueGet(&ptrLocWriter->strStage.strFull))->u32Size != 0U)
+    {
+        if(  (ptrLocWriter->strStage.bError == FALSE)
+          && (LogDecoder_bWriterOutput(ptrLocWriter, ptrLocBlock->ptrData, ptrLocBlock->u32Size) == FALSE) )
+        {
+            ptrLocWriter->strStage.bError = TRUE;
+        }
+        LogDecoder_vidQueuePut(&ptrLocWriter->strStage.strFree, ptrLocBlock);
+    }
+
+    return 0;
+}
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS                                                                                                   */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bWriterOpen                                                                              */
+/* !Description : Allocate the buffer of a writer. With a destination file the buffer is flushed to it when           */
+/*                full, without file (memory mode) the formatted text is kept for the caller.                         */
+/*                                                                                                                    */
+/* !Inputs      : ptrFile                       !Comment : Destination opened for writing, or NULL                    */
+/*                u32BufferSize                 !Comment : Size of the buffer, at least OUTPUT_ROW_MAX_LENGTH         */
+/* !Outputs     : ptrWriter                     !Comment : Empty writer                                               */
+/*                bLocStatus                    !Comment : FALSE if the buffer cannot be allocated                    */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bWriterOpen(LogDecoder_strWriterType *ptrWriter, FILE *ptrFile, size_t u32BufferSize)
+{
+    memset(ptrWriter, 0, sizeof(*ptrWriter));
+    ptrWriter->ptrFile       = ptrFile;
+    ptrWriter->u32BufferSize = u32BufferSize;
+    ptrWriter->ptrBuffer     = malloc(u32BufferSize);
+    if(ptrFile != NULL)
+    {
+        /* Anything already written through the stream goes before the writer data                */
+        (void)fflush(ptrFile);
+    }
+
+    return (boolean)(ptrWriter->ptrBuffer != NULL);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bWriterCompress                                                                          */
+/* !Description : Compress everything written from now on ("--compress"). The header of the compressed file is        */
+/*                written at once, the empty block which ends it when the writer is closed.                           */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer with a destination file, nothing written yet */
+/* !Outputs     : ptrWriter                     !Comment : Compressing writer                                         */
+/*                bLocStatus                    !Comment : FALSE if the compressor cannot be allocated or the header  */
+/*                                                         cannot be written                                          */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 7                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bWriterCompress(LogDecoder_strWriterType *ptrWriter)
+{
+    char acLocHeader[COMPRESS_HEADER_SIZE];
+    boolean bLocStatus = FALSE;
+
+    if(  (ptrWriter->ptrFile != NULL) && (ptrWriter->u32Used == 0U) && (ptrWriter->strStage.bStarted == FALSE)
+      && (ptrWriter->strCompress.ptrTable == NULL) && (LogDecoder_bCompressOpen(&ptrWriter->strCompress) == TRUE) )
+    {
+        LogDecoder_vidCompressHeader(acLocHeader);
+        bLocStatus = LogDecoder_bWriterWrite(ptrWriter, acLocHeader, sizeof(acLocHeader));
+        if(bLocStatus == FALSE)
+        {
+            LogDecoder_vidCompressClose(&ptrWriter->strCompress);
+        }
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_u32WriterFormatRow                                                                       */
+/* !Description : Format one decoded frame as an output .csv row, the text is identical to the printf format          */
+/*                "%d, %d, %d, %.2f, %.3f, %.3f, %.3f, %d, %d, %d\n" of the physical values                           */
+/*                                                                                                                    */
+/* !Inputs      : ptrOutputData                 !Comment : Decoded frame                                              */
+/* !Outputs     : ptrBuffer                     !Comment : Formatted row, at least OUTPUT_ROW_MAX_LENGTH bytes        */
+/*                u32LocLength                  !Comment : Number of characters written to ptrBuffer                  */
+/* !Number      : 8                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+uint32 LogDecoder_u32WriterFormatRow(char *ptrBuffer, const LogDecoder_strOutputDataType *ptrOutputData)
+{
+    const sint32 *ptrLocValue = ptrOutputData->strDecodedData.as32Value;
+    char *ptrLocCursor = ptrBuffer;
+
+    ptrLocCursor += LogDecoder_u32FormatUnsigned(ptrLocCursor, ptrOutputData->u8Id);
+    memcpy(ptrLocCursor, FIELD_SEPARATOR, FIELD_SEPARATOR_LENGTH);
+    ptrLocCursor += FIELD_SEPARATOR_LENGTH;
+    ptrLocCursor += LogDecoder_u32FormatUnsigned(ptrLocCursor, ptrOutputData->u64FrameNb);
+    memcpy(ptrLocCursor, FIELD_SEPARATOR, FIELD_SEPARATOR_LENGTH);
+    ptrLocCursor += FIELD_SEPARATOR_LENGTH;
+    ptrLocCursor += LogDecoder_u32FormatUnsigned(ptrLocCursor, ptrOutputData->u64Timestamp);
+    memcpy(ptrLocCursor, FIELD_SEPARATOR, FIELD_SEPARATOR_LENGTH);
+    ptrLocCursor += FIELD_SEPARATOR_LENGTH;
+    ptrLocCursor += LogDecoder_u32FormatFixed(ptrLocCursor, ptrLocValue[DECODED_POSITION_X], POSITION_X_DECIMALS);
+    memcpy(ptrLocCursor, FIELD_SEPARATOR, FIELD_SEPARATOR_LENGTH);
+    ptrLocCursor += FIELD_SEPARATOR_LENGTH;
+    ptrLocCursor += LogDecoder_u32FormatFixed(ptrLocCursor, ptrLocValue[DECODED_POSITION_Y], DECODED_DECIMALS);
+    memcpy(ptrLocCursor, FIELD_SEPARATOR, FIELD_SEPARATOR_LENGTH);
+    ptrLocCursor += FIELD_SEPARATOR_LENGTH;
+    ptrLocCursor += LogDecoder_u32FormatFixed(ptrLocCursor, ptrLocValue[DECODED_VELOCITY_X], DECODED_DECIMALS);
+    memcpy(ptrLocCursor, FIELD_SEPARATOR, FIELD_SEPARATOR_LENGTH);
+    ptrLocCursor += FIELD_SEPARATOR_LENGTH;
+    ptrLocCursor += LogDecoder_u32FormatFixed(ptrLocCursor, ptrLocValue[DECODED_VELOCITY_Y], DECODED_DECIMALS);
+    memcpy(ptrLocCursor, FIELD_SEPARATOR, FIELD_SEPARATOR_LENGTH);
+    ptrLocCursor += FIELD_SEPARATOR_LENGTH;
+    ptrLocCursor += LogDecoder_u32FormatUnsigned(ptrLocCursor, ptrOutputData->bChecksumOK);
+    memcpy(ptrLocCursor, FIELD_SEPARATOR, FIELD_SEPARATOR_LENGTH);
+    ptrLocCursor += FIELD_SEPARATOR_LENGTH;
+    ptrLocCursor += LogDecoder_u32FormatUnsigned(ptrLocCursor, ptrOutputData->bTimeoutOK);
+    memcpy(ptrLocCursor, FIELD_SEPARATOR, FIELD_SEPARATOR_LENGTH);
+    ptrLocCursor += FIELD_SEPARATOR_LENGTH;
+    ptrLocCursor += LogDecoder_u32FormatUnsigned(ptrLocCursor, ptrOutputData->u64FrameDropCnt);
+    *ptrLocCursor = '\n';
+    ptrLocCursor++;
+
+    return (uint32)(ptrLocCursor - ptrBuffer);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidWriterRow                                                                             */
+/* !Description : Format one decoded frame at the end of the writer buffer, the buffer is flushed first when          */
+/*                a row may not fit in it                                                                             */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer                                              */
+/*                ptrOutputData                 !Comment : Decoded frame                                              */
+/* !Number      : 9                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidWriterRow(LogDecoder_strWriterType *ptrWriter, const LogDecoder_strOutputDataType *ptrOutputData)
+{
+    if((ptrWriter->u32BufferSize - ptrWriter->u32Used) < OUTPUT_ROW_MAX_LENGTH)
+    {
+        if((ptrWriter->ptrFile == NULL) || (LogDecoder_bWriterFlush(ptrWriter) == FALSE))
+        {
+            ptrWriter->bError = TRUE;
+            return;
+        }
+    }
+    ptrWriter->u32Used += LogDecoder_u32WriterFormatRow(&ptrWriter->ptrBuffer[ptrWriter->u32Used], ptrOutputData);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidWriterBatch                                                                           */
+/* !Description : Format all the decoded frames of a batch at the end of the writer buffer, in the batch order        */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer                                              */
+/*                ptrBatch                      !Comment : Validated and decoded batch                                */
+/* !Number      : 10                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidWriterBatch(LogDecoder_strWriterType *ptrWriter, const LogDecoder_strBatchType *ptrBatch)
+{
+    LogDecoder_strOutputDataType strLocOutputData = {0};
+    uint32 u32LocIndex = FALSE;
+
+    for(u32LocIndex = 0U; (u32LocIndex < ptrBatch->u32FramesNb) && (ptrWriter->bError == FALSE); u32LocIndex++)
+    {
+        LogDecoder_vidBatchOutput(ptrBatch, u32LocIndex, &strLocOutputData);
+        LogDecoder_vidWriterRow(ptrWriter, &strLocOutputData);
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidWriterSourceBatch                                                                     */
+/* !Description : Format all the decoded frames of a merged batch, each row starting with the source column of the    */
+/*                input log it comes from                                                                             */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer                                              */
+/*                ptrBatch                      !Comment : Validated and decoded batch, with its source column        */
+/*                aptrSource                    !Comment : Source field of every input log, separator included        */
+/* !Number      : 11                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidWriterSourceBatch(LogDecoder_strWriterType *ptrWriter, const LogDecoder_strBatchType *ptrBatch,
+                                     const char * const *aptrSource)
+{
+    LogDecoder_strOutputDataType strLocOutputData = {0};
+    const char *ptrLocSource = NULL;
+    uint32 u32LocIndex = FALSE;
+
+    for(u32LocIndex = 0U; (u32LocIndex < ptrBatch->u32FramesNb) && (ptrWriter->bError == FALSE); u32LocIndex++)
+    {
+        ptrLocSource = aptrSource[ptrBatch->ptrSource[u32LocIndex]];
+        LogDecoder_vidWriterText(ptrWriter, ptrLocSource, strlen(ptrLocSource));
+        LogDecoder_vidBatchOutput(ptrBatch, u32LocIndex, &strLocOutputData);
+        LogDecoder_vidWriterRow(ptrWriter, &strLocOutputData);
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_vidWriterText                                                                            */
+/* !Description : Append raw text (header or text formatted by another writer). A block larger than the free          */
+/*                space is written directly after the buffered data, without copy.                                    */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer                                              */
+/*                ptrText                       !Comment : Text to be written                                         */
+/*                u32Size                       !Comment : Number of characters                                       */
+/* !Number      : 12                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+void LogDecoder_vidWriterText(LogDecoder_strWriterType *ptrWriter, const char *ptrText, size_t u32Size)
+{
+    size_t u32LocPartSize = FALSE;
+
+    if(u32Size <= (ptrWriter->u32BufferSize - ptrWriter->u32Used))
+    {
+        memcpy(&ptrWriter->ptrBuffer[ptrWriter->u32Used], ptrText, u32Size);
+        ptrWriter->u32Used += u32Size;
+    }
+    else if(ptrWriter->strStage.bStarted == TRUE)
+    {
+        /* The buffers are written in order by the writer thread, the text goes through them      */
+        while((u32Size > 0U) && (ptrWriter->bError == FALSE))
+        {
+            u32LocPartSize = ptrWriter->u32BufferSize - ptrWriter->u32Used;
+            u32LocPartSize = (u32Size < u32LocPartSize) ? u32Size : u32LocPartSize;
+            memcpy(&ptrWriter->ptrBuffer[ptrWriter->u32Used], ptrText, u32LocPartSize);
+            ptrWriter->u32Used += u32LocPartSize;
+            ptrText += u32LocPartSize;
+            u32Size -= u32LocPartSize;
+            if(u32Size > 0U)
+            {
+                (void)LogDecoder_bWriterFlush(ptrWriter);
+            }
+        }
+    }
+    else if(  (ptrWriter->ptrFile != NULL) && (LogDecoder_bWriterFlush(ptrWriter) == TRUE)
+           && (LogDecoder_bWriterOutput(ptrWriter, ptrText, u32Size) == TRUE) )
+    {
+        /* Written in place                                                                       */
+    }
+    else
+    {
+        ptrWriter->bError = TRUE;
+    }
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bWriterStart                                                                             */
+/* !Description : Start the writer thread of a writer with a destination file. WRITER_BUFFERS_NUMBER - 1 more         */
+/*                buffers are allocated, a full buffer is then handed to the writer thread and the formatting goes on */
+/*                in the next free one.                                                                               */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer with a destination file                      */
+/* !Outputs     : ptrWriter                     !Comment : Writer whose buffers are written by the writer thread      */
+/*                bLocStatus                    !Comment : FALSE if the formatting thread still writes the buffer     */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 13                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bWriterStart(LogDecoder_strWriterType *ptrWriter)
+{
+    boolean bLocStatus = FALSE;
+    uint32 u32LocIndex = FALSE;
+
+    if(  (ptrWriter->ptrFile != NULL) && (ptrWriter->ptrBuffer != NULL)
+      && (ptrWriter->strStage.bStarted == FALSE) )
+    {
+        ptrWriter->astrBlock[0].ptrData = ptrWriter->ptrBuffer;
+        ptrWriter->ptrBlock = &ptrWriter->astrBlock[0];
+        for(u32LocIndex = 1U; u32LocIndex < WRITER_BUFFERS_NUMBER; u32LocIndex++)
+        {
+            ptrWriter->astrBlock[u32LocIndex].ptrData = malloc(ptrWriter->u32BufferSize);
+            bLocStatus = (boolean)(ptrWriter->astrBlock[u32LocIndex].ptrData != NULL);
+            if(bLocStatus == FALSE)
+            {
+                break;
+            }
+        }
+        if(bLocStatus == TRUE)
+        {
+            bLocStatus = LogDecoder_bStageStart(&ptrWriter->strStage, LogDecoder_s32WriterThread, ptrWriter,
+                                                &ptrWriter->astrBlock[1], WRITER_BUFFERS_NUMBER - 1U);
+        }
+        if(bLocStatus == FALSE)
+        {
+            for(u32LocIndex = 1U; u32LocIndex < WRITER_BUFFERS_NUMBER; u32LocIndex++)
+            {
+                free(ptrWriter->astrBlock[u32LocIndex].ptrData);
+                ptrWriter->astrBlock[u32LocIndex].ptrData = NULL;
+            }
+        }
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bWriterFlush                                                                             */
+/* !Description : Write the buffered text to the destination file and empty the buffer. A started writer hands the    */
+/*                buffer to the writer thread and goes on with the next free one, an error of the writer thread is    */
+/*                seen at a later flush.                                                                              */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Opened writer                                              */
+/* !Outputs     : bLocStatus                    !Comment : FALSE if an error occured since the writer was opened      */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 14                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bWriterFlush(LogDecoder_strWriterType *ptrWriter)
+{
+    /* In memory mode the text stays in the buffer for the caller                                 */
+    if(ptrWriter->strStage.bStarted == TRUE)
+    {
+        if(ptrWriter->u32Used != 0U)
+        {
+            ptrWriter->ptrBlock->u32Size = ptrWriter->u32Used;
+            LogDecoder_vidQueuePut(&ptrWriter->strStage.strFull, ptrWriter->ptrBlock);
+            ptrWriter->ptrBlock  = LogDecoder_ptrQueueGet(&ptrWriter->strStage.strFree);
+            ptrWriter->ptrBuffer = ptrWriter->ptrBlock->ptrData;
+        }
+        ptrWriter->u32Used = FALSE;
+        if(ptrWriter->strStage.bError == TRUE)
+        {
+            ptrWriter->bError = TRUE;
+        }
+    }
+    else if(ptrWriter->ptrFile != NULL)
+    {
+        if(  (ptrWriter->u32Used != 0U)
+          && (LogDecoder_bWriterOutput(ptrWriter, ptrWriter->ptrBuffer, ptrWriter->u32Used) == FALSE) )
+        {
+            ptrWriter->bError = TRUE;
+        }
+        ptrWriter->u32Used = FALSE;
+    }
+
+    return (boolean)(ptrWriter->bError == FALSE);
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogDecoder_bWriterClose                                                                             */
+/* !Description : Flush the buffered text and release the buffer, the destination file is left open. A started writer */
+/*                ends its writer thread with an empty block and waits for it, then releases all its buffers.         */
+/*                                                                                                                    */
+/* !Inputs      : ptrWriter                     !Comment : Writer to be closed                                        */
+/* !Outputs     : bLocStatus                    !Comment : FALSE if an error occured since the writer was opened      */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 15                                                                                                  */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+boolean LogDecoder_bWriterClose(LogDecoder_strWriterType *ptrWriter)
+{
+    char acLocEnd[COMPRESS_BLOCK_HEADER_SIZE];
+    boolean bLocStatus = FALSE;
+    LogDecoder_strBlockType *ptrLocBlock = NULL;
+    uint32 u32LocIndex = FALSE;
+
+    if(ptrWriter->ptrBuffer != NULL)
+    {
+        (void)LogDecoder_bWriterFlush(ptrWriter);
+    }
+    if(ptrWriter->strStage.bStarted == TRUE)
+    {
+        ptrLocBlock = LogDecoder_ptrQueueGet(&ptrWriter->strStage.strFree);
+        ptrLocBlock->u32Size = FALSE;
+        LogDecoder_vidQueuePut(&ptrWriter->strStage.strFull, ptrLocBlock);
+        LogDecoder_vidStageJoin(&ptrWriter->strStage);
+        if(ptrWriter->strStage.bError == TRUE)
+        {
+            ptrWriter->bError = TRUE;
+        }
+        /* ptrBuffer is one of the blocks                                                         */
+        for(u32LocIndex = 1U; u32LocIndex < WRITER_BUFFERS_NUMBER; u32LocIndex++)
+        {
+            free(ptrWriter->astrBlock[u32LocIndex].ptrData);
+        }
+        ptrWriter->ptrBuffer = ptrWriter->astrBlock[0].ptrData;
+    }
+    if(ptrWriter->strCompress.ptrTable != NULL)
+    {
+        /* Without the empty block the file reads as truncated                                    */
+        memset(acLocEnd, 0, sizeof(acLocEnd));
+        if(  (ptrWriter->bError == FALSE)
+          && (LogDecoder_bWriterWrite(ptrWriter, acLocEnd, sizeof(acLocEnd)) == FALSE) )
+        {
+            ptrWriter->bError = TRUE;
+        }
+        LogDecoder_vidCompressClose(&ptrWriter->strCompress);
+    }
+    bLocStatus = (boolean)((ptrWriter->ptrBuffer != NULL) && (ptrWriter->bError == FALSE));
+    free(ptrWriter->ptrBuffer);
+    memset(ptrWriter, 0, sizeof(*ptrWriter));
+
+    return bLocStatus;
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
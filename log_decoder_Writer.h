@@ -0,0 +1,67 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Buffered output writer. Decoded rows are formatted without printf (integer-to-ASCII of the          */
+/*                integer and fixed-point decimal fields) into a large buffer owned by the writer, which is           */
+/*                flushed with large write() calls. One writer is used per thread, or per chunk in memory mode.       */
+/*                Once started, a writer thread writes each full buffer while the next one is being formatted.        */
+/*                With "--compress" the buffers are compressed in independent blocks on their way to the file.        */
+/*                                                                                                                    */
+/*  File        : log_decoder_Writer.h                                                                                */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+
+#ifndef LOG_DECODER_WRITER_H
+#define LOG_DECODER_WRITER_H
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include "log_decoder.h"
+#include "log_decoder_Compress.h"
+#include "log_decoder_Pipeline.h"
+
+/**********************************************************************************************************************/
+/* DEFINES                                                                                                            */
+/**********************************************************************************************************************/
+#define WRITER_BUFFER_SIZE              (4U * 1024U * 1024U)
+/* Buffers of a started writer : one is formatted while the other one is written                                      */
+#define WRITER_BUFFERS_NUMBER           2U
+
+/**********************************************************************************************************************/
+/* TYPEDEF                                                                                                            */
+/**********************************************************************************************************************/
+typedef struct
+{
+    char       *ptrBuffer;
+    size_t      u32BufferSize;
+    size_t      u32Used;            /* Number of formatted bytes not yet flushed                              */
+    FILE       *ptrFile;            /* Destination, NULL in memory mode (the caller takes the buffer)         */
+    boolean     bError;             /* TRUE after a failed write or a full buffer in memory mode              */
+    LogDecoder_strStageType  strStage;      /* Writer thread, not started when the formatting thread writes */
+    LogDecoder_strBlockType  astrBlock[WRITER_BUFFERS_NUMBER];  /* Buffers, the first one is the initial one */
+    LogDecoder_strBlockType *ptrBlock;      /* Block of ptrBuffer                                         */
+    LogDecoder_strCompressType strCompress; /* Compressor of the written bytes, closed when not compressed */
+}LogDecoder_strWriterType;
+
+/**********************************************************************************************************************/
+/* GLOBAL FUNCTIONS PROTOTYPES                                                                                        */
+/**********************************************************************************************************************/
+boolean LogDecoder_bWriterOpen(LogDecoder_strWriterType *ptrWriter, FILE *ptrFile, size_t u32BufferSize);
+boolean LogDecoder_bWriterCompress(LogDecoder_strWriterType *ptrWriter);
+uint32 LogDecoder_u32WriterFormatRow(char *ptrBuffer, const LogDecoder_strOutputDataType *ptrOutputData);
+void LogDecoder_vidWriterRow(LogDecoder_strWriterType *ptrWriter, const LogDecoder_strOutputDataType *ptrOutputData);
+void LogDecoder_vidWriterBatch(LogDecoder_strWriterType *ptrWriter, const LogDecoder_strBatchType *ptrBatch);
+void LogDecoder_vidWriterSourceBatch(LogDecoder_strWriterType *ptrWriter, const LogDecoder_strBatchType *ptrBatch,
+                                     const char * const *aptrSource);
+void LogDecoder_vidWriterText(LogDecoder_strWriterType *ptrWriter, const char *ptrText, size_t u32Size);
+boolean LogDecoder_bWriterStart(LogDecoder_strWriterType *ptrWriter);
+boolean LogDecoder_bWriterFlush(LogDecoder_strWriterType *ptrWriter);
+boolean LogDecoder_bWriterClose(LogDecoder_strWriterType *ptrWriter);
+
+#endif /* LOG_DECODER_WRITER_H */
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
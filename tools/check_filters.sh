@@ -0,0 +1,61 @@
+#!/bin/sh
+#######################################################################################################################
+#
+#  Application : Log Decoder
+#  Description : Regression check of the row filters. The output of --ids, --time-range and --only-anomalies must be
+#                the rows of the full decoding which pass the same filter (awk on the full output), with the same
+#                messages, on a clean log and on a log whose malformed row is not selected by the filter. An empty
+#                frame ID in --ids is rejected.
+#
+#    tools/check_filters.sh DECODER GENERATOR DIRECTORY
+#
+#######################################################################################################################
+
+DECODER=$1
+GENERATOR=$2
+DIR=$3
+# Row of the malformed log whose Payload is no longer hex, an ID 78 row so that --ids=15 does not select it
+BAD_ROW=2001
+STATUS=0
+
+mkdir -p "$DIR" || exit 1
+"$GENERATOR" --seed=7 --ids=15:25,78:50 --checksum-errors=20 --drops=5 --jitter=3 10000 "$DIR/clean.csv" || exit 1
+awk -F, -v row=$BAD_ROW 'BEGIN { OFS = "," } NR > row && $1 == 78 && !done { $4 = "zz"; done = 1 } { print }' \
+    "$DIR/clean.csv" > "$DIR/malformed.csv"
+# Timestamp range just after the malformed row, which is then skipped by --time-range
+BAD_TIME=$(awk -F, -v row=$BAD_ROW 'NR > row && $1 == 78 { print $3; exit }' "$DIR/clean.csv")
+FROM=$((BAD_TIME + 1))
+TO=$((BAD_TIME + 2000))
+
+# check LOG NAME "OPTIONS" 'AWK FILTER OF THE FULL OUTPUT ROWS'
+check()
+{
+    "$DECODER" "$1" "$DIR/full.out" > "$DIR/full.msg" 2>&1
+    "$DECODER" $3 "$1" "$DIR/filter.out" > "$DIR/filter.msg" 2>&1
+    awk -F', ' "NR == 1 || ($4)" "$DIR/full.out" > "$DIR/expected.out"
+    if cmp -s "$DIR/filter.out" "$DIR/expected.out" && cmp -s "$DIR/filter.msg" "$DIR/full.msg"; then
+        echo "ok   $2 $3"
+    else
+        echo "FAIL $2 $3"
+        STATUS=1
+    fi
+}
+
+for LOG in clean malformed; do
+    check "$DIR/$LOG.csv" $LOG "--ids=15" '$1 == 15'
+    check "$DIR/$LOG.csv" $LOG "--time-range=$FROM:$TO" "\$3 >= $FROM && \$3 <= $TO"
+    check "$DIR/$LOG.csv" $LOG "--only-anomalies" '$8 == 0 || $9 == 0'
+    check "$DIR/$LOG.csv" $LOG "--ids=15 --only-anomalies" '$1 == 15 && ($8 == 0 || $9 == 0)'
+done
+
+# An empty frame ID is rejected with the help, it does not select ID 0
+for IDS in "--ids=" "--ids=15,,78" "--ids=15,"; do
+    if "$DECODER" $IDS "$DIR/clean.csv" "$DIR/filter.out" | grep -q "^Help Info:"; then
+        echo "ok   rejected $IDS"
+    else
+        echo "FAIL rejected $IDS"
+        STATUS=1
+    fi
+done
+
+exit $STATUS
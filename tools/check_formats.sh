@@ -0,0 +1,59 @@
+#!/bin/sh
+#######################################################################################################################
+#
+#  Application : Log Decoder
+#  Description : Regression check of the file formats. The binary output converted back with bin2csv, the decoding of
+#                a log converted with csv2bin into records, and every output written with --compress then read back
+#                with the decompress command must all give the rows of the plain csv decoding, byte for byte.
+#
+#    tools/check_formats.sh DECODER GENERATOR DIRECTORY
+#
+#######################################################################################################################
+
+DECODER=$1
+GENERATOR=$2
+DIR=$3
+STATUS=0
+
+mkdir -p "$DIR" || exit 1
+"$GENERATOR" --seed=7 --ids=15:25,78:50 --checksum-errors=5 --drops=5 --jitter=3 100000 "$DIR/formats.csv" || exit 1
+"$DECODER" "$DIR/formats.csv" "$DIR/formats.out" > /dev/null 2>&1
+"$DECODER" --summary "$DIR/formats.csv" "$DIR/summary.out" > /dev/null 2>&1
+
+# check NAME ACTUAL EXPECTED
+check()
+{
+    if cmp -s "$2" "$3"; then
+        echo "ok   $1"
+    else
+        echo "FAIL $1"
+        STATUS=1
+    fi
+}
+
+"$DECODER" --output-format=bin "$DIR/formats.csv" "$DIR/formats.bin" > /dev/null 2>&1
+"$DECODER" bin2csv "$DIR/formats.bin" "$DIR/bin2csv.out" > /dev/null 2>&1
+check "bin2csv" "$DIR/bin2csv.out" "$DIR/formats.out"
+
+"$DECODER" csv2bin "$DIR/formats.csv" "$DIR/formats.rec" > /dev/null 2>&1
+"$DECODER" "$DIR/formats.rec" "$DIR/rec.out" > /dev/null 2>&1
+check "csv2bin records" "$DIR/rec.out" "$DIR/formats.out"
+"$DECODER" -j 3 "$DIR/formats.rec" "$DIR/rec.out" > /dev/null 2>&1
+check "csv2bin records -j 3" "$DIR/rec.out" "$DIR/formats.out"
+"$DECODER" --summary "$DIR/formats.rec" "$DIR/rec.out" > /dev/null 2>&1
+check "csv2bin records --summary" "$DIR/rec.out" "$DIR/summary.out"
+
+"$DECODER" --compress "$DIR/formats.csv" "$DIR/compress.ldz" > /dev/null 2>&1
+"$DECODER" decompress "$DIR/compress.ldz" "$DIR/compress.out" > /dev/null 2>&1
+check "compress" "$DIR/compress.out" "$DIR/formats.out"
+"$DECODER" --compress -j 3 "$DIR/formats.csv" "$DIR/compress.ldz" > /dev/null 2>&1
+"$DECODER" decompress "$DIR/compress.ldz" "$DIR/compress.out" > /dev/null 2>&1
+check "compress -j 3" "$DIR/compress.out" "$DIR/formats.out"
+"$DECODER" --compress --output-format=bin "$DIR/formats.csv" "$DIR/compress.ldz" > /dev/null 2>&1
+"$DECODER" decompress "$DIR/compress.ldz" "$DIR/compress.out" > /dev/null 2>&1
+check "compress --output-format=bin" "$DIR/compress.out" "$DIR/formats.bin"
+"$DECODER" --compress --summary "$DIR/formats.csv" "$DIR/compress.ldz" > /dev/null 2>&1
+"$DECODER" decompress "$DIR/compress.ldz" "$DIR/compress.out" > /dev/null 2>&1
+check "compress --summary" "$DIR/compress.out" "$DIR/summary.out"
+
+exit $STATUS
@@ -0,0 +1,41 @@
+#!/bin/sh
+#######################################################################################################################
+#
+#  Application : Log Decoder
+#  Description : Equivalence check of the batch kernels. The SSE2 and AVX2 kernels must give the output of the scalar
+#                kernel, byte for byte, with the built-in frames and with the schema file. A level the CPU does not
+#                support runs on the best level it has.
+#
+#    tools/check_kernels.sh DECODER GENERATOR DIRECTORY
+#
+#######################################################################################################################
+
+DECODER=$1
+GENERATOR=$2
+DIR=$3
+STATUS=0
+
+mkdir -p "$DIR" || exit 1
+# A row count which is not a multiple of the vector lanes nor of the tiles, so that every tail is decoded too
+"$GENERATOR" --seed=11 --ids=15:25,78:50 --checksum-errors=50 --drops=5 --jitter=3 100003 "$DIR/kernels.csv" || exit 1
+
+# check NAME "OPTIONS"
+check()
+{
+    "$DECODER" --kernel=scalar $2 "$DIR/kernels.csv" "$DIR/scalar.out" > "$DIR/scalar.msg" 2>&1
+    for LEVEL in sse2 avx2; do
+        "$DECODER" --kernel=$LEVEL $2 "$DIR/kernels.csv" "$DIR/$LEVEL.out" > "$DIR/$LEVEL.msg" 2>&1
+        if cmp -s "$DIR/$LEVEL.out" "$DIR/scalar.out" && cmp -s "$DIR/$LEVEL.msg" "$DIR/scalar.msg"; then
+            echo "ok   $LEVEL $1"
+        else
+            echo "FAIL $LEVEL $1"
+            STATUS=1
+        fi
+    done
+}
+
+check "built-in frames" ""
+check "schema file" "--schema log_decoder.schema"
+check "summary" "--summary"
+
+exit $STATUS
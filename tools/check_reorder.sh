@@ -0,0 +1,63 @@
+#!/bin/sh
+#######################################################################################################################
+#
+#  Application : Log Decoder
+#  Description : Regression check of the frames received out of FrameNb order. A late or repeated frame adds no drop
+#                and the next frames are still counted from the largest FrameNb, in the rows, the --stats counter, the
+#                --summary totals and a --merge of two channels. With --reorder-window the frames come out in FrameNb
+#                order and a log with swapped frames decodes to the rows of the log without them.
+#
+#    tools/check_reorder.sh DECODER GENERATOR DIRECTORY
+#
+#######################################################################################################################
+
+DECODER=$1
+GENERATOR=$2
+DIR=$3
+HEADER='ID,FrameNb,Timestamp,Payload,Checksum'
+STATUS=0
+
+mkdir -p "$DIR/channels" || exit 1
+# Frames 2 and 3 of ID 15 swapped : frame 3 counts the drop of frame 2, the late frame 2 adds none
+printf '%s\n' "$HEADER" 15,0,0,0f76417f,bb 15,1,26,401acb88,53 15,3,75,10081148,8f 15,2,51,772407ef,6f \
+    15,4,99,870c8647,a0 15,5,125,1e52d880,38 > "$DIR/late.csv"
+# Frames 2 and 3 delivered late on a second channel : frame 4 counts two drops, the late frames add none
+printf '%s\n' "$HEADER" 15,0,0,0f76417f,bb 15,1,26,401acb88,53 15,4,99,870c8647,a0 15,5,125,1e52d880,38 \
+    > "$DIR/channels/a.csv"
+printf '%s\n' "$HEADER" 15,2,110,772407ef,6f 15,3,115,10081148,8f > "$DIR/channels/b.csv"
+"$GENERATOR" --seed=5 --ids=15:25,78:50 --checksum-errors=5 --drops=5 --jitter=3 20000 "$DIR/ordered.csv" || exit 1
+# One frame of ID 15 out of three received after the next one
+awk -F, '$1 == 15 && (++n % 3) == 1 { held = $0; next } { print } held != "" && $1 == 15 { print held; held = "" }
+         END { if (held != "") print held }' "$DIR/ordered.csv" > "$DIR/swapped.csv"
+
+# check NAME ACTUAL EXPECTED
+check()
+{
+    if [ "$2" = "$3" ]; then
+        echo "ok   $1"
+    else
+        echo "FAIL $1 : $2 instead of $3"
+        STATUS=1
+    fi
+}
+
+"$DECODER" --stats "$DIR/late.csv" "$DIR/late.out" > "$DIR/late.msg" 2>&1
+check "late frame FrameDropCnt" "$(awk -F', ' 'NR > 1 { printf "%s ", $NF }' "$DIR/late.out")" "0 0 1 1 1 1 "
+check "late frame --stats" "$(awk '/frame drops/ { print $3 }' "$DIR/late.msg")" "1"
+"$DECODER" --summary "$DIR/late.csv" "$DIR/summary.out" > /dev/null 2>&1
+check "late frame --summary" "$(awk -F, 'NR == 2 { print $5, $6, $7 }' "$DIR/summary.out")" "1 26 49"
+"$DECODER" --merge "$DIR/channels" "$DIR/merged.out" > /dev/null 2>&1
+check "late channel --merge" "$(awk -F', ' 'NR > 1 { printf "%s ", $NF }' "$DIR/merged.out")" "0 0 2 2 2 2 "
+"$DECODER" --reorder-window=50 "$DIR/late.csv" "$DIR/window.out" > /dev/null 2>&1
+check "late frame --reorder-window FrameNb" "$(awk -F', ' 'NR > 1 { printf "%s ", $2 }' "$DIR/window.out")" \
+    "0 1 2 3 4 5 "
+check "late frame --reorder-window FrameDropCnt" "$(awk -F', ' 'NR > 1 { printf "%s ", $NF }' "$DIR/window.out")" \
+    "0 0 0 0 0 0 "
+"$DECODER" "$DIR/ordered.csv" "$DIR/ordered.out" > /dev/null 2>&1
+"$DECODER" --reorder-window=60 "$DIR/swapped.csv" "$DIR/swapped.out" > /dev/null 2>&1
+for ID in 15 78; do
+    check "swapped log --reorder-window ID $ID" "$(grep "^$ID," "$DIR/swapped.out" | cksum)" \
+        "$(grep "^$ID," "$DIR/ordered.out" | cksum)"
+done
+
+exit $STATUS
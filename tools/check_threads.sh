@@ -0,0 +1,64 @@
+#!/bin/sh
+#######################################################################################################################
+#
+#  Application : Log Decoder
+#  Description : Regression check of the multi-threaded decoding. The output of -j N must be byte-identical to the
+#                serial output, for the csv and --summary outputs, with --wrap16, and on a log whose frames are
+#                received out of FrameNb order. The blocks of the binary output follow the split, its rows converted
+#                back with bin2csv must be the serial ones. The logs are larger than three chunks of the split.
+#
+#    tools/check_threads.sh DECODER GENERATOR DIRECTORY
+#
+#######################################################################################################################
+
+DECODER=$1
+GENERATOR=$2
+DIR=$3
+ROWS=1000000
+STATUS=0
+
+mkdir -p "$DIR" || exit 1
+"$GENERATOR" --seed=3 --ids=15:25,78:50 --checksum-errors=5 --drops=5 --jitter=3 $ROWS "$DIR/threads.csv" || exit 1
+# Same log from a source with 16-bit counters
+awk -F, 'BEGIN { OFS = "," } NR > 1 { $2 = $2 % 65536; $3 = $3 % 65536 } { print }' \
+    "$DIR/threads.csv" > "$DIR/wrap16.csv"
+# One frame of ID 15 out of three received after the next one
+awk -F, '$1 == 15 && (++n % 3) == 1 { held = $0; next } { print } held != "" && $1 == 15 { print held; held = "" }
+         END { if (held != "") print held }' "$DIR/threads.csv" > "$DIR/late.csv"
+
+# decode OUTPUT OPTIONS... : decode to OUTPUT, the binary output converted back to csv
+decode()
+{
+    OUTPUT=$1
+    shift
+    case "$*" in
+        *--output-format=bin*)
+            "$DECODER" "$@" "$OUTPUT.bin" && "$DECODER" bin2csv "$OUTPUT.bin" "$OUTPUT" ;;
+        *)
+            "$DECODER" "$@" "$OUTPUT" ;;
+    esac
+}
+
+# check LOG "OPTIONS"
+check()
+{
+    decode "$DIR/serial.out" $2 "$DIR/$1.csv" > "$DIR/serial.msg" 2>&1
+    for THREADS in 2 3 8; do
+        decode "$DIR/threads.out" -j $THREADS $2 "$DIR/$1.csv" > "$DIR/threads.msg" 2>&1
+        if cmp -s "$DIR/threads.out" "$DIR/serial.out" && cmp -s "$DIR/threads.msg" "$DIR/serial.msg"; then
+            echo "ok   -j $THREADS $1 $2"
+        else
+            echo "FAIL -j $THREADS $1 $2"
+            STATUS=1
+        fi
+    done
+}
+
+check threads ""
+check threads "--output-format=bin"
+check threads "--summary"
+check wrap16 "--wrap16"
+check late ""
+check late "--summary"
+
+exit $STATUS
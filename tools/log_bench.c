@@ -0,0 +1,371 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Throughput benchmark. Runs the decoder on one input log in each of its modes and reports the        */
+/*                elapsed time, rows/s, MB/s and peak resident memory of every run. POSIX only, the decoder is run    */
+/*                as a child process so that its peak memory is measured alone.                                       */
+/*                                                                                                                    */
+/*  File        : log_bench.c                                                                                         */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogBench_u64CountRows                                                                                          */
+/* 2 / LogBench_vidStageArgs                                                                                          */
+/* 3 / LogBench_bRunStage                                                                                             */
+/* 4 / LogBench_vidMainFunction                                                                                       */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+/* wait4() is not part of POSIX, it is the only way to get the peak memory of a single child                          */
+#define _DEFAULT_SOURCE
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include "log_decoder_Types.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define BENCH_BLOCK_SIZE                 (1024U * 1024U)
+#define BENCH_MAX_ARGS_NUMBER            8U
+#define BENCH_THREADS_LENGTH             8U
+#define BENCH_PATH_LENGTH                4096U
+#define BENCH_CSV_SUFFIX                 ".bench.csv"
+#define BENCH_BIN_SUFFIX                 ".bench.bin"
+#define BENCH_REC_SUFFIX                 ".bench.rec"
+#define BENCH_NULL_DEVICE                "/dev/null"
+#define BENCH_BYTES_PER_MB               (1024.0 * 1024.0)
+#ifdef __APPLE__
+/* ru_maxrss is given in bytes on macOS, in kilobytes elsewhere                                                       */
+#define BENCH_MAXRSS_PER_MB              (1024.0 * 1024.0)
+#else
+#define BENCH_MAXRSS_PER_MB              1024.0
+#endif
+
+#define BENCH_STAGE_CSV                  0U
+#define BENCH_STAGE_PARALLEL_CSV         1U
+#define BENCH_STAGE_BIN                  2U
+#define BENCH_STAGE_BIN2CSV              3U
+#define BENCH_STAGE_CSV2BIN              4U
+#define BENCH_STAGE_REC                  5U
+#define BENCH_STAGE_PIPE                 6U
+#define BENCH_STAGES_NUMBER              7U
+
+/**********************************************************************************************************************/
+/* LOCAL TYPEDEF                                                                                                      */
+/**********************************************************************************************************************/
+typedef struct
+{
+    double f64Seconds;
+    double f64PeakRssMb;
+}LogBench_strResultType;
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+static const char * const LogBench_aptrStageName[BENCH_STAGES_NUMBER] =
+{
+    "csv",
+    "csv -j",
+    "bin",
+    "bin2csv",
+    "csv2bin",
+    "rec",
+    "pipe - -"
+};
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static uint64 LogBench_u64CountRows(const char *ptrPath, uint64 *ptrBytesNb);
+static void LogBench_vidStageArgs(uint32 u32Stage, char **ptrArgs, char *ptrDecoder, char *ptrInput,
+                                  char *ptrCsvPath, char *ptrBinPath, char *ptrRecPath, char *ptrThreads);
+static boolean LogBench_bRunStage(uint32 u32Stage, char **ptrArgs, const char *ptrInput,
+                                  LogBench_strResultType *ptrResult);
+static void LogBench_vidMainFunction(int s32NumOfArg, char **ptrMainArgs);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogBench_u64CountRows                                                                               */
+/* !Description : Count the frame rows of the input log, the read also puts it in the page cache so that all the      */
+/*                runs start from the same state                                                                      */
+/*                                                                                                                    */
+/* !Inputs      : ptrPath                       !Comment : Input log                                                  */
+/* !Outputs     : ptrBytesNb                    !Comment : Size of the input log                                      */
+/*                u64LocRowsNb                  !Comment : Number of rows after the header                            */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint64 LogBench_u64CountRows(const char *ptrPath, uint64 *ptrBytesNb)
+{
+    FILE   *ptrLocFile = fopen(ptrPath, "rb");
+    char   *ptrLocBlock = malloc(BENCH_BLOCK_SIZE);
+    uint64  u64LocLinesNb = FALSE;
+    size_t  u32LocReadSize = FALSE;
+    size_t  u32LocIndex = FALSE;
+
+    *ptrBytesNb = FALSE;
+    if((ptrLocFile != NULL) && (ptrLocBlock != NULL))
+    {
+        while((u32LocReadSize = fread(ptrLocBlock, 1U, BENCH_BLOCK_SIZE, ptrLocFile)) != 0U)
+        {
+            for(u32LocIndex = 0U; u32LocIndex < u32LocReadSize; u32LocIndex++)
+            {
+                u64LocLinesNb += (uint64)(ptrLocBlock[u32LocIndex] == '\n');
+            }
+            *ptrBytesNb += u32LocReadSize;
+        }
+    }
+    if(ptrLocFile != NULL)
+    {
+        fclose(ptrLocFile);
+    }
+    free(ptrLocBlock);
+
+    return (u64LocLinesNb != 0U) ? (u64LocLinesNb - 1U) : 0U;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogBench_vidStageArgs                                                                               */
+/* !Description : Command line of the decoder for one stage of the benchmark                                          */
+/*                                                                                                                    */
+/* !Inputs      : u32Stage                      !Comment : BENCH_STAGE_xxx                                            */
+/*                ptrDecoder                    !Comment : Path of the decoder                                        */
+/*                ptrInput                      !Comment : Input log                                                  */
+/*                ptrCsvPath                    !Comment : .csv output of the stages                                  */
+/*                ptrBinPath                    !Comment : Binary output of the "bin" stage                           */
+/*                ptrRecPath                    !Comment : Record file of the "csv2bin" stage, input of "rec"         */
+/*                ptrThreads                    !Comment : Number of threads of the parallel stage, as text           */
+/* !Outputs     : ptrArgs                       !Comment : NULL terminated arguments                                  */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogBench_vidStageArgs(uint32 u32Stage, char **ptrArgs, char *ptrDecoder, char *ptrInput,
+                                  char *ptrCsvPath, char *ptrBinPath, char *ptrRecPath, char *ptrThreads)
+{
+    uint32 u32LocArgsNb = FALSE;
+
+    ptrArgs[u32LocArgsNb++] = ptrDecoder;
+    switch(u32Stage)
+    {
+        case BENCH_STAGE_PARALLEL_CSV:
+            ptrArgs[u32LocArgsNb++] = "-j";
+            ptrArgs[u32LocArgsNb++] = ptrThreads;
+            ptrArgs[u32LocArgsNb++] = ptrInput;
+            ptrArgs[u32LocArgsNb++] = ptrCsvPath;
+            break;
+        case BENCH_STAGE_BIN:
+            ptrArgs[u32LocArgsNb++] = "--output-format=bin";
+            ptrArgs[u32LocArgsNb++] = ptrInput;
+            ptrArgs[u32LocArgsNb++] = ptrBinPath;
+            break;
+        case BENCH_STAGE_BIN2CSV:
+            ptrArgs[u32LocArgsNb++] = "bin2csv";
+            ptrArgs[u32LocArgsNb++] = ptrBinPath;
+            ptrArgs[u32LocArgsNb++] = ptrCsvPath;
+            break;
+        case BENCH_STAGE_CSV2BIN:
+            ptrArgs[u32LocArgsNb++] = "csv2bin";
+            ptrArgs[u32LocArgsNb++] = ptrInput;
+            ptrArgs[u32LocArgsNb++] = ptrRecPath;
+            break;
+        case BENCH_STAGE_REC:
+            ptrArgs[u32LocArgsNb++] = ptrRecPath;
+            ptrArgs[u32LocArgsNb++] = ptrCsvPath;
+            break;
+        case BENCH_STAGE_PIPE:
+            /* The input is written to the pipe by the benchmark, the output goes to stdout       */
+            ptrArgs[u32LocArgsNb++] = "-";
+            ptrArgs[u32LocArgsNb++] = "-";
+            break;
+        default:
+            ptrArgs[u32LocArgsNb++] = ptrInput;
+            ptrArgs[u32LocArgsNb++] = ptrCsvPath;
+            break;
+    }
+    ptrArgs[u32LocArgsNb] = NULL;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogBench_bRunStage                                                                                  */
+/* !Description : Run the decoder once and measure it. The messages and the stdout output are discarded, in the pipe  */
+/*                stage the input log is copied to the decoder stdin by this process.                                 */
+/*                                                                                                                    */
+/* !Inputs      : u32Stage                      !Comment : BENCH_STAGE_xxx                                            */
+/*                ptrArgs                       !Comment : Command line of the decoder                                */
+/*                ptrInput                      !Comment : Input log, for the pipe stage                              */
+/* !Outputs     : ptrResult                     !Comment : Elapsed time and peak memory of the decoder                */
+/*                bLocStatus                    !Comment : FALSE if the decoder could not be run                      */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogBench_bRunStage(uint32 u32Stage, char **ptrArgs, const char *ptrInput,
+                                  LogBench_strResultType *ptrResult)
+{
+    boolean bLocStatus = FALSE;
+    struct timespec strLocStart;
+    struct timespec strLocEnd;
+    struct rusage strLocUsage;
+    int    as32LocPipe[2] = {-1, -1};
+    int    s32LocNull = -1;
+    int    s32LocStatus = 0;
+    pid_t  s32LocChild = -1;
+    FILE  *ptrLocFile = NULL;
+    char  *ptrLocBlock = NULL;
+    size_t u32LocReadSize = FALSE;
+
+    if((u32Stage == BENCH_STAGE_PIPE) && (pipe(as32LocPipe) != 0))
+    {
+        return FALSE;
+    }
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &strLocStart);
+    s32LocChild = fork();
+    if(s32LocChild == 0)
+    {
+        s32LocNull = open(BENCH_NULL_DEVICE, O_WRONLY);
+        (void)dup2(s32LocNull, STDOUT_FILENO);
+        if(u32Stage == BENCH_STAGE_PIPE)
+        {
+            (void)dup2(as32LocPipe[0], STDIN_FILENO);
+            (void)close(as32LocPipe[0]);
+            (void)close(as32LocPipe[1]);
+            (void)dup2(s32LocNull, STDERR_FILENO);
+        }
+        (void)signal(SIGPIPE, SIG_DFL);
+        (void)execv(ptrArgs[0], ptrArgs);
+        _exit(127);
+    }
+    else if(s32LocChild > 0)
+    {
+        if(u32Stage == BENCH_STAGE_PIPE)
+        {
+            /* Feed the pipe, a write blocks while the decoder is slower than the copy            */
+            (void)close(as32LocPipe[0]);
+            ptrLocFile  = fopen(ptrInput, "rb");
+            ptrLocBlock = malloc(BENCH_BLOCK_SIZE);
+            while(  (ptrLocFile != NULL) && (ptrLocBlock != NULL)
+                 && ((u32LocReadSize = fread(ptrLocBlock, 1U, BENCH_BLOCK_SIZE, ptrLocFile)) != 0U)
+                 && (write(as32LocPipe[1], ptrLocBlock, u32LocReadSize) == (ssize_t)u32LocReadSize) )
+            {
+            }
+            (void)close(as32LocPipe[1]);
+            if(ptrLocFile != NULL)
+            {
+                fclose(ptrLocFile);
+            }
+            free(ptrLocBlock);
+        }
+        bLocStatus = (boolean)(  (wait4(s32LocChild, &s32LocStatus, 0, &strLocUsage) == s32LocChild)
+                              && (WIFEXITED(s32LocStatus)) && (WEXITSTATUS(s32LocStatus) == 0) );
+        (void)clock_gettime(CLOCK_MONOTONIC, &strLocEnd);
+        ptrResult->f64Seconds   = (double)(strLocEnd.tv_sec - strLocStart.tv_sec)
+                                + ((double)(strLocEnd.tv_nsec - strLocStart.tv_nsec) / 1e9);
+        ptrResult->f64PeakRssMb = (double)strLocUsage.ru_maxrss / BENCH_MAXRSS_PER_MB;
+    }
+    else
+    {
+        /* The decoder cannot be started                                                          */
+    }
+
+    return bLocStatus;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogBench_vidMainFunction                                                                            */
+/* !Description : Run all the stages on the input log and print one line of results per stage                         */
+/*                                                                                                                    */
+/* !Inputs      : s32NumOfArg                   !Comment : Number of main arguments                                   */
+/*                ptrMainArgs                   !Comment : "log_bench DECODER INPUT [THREADS]"                        */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogBench_vidMainFunction(int s32NumOfArg, char **ptrMainArgs)
+{
+    LogBench_strResultType strLocResult;
+    char   *aptrLocArgs[BENCH_MAX_ARGS_NUMBER];
+    char    acLocCsvPath[BENCH_PATH_LENGTH];
+    char    acLocBinPath[BENCH_PATH_LENGTH];
+    char    acLocRecPath[BENCH_PATH_LENGTH];
+    char    acLocThreads[BENCH_THREADS_LENGTH];
+    uint64  u64LocRowsNb = FALSE;
+    uint64  u64LocBytesNb = FALSE;
+    uint32  u32LocStage = FALSE;
+    long    s32LocThreadsNb = 4L;
+
+    if((s32NumOfArg != 3) && (s32NumOfArg != 4))
+    {
+        printf("Help Info:\n"
+            "\tlog_bench DECODER INPUT [THREADS]\n"
+            "\tRuns DECODER on INPUT in each mode (csv, csv -j THREADS, bin, bin2csv, csv2bin, rec, pipe)\n"
+            "\tand reports the elapsed time, rows/s, MB/s of input and peak resident memory of each run\n");
+        return;
+    }
+    if(s32NumOfArg == 4)
+    {
+        s32LocThreadsNb = strtol(ptrMainArgs[3], NULL, 10);
+    }
+    (void)snprintf(acLocThreads, sizeof(acLocThreads), "%ld", s32LocThreadsNb);
+    (void)snprintf(acLocCsvPath, sizeof(acLocCsvPath), "%s" BENCH_CSV_SUFFIX, ptrMainArgs[2]);
+    (void)snprintf(acLocBinPath, sizeof(acLocBinPath), "%s" BENCH_BIN_SUFFIX, ptrMainArgs[2]);
+    (void)snprintf(acLocRecPath, sizeof(acLocRecPath), "%s" BENCH_REC_SUFFIX, ptrMainArgs[2]);
+    /* A decoder exiting early in the pipe stage must not end the benchmark                       */
+    (void)signal(SIGPIPE, SIG_IGN);
+
+    u64LocRowsNb = LogBench_u64CountRows(ptrMainArgs[2], &u64LocBytesNb);
+    printf("%s : %llu rows, %.1f MB\n", ptrMainArgs[2], u64LocRowsNb, (double)u64LocBytesNb / BENCH_BYTES_PER_MB);
+    printf("%-12s %10s %14s %10s %14s\n", "stage", "seconds", "rows/s", "MB/s", "peak RSS MB");
+
+    for(u32LocStage = 0U; u32LocStage < BENCH_STAGES_NUMBER; u32LocStage++)
+    {
+        LogBench_vidStageArgs(u32LocStage, aptrLocArgs, ptrMainArgs[1], ptrMainArgs[2], acLocCsvPath, acLocBinPath,
+                              acLocRecPath, acLocThreads);
+        if(LogBench_bRunStage(u32LocStage, aptrLocArgs, ptrMainArgs[2], &strLocResult) == FALSE)
+        {
+            printf("%-12s failed\n", LogBench_aptrStageName[u32LocStage]);
+        }
+        else
+        {
+            printf("%-12s %10.3f %14.0f %10.1f %14.1f\n", LogBench_aptrStageName[u32LocStage],
+                   strLocResult.f64Seconds, (double)u64LocRowsNb / strLocResult.f64Seconds,
+                   (double)u64LocBytesNb / BENCH_BYTES_PER_MB / strLocResult.f64Seconds,
+                   strLocResult.f64PeakRssMb);
+        }
+        (void)fflush(stdout);
+    }
+
+    (void)remove(acLocCsvPath);
+    (void)remove(acLocBinPath);
+    (void)remove(acLocRecPath);
+}
+
+/**********************************************************************************************************************/
+/* APPLICATION MAIN FUNCTION                                                                                          */
+/**********************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    LogBench_vidMainFunction(argc, argv);
+    return 0;
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/
@@ -0,0 +1,415 @@
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/*  Application : Log Decoder                                                                                         */
+/*  Description : Synthetic input log generator. Writes N rows of valid frames in the HEADER_FOR_INPUT_FILE format,   */
+/*                each frame ID sent at its own period, with injected checksum errors, frame drops and timing         */
+/*                jitter. The same seed and options always give the same file.                                        */
+/*                                                                                                                    */
+/*  File        : log_generator.c                                                                                     */
+/*                                                                                                                    */
+/*  Author      : agent                                                                                               */
+/*                                                                                                                    */
+/*  Date        : 17/10/2026                                                                                          */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+/* 1 / LogGenerator_u64Random                                                                                         */
+/* 2 / LogGenerator_u32RandomBelow                                                                                    */
+/* 3 / LogGenerator_bParseIds                                                                                         */
+/* 4 / LogGenerator_u32FormatUnsigned                                                                                 */
+/* 5 / LogGenerator_u32FormatRow                                                                                      */
+/* 6 / LogGenerator_vidMainFunction                                                                                   */
+/**********************************************************************************************************************/
+
+/**********************************************************************************************************************/
+/* INCLUDES                                                                                                           */
+/**********************************************************************************************************************/
+#include <stdlib.h>
+#include "log_decoder.h"
+
+/**********************************************************************************************************************/
+/* LOCAL DEFINES                                                                                                      */
+/**********************************************************************************************************************/
+#define FALSE                            0U
+#define TRUE                             1U
+#define GENERATOR_MAX_SOURCES            16U
+#define GENERATOR_BUFFER_SIZE            (1024U * 1024U)
+#define GENERATOR_ROW_MAX_LENGTH         64U
+#define GENERATOR_RATE_SCALE             1000U
+#define GENERATOR_DEFAULT_IDS            "15:25,78:50"
+#define GENERATOR_DEFAULT_SEED           1U
+#define GENERATOR_DEFAULT_JITTER         1U
+#define GENERATOR_STDOUT_PATH            "-"
+#define OPTION_SEED                      "--seed="
+#define OPTION_IDS                       "--ids="
+#define OPTION_CHECKSUM_ERRORS           "--checksum-errors="
+#define OPTION_DROPS                     "--drops="
+#define OPTION_JITTER                    "--jitter="
+#define DECIMAL_BASE                     10U
+#define UINT64_MAX_DIGITS_NUMBER         20U
+#define PAYLOAD_BYTES_NUMBER             4U
+
+/**********************************************************************************************************************/
+/* LOCAL TYPEDEF                                                                                                      */
+/**********************************************************************************************************************/
+typedef struct
+{
+    uint8  u8Id;
+    uint32 u32Period;               /* Nominal time between two frames of this ID, in ms                          */
+    uint64 u64NextTime;             /* Nominal time of the next frame, the jitter is added when it is written    */
+    uint64 u64FrameNb;
+}LogGenerator_strSourceType;
+
+/**********************************************************************************************************************/
+/* LOCAL VARIABLES                                                                                                    */
+/**********************************************************************************************************************/
+static const char LogGenerator_acHexDigits[] = "0123456789abcdef";
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS PROTOTYPES                                                                                         */
+/**********************************************************************************************************************/
+static uint64 LogGenerator_u64Random(uint64 *ptrState);
+static uint32 LogGenerator_u32RandomBelow(uint64 *ptrState, uint32 u32Bound);
+static boolean LogGenerator_bParseIds(const char *ptrText, LogGenerator_strSourceType *ptrSources,
+                                      uint32 *ptrSourcesNb);
+static uint32 LogGenerator_u32FormatUnsigned(char *ptrBuffer, uint64 u64Value);
+static uint32 LogGenerator_u32FormatRow(char *ptrBuffer, const LogGenerator_strSourceType *ptrSource,
+                                        uint64 u64Timestamp, uint32p u32Payload, uint8 u8Checksum);
+static void LogGenerator_vidMainFunction(int s32NumOfArg, char **ptrMainArgs);
+
+/**********************************************************************************************************************/
+/* LOCAL FUNCTIONS DEFINITION                                                                                         */
+/**********************************************************************************************************************/
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogGenerator_u64Random                                                                              */
+/* !Description : Next value of a xorshift64* generator, the same on every platform for a given seed                  */
+/*                                                                                                                    */
+/* !Inputs      : ptrState                      !Comment : Generator state, never 0                                   */
+/* !Outputs     : u64LocValue                   !Comment : Pseudo random value                                        */
+/* !Number      : 1                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint64 LogGenerator_u64Random(uint64 *ptrState)
+{
+    uint64 u64LocValue = *ptrState;
+
+    u64LocValue ^= u64LocValue >> 12U;
+    u64LocValue ^= u64LocValue << 25U;
+    u64LocValue ^= u64LocValue >> 27U;
+    *ptrState = u64LocValue;
+
+    return u64LocValue * 0x2545F4914F6CDD1DULL;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogGenerator_u32RandomBelow                                                                         */
+/* !Description : Pseudo random value in [0, u32Bound)                                                                */
+/*                                                                                                                    */
+/* !Inputs      : ptrState                      !Comment : Generator state                                            */
+/*                u32Bound                      !Comment : Number of possible values, not 0                           */
+/* !Outputs     : u32LocValue                   !Comment : Pseudo random value                                        */
+/* !Number      : 2                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint32 LogGenerator_u32RandomBelow(uint64 *ptrState, uint32 u32Bound)
+{
+    uint32 u32LocValue = (uint32)((LogGenerator_u64Random(ptrState) >> 32U) % u32Bound);
+
+    return u32LocValue;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogGenerator_bParseIds                                                                              */
+/* !Description : Parse the frame IDs mix "ID:PERIOD[,ID:PERIOD...]", the period in ms sets how often each ID is      */
+/*                sent. An ID without frame definition gives invalid frames.                                          */
+/*                                                                                                                    */
+/* !Inputs      : ptrText                       !Comment : Text of the "--ids=" option                                */
+/* !Outputs     : ptrSources                    !Comment : One source per ID, starting at time 0 and frame 0          */
+/*                ptrSourcesNb                  !Comment : Number of sources                                          */
+/*                bLocStatus                    !Comment : FALSE if the text is malformed                             */
+/*                                              !Range   : TRUE, FALSE                                                */
+/* !Number      : 3                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static boolean LogGenerator_bParseIds(const char *ptrText, LogGenerator_strSourceType *ptrSources,
+                                      uint32 *ptrSourcesNb)
+{
+    boolean bLocStatus = TRUE;
+    char   *ptrLocEnd = NULL;
+    uint32  u32LocId = FALSE;
+    uint32  u32LocPeriod = FALSE;
+
+    *ptrSourcesNb = FALSE;
+    while((bLocStatus == TRUE) && (*ptrText != '\0'))
+    {
+        u32LocId = strtoul(ptrText, &ptrLocEnd, DECIMAL_BASE);
+        bLocStatus = (boolean)((ptrLocEnd != ptrText) && (*ptrLocEnd == ':') && (u32LocId < FRAME_IDS_NUMBER)
+                              && (*ptrSourcesNb < GENERATOR_MAX_SOURCES));
+        if(bLocStatus == TRUE)
+        {
+            ptrText = ptrLocEnd + 1;
+            u32LocPeriod = strtoul(ptrText, &ptrLocEnd, DECIMAL_BASE);
+            bLocStatus = (boolean)(  (ptrLocEnd != ptrText) && (u32LocPeriod != 0U)
+                                  && ((*ptrLocEnd == ',') || (*ptrLocEnd == '\0')) );
+        }
+        if(bLocStatus == TRUE)
+        {
+            ptrSources[*ptrSourcesNb].u8Id        = (uint8)u32LocId;
+            ptrSources[*ptrSourcesNb].u32Period   = u32LocPeriod;
+            ptrSources[*ptrSourcesNb].u64NextTime = FALSE;
+            ptrSources[*ptrSourcesNb].u64FrameNb  = FALSE;
+            (*ptrSourcesNb)++;
+            ptrText = (*ptrLocEnd == ',') ? (ptrLocEnd + 1) : ptrLocEnd;
+        }
+    }
+
+    return (boolean)((bLocStatus == TRUE) && (*ptrSourcesNb != 0U));
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogGenerator_u32FormatUnsigned                                                                      */
+/* !Description : Write the decimal digits of an unsigned value, without terminating null character                   */
+/*                                                                                                                    */
+/* !Inputs      : u64Value                      !Comment : Value to be written                                        */
+/* !Outputs     : ptrBuffer                     !Comment : Destination of the digits                                  */
+/*                u32LocLength                  !Comment : Number of written characters                               */
+/* !Number      : 4                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint32 LogGenerator_u32FormatUnsigned(char *ptrBuffer, uint64 u64Value)
+{
+    char   acLocDigits[UINT64_MAX_DIGITS_NUMBER];
+    uint32 u32LocLength = FALSE;
+    uint32 u32LocIndex = FALSE;
+
+    do
+    {
+        acLocDigits[u32LocLength] = (char)('0' + (u64Value % DECIMAL_BASE));
+        u64Value /= DECIMAL_BASE;
+        u32LocLength++;
+    } while(u64Value != 0U);
+
+    for(u32LocIndex = 0U; u32LocIndex < u32LocLength; u32LocIndex++)
+    {
+        ptrBuffer[u32LocIndex] = acLocDigits[u32LocLength - 1U - u32LocIndex];
+    }
+
+    return u32LocLength;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogGenerator_u32FormatRow                                                                           */
+/* !Description : Write one input row "ID,FrameNb,Timestamp,Payload,Checksum\n"                                       */
+/*                                                                                                                    */
+/* !Inputs      : ptrSource                     !Comment : Source of the frame, with its ID and frame number          */
+/*                u64Timestamp                  !Comment : Timestamp of the frame, jitter included                    */
+/*                u32Payload                    !Comment : Payload of the frame                                       */
+/*                u8Checksum                    !Comment : Checksum of the frame                                      */
+/* !Outputs     : ptrBuffer                     !Comment : At least GENERATOR_ROW_MAX_LENGTH free characters          */
+/*                u32LocLength                  !Comment : Number of written characters                               */
+/* !Number      : 5                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static uint32 LogGenerator_u32FormatRow(char *ptrBuffer, const LogGenerator_strSourceType *ptrSource,
+                                        uint64 u64Timestamp, uint32p u32Payload, uint8 u8Checksum)
+{
+    uint32 u32LocLength = FALSE;
+    uint32 u32LocIndex = FALSE;
+
+    u32LocLength += LogGenerator_u32FormatUnsigned(&ptrBuffer[u32LocLength], ptrSource->u8Id);
+    ptrBuffer[u32LocLength++] = ',';
+    u32LocLength += LogGenerator_u32FormatUnsigned(&ptrBuffer[u32LocLength], ptrSource->u64FrameNb);
+    ptrBuffer[u32LocLength++] = ',';
+    u32LocLength += LogGenerator_u32FormatUnsigned(&ptrBuffer[u32LocLength], u64Timestamp);
+    ptrBuffer[u32LocLength++] = ',';
+    /* Payload in big endian, two hex digits per byte                                             */
+    for(u32LocIndex = 0U; u32LocIndex < (2U * PAYLOAD_BYTES_NUMBER); u32LocIndex++)
+    {
+        ptrBuffer[u32LocLength++] = LogGenerator_acHexDigits[(u32Payload >> (28U - (4U * u32LocIndex))) & 0xFU];
+    }
+    ptrBuffer[u32LocLength++] = ',';
+    ptrBuffer[u32LocLength++] = LogGenerator_acHexDigits[u8Checksum >> 4U];
+    ptrBuffer[u32LocLength++] = LogGenerator_acHexDigits[u8Checksum & 0xFU];
+    ptrBuffer[u32LocLength++] = '\n';
+
+    return u32LocLength;
+}
+
+/**********************************************************************************************************************/
+/*                                                                                                                    */
+/* !FuncName    : LogGenerator_vidMainFunction                                                                        */
+/* !Description : Read the options and write the generated log, the frames of all IDs are interleaved in the order    */
+/*                of their nominal time                                                                               */
+/*                                                                                                                    */
+/* !Inputs      : s32NumOfArg                   !Comment : Number of main arguments                                   */
+/*                ptrMainArgs                   !Comment : main function given arguments                              */
+/* !Number      : 6                                                                                                   */
+/*                                                                                                                    */
+/**********************************************************************************************************************/
+static void LogGenerator_vidMainFunction(int s32NumOfArg, char **ptrMainArgs)
+{
+    LogGenerator_strSourceType astrLocSources[GENERATOR_MAX_SOURCES];
+    LogGenerator_strSourceType *ptrLocSource = NULL;
+    uint32  u32LocSourcesNb = FALSE;
+    uint32  u32LocSource = FALSE;
+    uint64  u64LocState = FALSE;
+    uint64  u64LocSeed = GENERATOR_DEFAULT_SEED;
+    uint32  u32LocChecksumErrors = FALSE;
+    uint32  u32LocDrops = FALSE;
+    uint32  u32LocJitter = GENERATOR_DEFAULT_JITTER;
+    uint64  u64LocRowsNb = FALSE;
+    uint64  u64LocRow = FALSE;
+    uint64  u64LocTimestamp = FALSE;
+    uint32p u32LocPayload = FALSE;
+    uint8   u8LocChecksum = FALSE;
+    uint32  u32LocByte = FALSE;
+    const char *ptrLocIds = GENERATOR_DEFAULT_IDS;
+    char   *ptrLocArgs[2] = {NULL};
+    uint32  u32LocArgsNb = FALSE;
+    int     s32LocArgIndex = FALSE;
+    FILE   *ptrLocFile = NULL;
+    char   *ptrLocBuffer = NULL;
+    size_t  u32LocUsed = FALSE;
+    boolean bLocStatus = TRUE;
+
+    for(s32LocArgIndex = 1; s32LocArgIndex < s32NumOfArg; s32LocArgIndex++)
+    {
+        if(strncmp(ptrMainArgs[s32LocArgIndex], OPTION_SEED, sizeof(OPTION_SEED) - 1U) == 0)
+        {
+            u64LocSeed = strtoull(ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_SEED) - 1U, NULL, DECIMAL_BASE);
+        }
+        else if(strncmp(ptrMainArgs[s32LocArgIndex], OPTION_IDS, sizeof(OPTION_IDS) - 1U) == 0)
+        {
+            ptrLocIds = ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_IDS) - 1U;
+        }
+        else if(strncmp(ptrMainArgs[s32LocArgIndex], OPTION_CHECKSUM_ERRORS, sizeof(OPTION_CHECKSUM_ERRORS) - 1U) == 0)
+        {
+            u32LocChecksumErrors = strtoul(ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_CHECKSUM_ERRORS) - 1U, NULL,
+                                           DECIMAL_BASE);
+        }
+        else if(strncmp(ptrMainArgs[s32LocArgIndex], OPTION_DROPS, sizeof(OPTION_DROPS) - 1U) == 0)
+        {
+            u32LocDrops = strtoul(ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_DROPS) - 1U, NULL, DECIMAL_BASE);
+        }
+        else if(strncmp(ptrMainArgs[s32LocArgIndex], OPTION_JITTER, sizeof(OPTION_JITTER) - 1U) == 0)
+        {
+            u32LocJitter = strtoul(ptrMainArgs[s32LocArgIndex] + sizeof(OPTION_JITTER) - 1U, NULL, DECIMAL_BASE);
+        }
+        else if(u32LocArgsNb < 2U)
+        {
+            ptrLocArgs[u32LocArgsNb] = ptrMainArgs[s32LocArgIndex];
+            u32LocArgsNb++;
+        }
+        else
+        {
+            bLocStatus = FALSE;
+        }
+    }
+
+    if(  (bLocStatus == FALSE) || (u32LocArgsNb != 2U)
+      || (LogGenerator_bParseIds(ptrLocIds, astrLocSources, &u32LocSourcesNb) == FALSE)
+      || (u32LocChecksumErrors > GENERATOR_RATE_SCALE) || (u32LocDrops >= GENERATOR_RATE_SCALE) )
+    {
+        printf("Help Info:\n"
+            "\tlog_generator [options] ROWS OUTPUT (OUTPUT can be - for stdout)\n"
+            "\t--seed=N              seed of the pseudo random values (default 1)\n"
+            "\t--ids=ID:MS[,ID:MS]   frame IDs and their period in ms (default " GENERATOR_DEFAULT_IDS ")\n"
+            "\t--checksum-errors=N   frames with a wrong checksum, per 1000 frames (default 0)\n"
+            "\t--drops=N             frames dropped before the log, per 1000 frames (default 0)\n"
+            "\t--jitter=MS           maximum deviation of a timestamp from its period, in ms (default 1)\n");
+        return;
+    }
+
+    u64LocRowsNb = strtoull(ptrLocArgs[0], NULL, DECIMAL_BASE);
+    ptrLocFile   = (strcmp(ptrLocArgs[1], GENERATOR_STDOUT_PATH) == 0) ? stdout : fopen(ptrLocArgs[1], "wb");
+    ptrLocBuffer = malloc(GENERATOR_BUFFER_SIZE);
+    if((ptrLocFile == NULL) || (ptrLocBuffer == NULL))
+    {
+        fprintf(stderr, "Unable to open the output file");
+        free(ptrLocBuffer);
+        return;
+    }
+
+    /* xorshift64* must never hold 0                                                              */
+    u64LocState = (u64LocSeed * 0x9E3779B97F4A7C15ULL) | 1ULL;
+    memcpy(ptrLocBuffer, HEADER_FOR_INPUT_FILE "\n", sizeof(HEADER_FOR_INPUT_FILE));
+    u32LocUsed  = sizeof(HEADER_FOR_INPUT_FILE);
+
+    while((u64LocRow < u64LocRowsNb) && (bLocStatus == TRUE))
+    {
+        /* Next frame : the source with the earliest nominal time, the first one on a tie         */
+        ptrLocSource = &astrLocSources[0];
+        for(u32LocSource = 1U; u32LocSource < u32LocSourcesNb; u32LocSource++)
+        {
+            if(astrLocSources[u32LocSource].u64NextTime < ptrLocSource->u64NextTime)
+            {
+                ptrLocSource = &astrLocSources[u32LocSource];
+            }
+        }
+
+        /* The jitter moves the timestamp around its nominal time, it does not accumulate         */
+        u64LocTimestamp = ptrLocSource->u64NextTime;
+        if((u32LocJitter != 0U) && (ptrLocSource->u64FrameNb != 0U))
+        {
+            u64LocTimestamp += LogGenerator_u32RandomBelow(&u64LocState, (2U * u32LocJitter) + 1U);
+            u64LocTimestamp  = (u64LocTimestamp > u32LocJitter) ? (u64LocTimestamp - u32LocJitter) : 0U;
+        }
+        u32LocPayload = (uint32p)(LogGenerator_u64Random(&u64LocState) >> 32U);
+        u8LocChecksum = FALSE;
+        for(u32LocByte = 0U; u32LocByte < PAYLOAD_BYTES_NUMBER; u32LocByte++)
+        {
+            u8LocChecksum = (uint8)(u8LocChecksum + (uint8)(u32LocPayload >> (8U * u32LocByte)));
+        }
+        /* Sum complement : the four bytes plus the checksum give 0 modulo 256                    */
+        u8LocChecksum = (uint8)(0x100U - u8LocChecksum);
+        if(LogGenerator_u32RandomBelow(&u64LocState, GENERATOR_RATE_SCALE) < u32LocChecksumErrors)
+        {
+            u8LocChecksum = (uint8)(u8LocChecksum + 1U + LogGenerator_u32RandomBelow(&u64LocState, 255U));
+        }
+
+        if(LogGenerator_u32RandomBelow(&u64LocState, GENERATOR_RATE_SCALE) >= u32LocDrops)
+        {
+            u32LocUsed += LogGenerator_u32FormatRow(&ptrLocBuffer[u32LocUsed], ptrLocSource, u64LocTimestamp,
+                                                    u32LocPayload, u8LocChecksum);
+            u64LocRow++;
+        }
+        else
+        {
+            /* Dropped frame : its number and its time slot are lost                              */
+        }
+        ptrLocSource->u64FrameNb++;
+        ptrLocSource->u64NextTime += ptrLocSource->u32Period;
+
+        if((GENERATOR_BUFFER_SIZE - u32LocUsed) < GENERATOR_ROW_MAX_LENGTH)
+        {
+            bLocStatus = (boolean)(fwrite(ptrLocBuffer, 1U, u32LocUsed, ptrLocFile) == u32LocUsed);
+            u32LocUsed = FALSE;
+        }
+    }
+
+    if(  (bLocStatus == FALSE) || (fwrite(ptrLocBuffer, 1U, u32LocUsed, ptrLocFile) != u32LocUsed)
+      || (fflush(ptrLocFile) != 0) )
+    {
+        fprintf(stderr, "Unable to write the output file");
+    }
+    if(ptrLocFile != stdout)
+    {
+        fclose(ptrLocFile);
+    }
+    free(ptrLocBuffer);
+}
+
+/**********************************************************************************************************************/
+/* APPLICATION MAIN FUNCTION                                                                                          */
+/**********************************************************************************************************************/
+int main(int argc, char **argv)
+{
+    LogGenerator_vidMainFunction(argc, argv);
+    return 0;
+}
+
+/*---------------------------------------------------- end of file ---------------------------------------------------*/